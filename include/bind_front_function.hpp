@@ -6,6 +6,8 @@
  * @ingroup interpreter
  * @brief Callable object that binds arguments to the front of another callable.
  *
+ * Binding to a BindFrontFunction merges the arguments into one wrapper over the original target - wrappers are never
+ * nested.
  */
 class BindFrontFunction : public Callable {
    public:
@@ -16,17 +18,35 @@ class BindFrontFunction : public Callable {
      * @param bind_args The arguments to bind to the front.
      */
     BindFrontFunction(Type type, sp_callable bind_target, arg_list bind_args);
+
+    /**
+     * @brief Creates callable with bind_args bound in front - merged with arguments already bound to bind_target.
+     * @param type The type of the callable - after binding arguments.
+     * @param bind_target The target callable to bind arguments to.
+     * @param bind_args The values to bind to the front.
+     */
+    static sp_callable bind(Type type, const sp_callable& bind_target, arg_list bind_args);
     /**
      * @brief Returns the type of the callable object.
      * @return The type of the callable.
      */
     Type get_type() const override;
+
+    /**
+     * @brief Returns the callable the arguments are bound to - never a BindFrontFunction.
+     */
+    const sp_callable& get_target() const;
+
+    /**
+     * @brief Returns the values bound to the front, in order.
+     */
+    const arg_list& get_bound_args() const;
     /**
      * @brief Calls the target callable with bound arguments followed by call_args.
      * @param interpreter Reference to the interpreter executing the call.
      * @param call_args Arguments passed during the call.
      */
-    void call(Interpreter& interpreter, arg_list call_args) override;
+    void call(Interpreter& interpreter, arg_list&& call_args) override;
 
     /**
      * @brief Virtual destructor.
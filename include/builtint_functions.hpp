@@ -5,7 +5,7 @@
 
 #include "callable.hpp"
 
-using function_impl = std::function<std::optional<value>(Interpreter&, arg_list)>;
+using function_impl = std::function<std::optional<value>(Interpreter&, const arg_list&)>;
 
 /**
  * @ingroup interpreter
@@ -19,15 +19,16 @@ class BuiltinFunction : public Callable {
      * @brief BuiltinFunction Constructor
      * @param type The type of the builtin function
      * @param impl The function implementation
+     * @param name Name the function is registered under - used in traces
      */
-    BuiltinFunction(Type type, function_impl impl);
+    BuiltinFunction(Type type, function_impl impl, std::string name = "builtin");
 
     /**
      * @brief Calls the builtin function with the given arguments
      * @param interpreter Reference to the interpreter as result taker
      * @param call_args Arguments passed in a function call
      */
-    void call(Interpreter& interpreter, arg_list call_args) override;
+    void call(Interpreter& interpreter, arg_list&& call_args) override;
 
     /**
      * @brief Returns the type of the builtin function
@@ -43,6 +44,7 @@ class BuiltinFunction : public Callable {
    private:
     Type _type;
     function_impl _impl;
+    std::string _name;
 };
 
 /**
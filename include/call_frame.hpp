@@ -1,6 +1,6 @@
 #ifndef CALL_FRAME_HPP
 #define CALL_FRAME_HPP
-#include <deque>
+#include <vector>
 
 #include "scope.hpp"
 #include "type.hpp"
@@ -18,9 +18,11 @@ class CallFrame {
      * Scope is added by default to hold function arguments.
      *
      * @param return_type The expected return type of the function, or std::nullopt.
+     * @param resource Memory resource the scopes are allocated from.
      *
      */
-    CallFrame(std::optional<Type> return_type) : _scopes{Scope{}}, _return_type{return_type} {}
+    CallFrame(std::optional<Type> return_type,
+              std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
     /**
      * @brief Pushes a new scope onto the scope stack.
@@ -34,26 +36,26 @@ class CallFrame {
 
     /**
      * @brief Adds a variable to the current scope.
-     * @param identifier The variable name.
+     * @param identifier The interned variable name.
      * @param variable The variable holder.
      */
-    void add_variable(std::string identifier, VariableHolder variable);
+    void add_variable(symbol_id identifier, VariableHolder variable);
 
     /**
      * @brief Searches for a variable by name in all scopes (from top to bottom).
-     * @param identifier The variable name.
+     * @param identifier The interned variable name.
      * @return The variable holder if found, otherwise std::nullopt.
      */
-    std::optional<VariableHolder> find_variable(const std::string& identifier);
+    std::optional<VariableHolder> find_variable(symbol_id identifier);
 
     /**
      * @brief Checks if a variable exists in the current (top) scope.
-     * @param identifier The variable name.
+     * @param identifier The interned variable name.
      * @return True if the variable exists in the current scope, false otherwise.
      *
      * Used mainly to decide if new value can be initialized
      */
-    bool is_in_current_scope(const std::string& identifier);
+    bool is_in_current_scope(symbol_id identifier);
 
     /**
      * @brief Returns the expected return type of current funtion - to which the call frame belongs
@@ -62,7 +64,8 @@ class CallFrame {
     std::optional<Type> get_ret_type() const;
 
    private:
-    std::deque<Scope> _scopes;
+    // innermost scope at the back - entering and leaving blocks reuses the capacity instead of allocating
+    std::pmr::vector<Scope> _scopes;
     std::optional<Type> _return_type;
 };
 
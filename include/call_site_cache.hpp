@@ -0,0 +1,24 @@
+#ifndef CALL_SITE_CACHE_HPP
+#define CALL_SITE_CACHE_HPP
+#include <cstdint>
+#include <memory>
+
+#include "callable.hpp"
+
+/**
+ * @ingroup interpreter
+ * @brief Monomorphic inline cache kept on @ref FunctionCall node.
+ *
+ * Remembers the callee resolved at the last call and its type info. Global functions can't be
+ * redefined or shadowed, so for direct calls of them (@ref is_global) the callee expression is
+ * not evaluated again. For callables held in variables the callee is evaluated and only type info
+ * is reused while it's still the same callable. Entry is valid only for the program run that filled it.
+ */
+struct CallSiteCache {
+    std::uint64_t run_id;
+    sp_callable callee;
+    Rc<FunctionTypeInfo> type_info;
+    bool is_global;
+};
+
+#endif  // CALL_SITE_CACHE_HPP
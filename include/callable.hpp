@@ -8,22 +8,22 @@ class Interpreter;
  * @ingroup interpreter
  * @brief Base for all that can be called.
  */
-class Callable {
+class Callable : public RcCounted {
    public:
-    ~Callable() = default;
+    virtual ~Callable() = default;
     /**
      * @brief Calls the callable object with the given interpreter and arguments.
      * @param interpreter Reference to the interpreter executing the call.
-     * @param call_args List of arguments passed to the callable - can be variables or values.
+     * @param call_args List of arguments passed to the callable - can be variables or values. Callee may move the
+     * arguments out, the list itself stays with the caller - its buffer can be reused for the next call.
      */
-    virtual void call(Interpreter& interpreter, arg_list call_args) = 0;
+    virtual void call(Interpreter& interpreter, arg_list&& call_args) = 0;
     /**
      * @brief Returns the type of the callable object.
      * @return The type of the callable.
      */
     virtual Type get_type() const = 0;
 };
-using sp_callable = std::shared_ptr<Callable>;
 
 std::ostream& operator<<(std::ostream& os, const Callable& callable);
 std::ostream& operator<<(std::ostream& os, const sp_callable& ptr);
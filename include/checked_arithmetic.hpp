@@ -0,0 +1,115 @@
+#ifndef CHECKED_ARITHMETIC_HPP
+#define CHECKED_ARITHMETIC_HPP
+#include <concepts>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @ingroup interpreter
+ * @brief Outcome of a checked arithmetic operation.
+ */
+enum class ArithmeticStatus : std::uint8_t {
+    OK,
+    INT_OVERFLOW,
+    DIV_BY_ZERO,
+};
+
+/**
+ * @ingroup interpreter
+ * @brief Result of a checked operation - value is meaningful only when status is OK.
+ */
+template <typename T>
+struct Checked {
+    T value;
+    ArithmeticStatus status;
+
+    bool ok() const noexcept {
+        return status == ArithmeticStatus::OK;
+    }
+};
+
+/**
+ * @ingroup interpreter
+ * @brief Overflow checked arithmetic that reports errors by status instead of throwing.
+ *
+ * Built on compiler overflow builtins where available. Exceptions are raised by the caller
+ * (@ref OperHandler::raise_arithmetic_error), so the common path stays branch-light.
+ */
+namespace CheckedArithmetic {
+template <std::signed_integral T>
+constexpr Checked<T> add(T left, T right) noexcept {
+    T result{};
+#if defined(__GNUC__) || defined(__clang__)
+    if (__builtin_add_overflow(left, right, &result)) return {T{}, ArithmeticStatus::INT_OVERFLOW};
+#else
+    if ((right > 0 and left > std::numeric_limits<T>::max() - right) or
+        (right < 0 and left < std::numeric_limits<T>::min() - right)) {
+        return {T{}, ArithmeticStatus::INT_OVERFLOW};
+    }
+    result = left + right;
+#endif
+    return {result, ArithmeticStatus::OK};
+}
+
+template <std::signed_integral T>
+constexpr Checked<T> subtract(T left, T right) noexcept {
+    T result{};
+#if defined(__GNUC__) || defined(__clang__)
+    if (__builtin_sub_overflow(left, right, &result)) return {T{}, ArithmeticStatus::INT_OVERFLOW};
+#else
+    if ((right < 0 and left > std::numeric_limits<T>::max() + right) or
+        (right > 0 and left < std::numeric_limits<T>::min() + right)) {
+        return {T{}, ArithmeticStatus::INT_OVERFLOW};
+    }
+    result = left - right;
+#endif
+    return {result, ArithmeticStatus::OK};
+}
+
+template <std::signed_integral T>
+constexpr Checked<T> multiply(T left, T right) noexcept {
+    T result{};
+#if defined(__GNUC__) || defined(__clang__)
+    if (__builtin_mul_overflow(left, right, &result)) return {T{}, ArithmeticStatus::INT_OVERFLOW};
+#else
+    constexpr T max{std::numeric_limits<T>::max()};
+    constexpr T min{std::numeric_limits<T>::min()};
+    if (left != 0 and right != 0) {
+        bool overflow{left > 0 ? (right > 0 ? left > max / right : right < min / left)
+                               : (right > 0 ? left < min / right : left < max / right)};
+        if (overflow) return {T{}, ArithmeticStatus::INT_OVERFLOW};
+    }
+    result = left * right;
+#endif
+    return {result, ArithmeticStatus::OK};
+}
+
+// -min doesn't fit
+template <std::signed_integral T>
+constexpr Checked<T> negate(T val) noexcept {
+    T result{};
+#if defined(__GNUC__) || defined(__clang__)
+    if (__builtin_sub_overflow(T{0}, val, &result)) return {T{}, ArithmeticStatus::INT_OVERFLOW};
+#else
+    if (val == std::numeric_limits<T>::min()) return {T{}, ArithmeticStatus::INT_OVERFLOW};
+    result = -val;
+#endif
+    return {result, ArithmeticStatus::OK};
+}
+
+template <std::signed_integral T>
+constexpr Checked<T> divide(T left, T right) noexcept {
+    if (right == 0) return {T{}, ArithmeticStatus::DIV_BY_ZERO};
+    // min / -1 doesn't fit
+    if (left == std::numeric_limits<T>::min() and right == -1) return {T{}, ArithmeticStatus::INT_OVERFLOW};
+    return {static_cast<T>(left / right), ArithmeticStatus::OK};
+}
+
+template <std::floating_point T>
+constexpr Checked<T> divide(T left, T right) noexcept {
+    if (right == 0) return {T{}, ArithmeticStatus::DIV_BY_ZERO};
+    return {left / right, ArithmeticStatus::OK};
+}
+}  // namespace CheckedArithmetic
+
+#endif  // CHECKED_ARITHMETIC_HPP
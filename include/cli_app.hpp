@@ -4,8 +4,8 @@
 #include <memory>
 
 #include "ilexer.hpp"
-#include "interpreter.hpp"
 #include "iparser.hpp"
+#include "program.hpp"
 
 /**
  * @defgroup app_core Application Core
@@ -28,11 +28,27 @@ class CLIApp {  // nazwa tymczasowa - potem moze do zmiany
     // TODO: make struct for options
     bool _use_stdin;
     bool _verbose;
-    Interpreter _interpreter;
+    bool _watch;
+    bool _mem_stats;
+    bool _trace;
+    bool _profile;
+    bool _count_nodes;
+    bool _hot_spots;
+    int _sample_interval_us;
     std::string _input_filename;
+    std::string _trace_out_filename;
+    std::string _sample_out_filename;
 
     void _parse_args(int argc, char* const argv[]);
     void _initialize_components();
+    /**
+     * @brief Runs the program with interpreter instrumented as requested by options.
+     */
+    void _run_program(const Program& program);
+    /**
+     * @brief Reruns the input file each time it is saved, reparsing only changed function definitions.
+     */
+    void _watch_input();
 };
 
 #endif  // CLI_APP
\ No newline at end of file
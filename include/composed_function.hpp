@@ -5,20 +5,27 @@
 
 /**
  * @ingroup interpreter
- * @brief Represents a function composed of two callable objects.
+ * @brief Represents a function composed of callable objects - a pipeline of stages.
  *
- * ComposedFunction chains two callable objects, where the result of the first
- * is passed as the input to the second.
+ * Result of each stage is passed as the input to the next one. Composing a ComposedFunction copies its stages
+ * instead of nesting it, so `f & g & h` is a single pipeline of three stages.
  */
 class ComposedFunction : public Callable {
    public:
     /**
      * @brief Constructs a ComposedFunction.
      * @param type The type of the composed function.
-     * @param first The first callable to be executed.
-     * @param second The second callable to be executed with the result of the first.
+     * @param stages Callables executed in order, none of them composed.
      */
-    ComposedFunction(Type type, sp_callable first, sp_callable second);
+    ComposedFunction(Type type, std::vector<sp_callable> stages);
+
+    /**
+     * @brief Creates pipeline running first, then second - stages of composed operands are inlined.
+     * @param type The type of the composed function.
+     * @param first The callable to be executed first.
+     * @param second The callable to be executed with the result of the first.
+     */
+    static sp_callable compose(Type type, const sp_callable& first, const sp_callable& second);
 
     /**
      * @brief Returns the type of the composed function.
@@ -26,13 +33,18 @@ class ComposedFunction : public Callable {
      */
     Type get_type() const override;
 
+    /**
+     * @brief Returns the stages of the pipeline in execution order.
+     */
+    const std::vector<sp_callable>& get_stages() const;
+
     /**
      * @brief Calls the composed function with the given arguments.
-     *        Executes the first callable, then passes its result to the second callable.
+     *        Executes the stages in order, the argument list is reused to pass each result to the next stage.
      * @param interpreter Reference to the interpreter executing the call.
      * @param call_args Arguments passed to the composed function.
      */
-    void call(Interpreter& interpreter, arg_list call_args) override;
+    void call(Interpreter& interpreter, arg_list&& call_args) override;
 
     /**
      * @brief Virtual destructor.
@@ -41,7 +53,6 @@ class ComposedFunction : public Callable {
 
    private:
     Type _type;
-    sp_callable _first_func;
-    sp_callable _second_func;
+    std::vector<sp_callable> _stages;
 };
-#endif  // COMPOSED_FUNCTION_HPP
\ No newline at end of file
+#endif  // COMPOSED_FUNCTION_HPP
@@ -0,0 +1,34 @@
+#ifndef COUNTED_LOOP_HPP
+#define COUNTED_LOOP_HPP
+#include <optional>
+
+#include "expression.hpp"
+#include "statement.hpp"
+#include "symbol.hpp"
+
+/**
+ * @ingroup interpreter
+ * @brief Shape of a for loop counting an int variable - kept on @ref ForLoop node.
+ *
+ * Matches `for (i: int = a; i < b; i = i + c)` with any of <, <=, >, >= as comparison, the bound being an int
+ * literal or a variable and the step an int literal added or subtracted. Loops whose body assigns to the counter
+ * never match. Such loops are executed without dispatching the condition and the update through the AST.
+ */
+struct CountedLoop {
+    bool matches;
+    symbol_id counter;
+    ExprKind comparison;
+    // nullptr when the bound is the literal
+    const Identifier* bound_variable;
+    int_value bound_literal;
+    ExprKind step_kind;
+    int_value step;
+
+    /**
+     * @brief Checks the loop's shape.
+     * @return Counted loop with matches == false when the loop has to run through the general path.
+     */
+    static CountedLoop match(const ForLoop& for_loop);
+};
+
+#endif  // COUNTED_LOOP_HPP
@@ -1,5 +1,6 @@
 #ifndef ENVIRONMENT_HPP
 #define ENVIRONMENT_HPP
+#include <memory_resource>
 #include <stack>
 
 #include "call_frame.hpp"
@@ -12,7 +13,8 @@
  *
  * Manages function definitions, variable scopes, and call frames.
  * It provides mechanisms for variable declaration, function registration, and scope management
- * during program execution.
+ * during program execution. Variables, scopes and call frames are allocated from the environment's own pool -
+ * memory released on scope or frame exit is reused by the next ones instead of going back to the heap.
  */
 class Environment {
    public:
@@ -24,25 +26,26 @@ class Environment {
     /**
      * @brief Registers a global function definition in the environment.
      * @param function The function definition to register.
+     * @return false if a function with the same name is already defined - nothing is registered then.
      */
-    void register_function(const FunctionDefinition& function);
+    bool register_function(const FunctionDefinition& function);
 
     /**
      * @brief Declares a variable with a given identifier and variable holder.
-     * @param identifier The variable name.
+     * @param identifier The interned variable name.
      * @param var_holder The variable holder.
      */
-    void declare_variable(std::string identifier, VariableHolder var_holder);
+    void declare_variable(symbol_id identifier, VariableHolder var_holder);
 
     /**
      * @brief Declares a variable with a given identifier, type, and value.
-     * @param identifier The variable name.
+     * @param identifier The interned variable name.
      * @param var_type The type of the variable.
      * @param var_value The value of the variable.
      *
      * Sometimes it was easier not to constructo the VariableHolder object in the interpreter.
      */
-    void declare_variable(std::string identifier, VariableType var_type, value var_value);
+    void declare_variable(symbol_id identifier, VariableType var_type, value var_value);
 
     /**
      * @brief Pushes new CallFrame to the call frame stac. Used when calling function.
@@ -73,29 +76,31 @@ class Environment {
 
     /**
      * @brief Checks if a variable can be defined in the current scope.
-     * @param identifier The variable name.
+     * @param identifier The interned variable name.
      * @return True if the variable can be defined, false otherwise.
      *
      * can never define variables with the same name as some global function
      */
-    bool can_define(const std::string& identifier);
+    bool can_define(symbol_id identifier);
 
     /**
      * @brief Retrieves a variable by its identifier from the environment.
-     * @param identifier The variable name.
+     * @param identifier The interned variable name.
      * @return The variable holder if found, otherwise std::nullopt.
      */
-    std::optional<VariableHolder> get_by_identifier(const std::string& identifier);
+    std::optional<VariableHolder> get_by_identifier(symbol_id identifier);
 
     /**
      * @brief Retrieves a global function by its identifier.
-     * @param identifier The function name.
+     * @param identifier The interned function name.
      * @return Shared pointer to the callable if found.
      */
-    sp_callable get_global_function(const std::string& identifier);
+    sp_callable get_global_function(symbol_id identifier);
 
    private:
-    std::unordered_map<std::string, sp_callable> _functions;
-    std::stack<CallFrame> _call_frames;
+    // declared first - destroyed after everything allocated from it
+    std::pmr::unsynchronized_pool_resource _pool;
+    std::unordered_map<symbol_id, sp_callable> _functions;
+    std::stack<CallFrame, std::pmr::vector<CallFrame>> _call_frames;
 };
 #endif  // ENVIRONMENT_HPP
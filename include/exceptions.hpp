@@ -38,6 +38,14 @@ class FileOpenException : public std::runtime_error {
     explicit FileOpenException(const std::string& filename);
 };
 
+/*
+ * @brief Source doesn't fit in 32-bit offsets used for locations.
+ */
+class SourceTooLargeException : public LexerException {
+   public:
+    explicit SourceTooLargeException();
+};
+
 /*
  * @brief Token initialization called with logically wrong token type/value pair.
  */
@@ -1,9 +1,13 @@
 #ifndef EXPRESSION_HPP
 #define EXPRESSION_HPP
+#include <cstdint>
 #include <memory>
+#include <string_view>
 #include <unordered_set>
 
+#include "int_value.hpp"
 #include "node.hpp"
+#include "symbol.hpp"
 #include "type.hpp"
 
 /**
@@ -43,7 +47,7 @@ std::string expr_kind_to_str(const ExprKind& expr_kind);
  * @brief Base class for all expressions.
  */
 struct Expression : Node {
-    explicit Expression(const Position& position, ExprKind expr_kind);
+    explicit Expression(source_offset offset, ExprKind expr_kind);
     ExprKind kind;
 };
 
@@ -58,6 +62,10 @@ struct BinaryExpression : Expression {
     explicit BinaryExpression(ExprKind kind, up_expression left, up_expression right);
     up_expression left;
     up_expression right;
+    /**
+     * @brief Type specialized operation chosen by the interpreter on first execution (QuickenedOp).
+     */
+    mutable std::uint8_t quickened;
 
     void accept(Visitor& visitor) const override;
 
@@ -69,23 +77,28 @@ struct BinaryExpression : Expression {
  * @brief Unary expression representation.
  */
 struct UnaryExpression : Expression {
-    explicit UnaryExpression(const Position& position, ExprKind kind, up_expression expr);
+    explicit UnaryExpression(source_offset offset, ExprKind kind, up_expression expr);
     up_expression expr;
 
     void accept(Visitor& visitor) const override;
 
     static const std::unordered_set<ExprKind> unary_kinds;
-    static std::unique_ptr<UnaryExpression> create(const Position& position, ExprKind kind, up_expression expr);
+    static std::unique_ptr<UnaryExpression> create(source_offset offset, ExprKind kind, up_expression expr);
 };
 
+struct CallSiteCache;
+
 /**
  * @ingroup parser
  * @brief Function call representation.
+ *
+ * @ref call_cache is filled by the interpreter - parser only reserves place for it.
  */
 struct FunctionCall : Expression {
     explicit FunctionCall(up_expression callee, up_expression_vec argument_list);
     up_expression callee;
     up_expression_vec argument_list;
+    mutable std::shared_ptr<CallSiteCache> call_cache;
 
     void accept(Visitor& visitor) const override;
 };
@@ -95,7 +108,7 @@ struct FunctionCall : Expression {
  * @brief Bind front representation.
  */
 struct BindFront : Expression {
-    explicit BindFront(const Position& position, up_expression_vec argument_list, up_expression target);
+    explicit BindFront(source_offset offset, up_expression_vec argument_list, up_expression target);
     up_expression_vec argument_list;
     up_expression target;
 
@@ -119,8 +132,9 @@ struct TypeCastExpression : Expression {
  * @brief Identifier as expression representation.
  */
 struct Identifier : Expression {
-    explicit Identifier(const Position& position, std::string name);
+    explicit Identifier(source_offset offset, std::string name);
     std::string name;
+    symbol_id symbol;
 
     void accept(Visitor& visitor) const override;
 };
@@ -129,9 +143,9 @@ struct Identifier : Expression {
  * @brief Literal integer representation.
  */
 struct LiteralInt : Expression {
-    explicit LiteralInt(const Position& position, int value);
+    explicit LiteralInt(source_offset offset, int_value value);
     Type type;
-    int value;
+    int_value value;
 
     void accept(Visitor& visitor) const override;
 };
@@ -140,7 +154,7 @@ struct LiteralInt : Expression {
  * @brief Literal float representation.
  */
 struct LiteralFloat : Expression {
-    explicit LiteralFloat(const Position& position, double value);
+    explicit LiteralFloat(source_offset offset, double value);
     Type type = Type(TypeKind::INT);
     double value;
 
@@ -150,11 +164,13 @@ struct LiteralFloat : Expression {
 /**
  * @ingroup parser
  * @brief Literal string representation.
+ *
+ * Value references the source buffer kept alive by @ref Program.
  */
 struct LiteralString : Expression {
-    explicit LiteralString(const Position& position, std::string value);
+    explicit LiteralString(source_offset offset, std::string_view value);
     Type type = Type(TypeKind::STRING);
-    std::string value;
+    std::string_view value;
 
     void accept(Visitor& visitor) const override;
 };
@@ -164,7 +180,7 @@ struct LiteralString : Expression {
  * @brief Literal boolean representation.
  */
 struct LiteralBool : Expression {
-    explicit LiteralBool(const Position& position, bool value);
+    explicit LiteralBool(source_offset offset, bool value);
     Type type = Type(TypeKind::BOOL);
     bool value;
 
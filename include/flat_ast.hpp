@@ -0,0 +1,264 @@
+#ifndef FLAT_AST_HPP
+#define FLAT_AST_HPP
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "exceptions.hpp"
+#include "expression.hpp"
+#include "position.hpp"
+#include "program.hpp"
+#include "source_handler.hpp"
+#include "type.hpp"
+
+/**
+ * @ingroup parser
+ * @brief Index of a node inside @ref FlatAst.
+ */
+using node_index = std::uint32_t;
+constexpr node_index NO_NODE{std::numeric_limits<node_index>::max()};
+
+/**
+ * @ingroup parser
+ * @brief Tag that selects the record array a @ref FlatNode points into.
+ */
+enum class FlatKind : std::uint8_t {
+    FUNCTION_DEFINITION,
+    FUNCTION_SIGNATURE,
+    TYPED_IDENTIFIER,
+
+    CONTINUE,
+    BREAK,
+    RETURN,
+    VARIABLE_DECLARATION,
+    CODE_BLOCK,
+    IF,
+    ELSE_IF,
+    ASSIGN,
+    EXPRESSION_STATEMENT,
+    FOR_LOOP,
+
+    BINARY,
+    UNARY,
+    FUNCTION_CALL,
+    BIND_FRONT,
+    TYPE_CAST,
+    IDENTIFIER,
+    LITERAL_INT,
+    LITERAL_FLOAT,
+    LITERAL_STRING,
+    LITERAL_BOOL,
+};
+
+/**
+ * @ingroup parser
+ * @brief Contiguous run of child indices stored in @ref FlatAst::lists.
+ */
+struct NodeRange {
+    std::uint32_t first{0};
+    std::uint32_t count{0};
+};
+
+/**
+ * @ingroup parser
+ * @brief Common part of every node - kind tag, source offset and index into the record array of its kind.
+ *
+ * For LITERAL_BOOL data holds the value itself, CONTINUE and BREAK don't use it.
+ */
+struct FlatNode {
+    source_offset offset;
+    FlatKind kind;
+    std::uint32_t data;
+};
+
+// records - one array per node kind, children referenced by node_index
+struct FlatFunctionDefinition {
+    node_index signature;
+    node_index body;
+    std::uint32_t source;
+};
+struct FlatFunctionSignature {
+    std::uint32_t name;
+    std::uint32_t type;
+    NodeRange params;
+};
+struct FlatTypedIdentifier {
+    std::uint32_t name;
+    std::uint32_t variable_type;
+};
+struct FlatContinue {};
+struct FlatBreak {};
+struct FlatReturn {
+    node_index expr;
+};
+struct FlatVariableDeclaration {
+    node_index typed_identifier;
+    node_index expr;
+};
+struct FlatCodeBlock {
+    NodeRange statements;
+};
+struct FlatIf {
+    node_index condition;
+    node_index body;
+    NodeRange else_ifs;
+    node_index else_body;
+};
+struct FlatElseIf {
+    node_index condition;
+    node_index body;
+};
+struct FlatAssign {
+    std::uint32_t name;
+    node_index expr;
+};
+struct FlatExpressionStatement {
+    node_index expr;
+};
+struct FlatForLoop {
+    node_index var_declaration;
+    node_index condition;
+    node_index loop_update;
+    node_index body;
+};
+struct FlatBinary {
+    ExprKind kind;
+    node_index left;
+    node_index right;
+};
+struct FlatUnary {
+    ExprKind kind;
+    node_index expr;
+};
+struct FlatFunctionCall {
+    node_index callee;
+    NodeRange arguments;
+};
+struct FlatBindFront {
+    NodeRange arguments;
+    node_index target;
+};
+struct FlatTypeCast {
+    node_index expr;
+    std::uint32_t type;
+};
+struct FlatIdentifier {
+    std::uint32_t name;
+};
+
+/**
+ * @ingroup parser
+ * @brief Program tree stored as structure of arrays.
+ *
+ * Nodes live in @ref nodes, their kind specific data in typed arrays and children are
+ * referenced by 32-bit indices. Walking is done with @ref dispatch, which switches on the
+ * kind tag instead of calling virtual methods. @ref to_program rebuilds the pointer tree,
+ * so existing visitors (@ref Printer, tests) can be used on the flat form.
+ */
+class FlatAst {
+   public:
+    static FlatAst from_program(const Program& program);
+    std::unique_ptr<Program> to_program() const;
+
+    /**
+     * @brief Calls visitor with the node and its record - the value itself for literals,
+     * FlatContinue{} / FlatBreak{} for kinds without data.
+     */
+    template <typename Visitor>
+    decltype(auto) dispatch(node_index index, Visitor&& visitor) const;
+
+    std::span<const node_index> children(NodeRange range) const;
+
+    source_offset offset;
+    NodeRange function_definitions;
+    sp_source_buffer source;
+
+    std::vector<FlatNode> nodes;
+    std::vector<node_index> lists;
+
+    std::vector<FlatFunctionDefinition> function_definition_records;
+    std::vector<FlatFunctionSignature> function_signatures;
+    std::vector<FlatTypedIdentifier> typed_identifiers;
+    std::vector<FlatReturn> returns;
+    std::vector<FlatVariableDeclaration> variable_declarations;
+    std::vector<FlatCodeBlock> code_blocks;
+    std::vector<FlatIf> ifs;
+    std::vector<FlatElseIf> else_ifs;
+    std::vector<FlatAssign> assigns;
+    std::vector<FlatExpressionStatement> expression_statements;
+    std::vector<FlatForLoop> for_loops;
+    std::vector<FlatBinary> binaries;
+    std::vector<FlatUnary> unaries;
+    std::vector<FlatFunctionCall> function_calls;
+    std::vector<FlatBindFront> bind_fronts;
+    std::vector<FlatTypeCast> type_casts;
+    std::vector<FlatIdentifier> identifiers;
+    std::vector<int_value> ints;
+    std::vector<double> floats;
+    std::vector<std::string_view> strings;
+
+    std::vector<sp_source_buffer> sources;
+    std::vector<std::string> names;
+    std::vector<Type> types;
+    std::vector<VariableType> variable_types;
+};
+
+template <typename Visitor>
+decltype(auto) FlatAst::dispatch(node_index index, Visitor&& visitor) const {
+    const FlatNode& node{nodes[index]};
+    switch (node.kind) {
+        case FlatKind::FUNCTION_DEFINITION:
+            return visitor(node, function_definition_records[node.data]);
+        case FlatKind::FUNCTION_SIGNATURE:
+            return visitor(node, function_signatures[node.data]);
+        case FlatKind::TYPED_IDENTIFIER:
+            return visitor(node, typed_identifiers[node.data]);
+        case FlatKind::CONTINUE:
+            return visitor(node, FlatContinue{});
+        case FlatKind::BREAK:
+            return visitor(node, FlatBreak{});
+        case FlatKind::RETURN:
+            return visitor(node, returns[node.data]);
+        case FlatKind::VARIABLE_DECLARATION:
+            return visitor(node, variable_declarations[node.data]);
+        case FlatKind::CODE_BLOCK:
+            return visitor(node, code_blocks[node.data]);
+        case FlatKind::IF:
+            return visitor(node, ifs[node.data]);
+        case FlatKind::ELSE_IF:
+            return visitor(node, else_ifs[node.data]);
+        case FlatKind::ASSIGN:
+            return visitor(node, assigns[node.data]);
+        case FlatKind::EXPRESSION_STATEMENT:
+            return visitor(node, expression_statements[node.data]);
+        case FlatKind::FOR_LOOP:
+            return visitor(node, for_loops[node.data]);
+        case FlatKind::BINARY:
+            return visitor(node, binaries[node.data]);
+        case FlatKind::UNARY:
+            return visitor(node, unaries[node.data]);
+        case FlatKind::FUNCTION_CALL:
+            return visitor(node, function_calls[node.data]);
+        case FlatKind::BIND_FRONT:
+            return visitor(node, bind_fronts[node.data]);
+        case FlatKind::TYPE_CAST:
+            return visitor(node, type_casts[node.data]);
+        case FlatKind::IDENTIFIER:
+            return visitor(node, identifiers[node.data]);
+        case FlatKind::LITERAL_INT:
+            return visitor(node, ints[node.data]);
+        case FlatKind::LITERAL_FLOAT:
+            return visitor(node, floats[node.data]);
+        case FlatKind::LITERAL_STRING:
+            return visitor(node, strings[node.data]);
+        case FlatKind::LITERAL_BOOL:
+            return visitor(node, node.data != 0);
+    }
+    throw ImplementationError("FlatKind didnt match?");
+}
+
+#endif  // FLAT_AST_HPP
@@ -21,7 +21,7 @@ class GlobalFunction : public Callable {
      *
      * Call done by interpreter visiting the funciton.
      */
-    void call(Interpreter& interpreter, arg_list call_args) override;
+    void call(Interpreter& interpreter, arg_list&& call_args) override;
 
     /**
      * @brief Returns the type of the function.
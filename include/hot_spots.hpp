@@ -0,0 +1,97 @@
+#ifndef HOT_SPOTS_HPP
+#define HOT_SPOTS_HPP
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+#include "instrumentation.hpp"
+#include "visitor.hpp"
+
+/**
+ * @ingroup interpreter
+ * @brief Instrumentation policy counting executions of every node.
+ */
+class HitCountingPolicy {
+   public:
+    void enter(NodeKind, const Node& node) {
+        ++_hits[&node];
+    }
+    void exit(NodeKind, const Node&) noexcept {}
+
+    std::uint64_t get_hits(const Node& node) const;
+
+   private:
+    std::unordered_map<const Node*, std::uint64_t> _hits;
+};
+
+/**
+ * @ingroup interpreter
+ * @brief Visitor that walks the program tree, like @ref Printer, collecting hit counts gathered by
+ * @ref HitCountingPolicy during a run.
+ *
+ * Prints the source annotated with hit counts per line, statements sorted by hit count and iteration counts of
+ * every for loop. Line's count is the highest count of nodes starting on it; function definitions count calls.
+ */
+class HotSpotReport : public Visitor {
+   public:
+    explicit HotSpotReport(const HitCountingPolicy& hits);
+
+    void visit(const Program& program) override;
+    void visit(const ContinueStatement& continue_stmnt) override;
+    void visit(const BreakStatement& break_stmnt) override;
+    void visit(const ReturnStatement& return_stmnt) override;
+    void visit(const VariableDeclaration& var_decl) override;
+    void visit(const CodeBlock& code_block) override;
+    void visit(const IfStatement& if_stmnt) override;
+    void visit(const ElseIf& else_if) override;
+    void visit(const AssignStatement& asgn_stmnt) override;
+    void visit(const ExpressionStatement& expr_stmnt) override;
+    void visit(const FunctionDefinition& func_def) override;
+    void visit(const FunctionSignature& func_sig) override {};
+    void visit(const ForLoop& for_loop) override;
+
+    void visit(const BinaryExpression& binary_expr) override;
+    void visit(const UnaryExpression& unary_expr) override;
+    void visit(const FunctionCall& func_call_expr) override;
+    void visit(const BindFront& bind_front_expr) override;
+    void visit(const TypeCastExpression& type_cast_expr) override;
+    void visit(const Identifier& identifier) override;
+    void visit(const LiteralInt& literal_int) override;
+    void visit(const LiteralFloat& literal_float) override;
+    void visit(const LiteralString& literal_string) override;
+    void visit(const LiteralBool& literal_bool) override;
+
+    void visit(const TypedIdentifier& typed_ident) override {};
+
+    /**
+     * @brief Prints the report of the visited program.
+     * @param os Stream to print to.
+     * @param top_count Number of statements in the hot-spot list.
+     */
+    void print(std::ostream& os, std::size_t top_count = 10) const;
+
+    std::uint64_t get_line_hits(int line) const;
+
+   private:
+    struct StatementHits {
+        NodeKind kind;
+        Position position;
+        std::uint64_t hits;
+        // for loops only - executions of the body
+        std::optional<std::uint64_t> iterations;
+    };
+
+    const HitCountingPolicy& _hits;
+    const SourceBuffer* _source{nullptr};
+    std::map<int, std::uint64_t> _line_hits;
+    std::vector<StatementHits> _statements;
+
+    void _count_line(const Node& node, std::uint64_t hits);
+    void _record(const Node& node);
+    void _record_statement(NodeKind kind, const Node& node);
+};
+
+#endif  // HOT_SPOTS_HPP
@@ -1,6 +1,7 @@
 #ifndef ILEXER_HPP
 #define ILEXER_HPP
 
+#include "source_handler.hpp"
 #include "token.hpp"
 /**
  * @ingroup lexer
@@ -9,6 +10,12 @@
 class ILexer {
    public:
     virtual Token get_next_token() = 0;
+    /**
+     * @brief Buffer referenced by string valued tokens, nullptr if tokens don't come from one.
+     */
+    virtual sp_source_buffer get_source() const {
+        return nullptr;
+    }
     virtual ~ILexer() = default;
 };
 
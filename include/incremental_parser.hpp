@@ -0,0 +1,64 @@
+#ifndef INCREMENTAL_PARSER_HPP
+#define INCREMENTAL_PARSER_HPP
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "program.hpp"
+#include "source_handler.hpp"
+
+/**
+ * @ingroup parser
+ * @brief Replacement of [begin, end) range of the previous text.
+ */
+struct TextEdit {
+    source_offset begin;
+    source_offset end;
+    std::string replacement;
+
+    /**
+     * @brief Smallest single edit turning old_text into new_text (common prefix and suffix are kept).
+     */
+    static TextEdit diff(std::string_view old_text, std::string_view new_text);
+};
+
+/**
+ * @ingroup parser
+ * @brief Keeps parsed program and updates it after text edits.
+ *
+ * Text is split into function spans - from a definition's `def` to the next one. After an edit only
+ * definitions whose spans it touches are lexed and parsed again. The rest are reused, definitions
+ * after the edit just get their offsets shifted. Each definition keeps alive the source it was parsed from.
+ */
+class IncrementalParser {
+   public:
+    explicit IncrementalParser(std::string text);
+
+    /**
+     * @brief Applies edit to the text and reparses affected definitions.
+     *
+     * On syntax error the exception is propagated and the next edit parses the whole text.
+     */
+    void apply_edit(const TextEdit& edit);
+
+    const Program& get_program() const noexcept;
+    const std::string& get_text() const noexcept;
+    /**
+     * @brief Number of definitions built by the last parse.
+     */
+    std::size_t get_reparsed_count() const noexcept;
+
+   private:
+    std::shared_ptr<SourceBuffer> _buffer;
+    std::unique_ptr<Program> _program;
+    std::vector<source_offset> _function_starts;
+    std::size_t _reparsed_count;
+    bool _needs_full_parse;
+
+    void _parse_all();
+    std::unique_ptr<Program> _parse_range(source_offset begin, source_offset end) const;
+    source_offset _span_begin(std::size_t function) const;
+};
+
+#endif  // INCREMENTAL_PARSER_HPP
@@ -0,0 +1,205 @@
+#ifndef INSTRUMENTATION_HPP
+#define INSTRUMENTATION_HPP
+#include <array>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "expression.hpp"
+#include "program.hpp"
+#include "statement.hpp"
+
+/**
+ * @ingroup interpreter
+ * @brief Kinds of nodes the interpreter executes - lets instrumentation keep per kind data in arrays.
+ */
+enum class NodeKind : std::uint8_t {
+    PROGRAM,
+    FUNCTION_DEFINITION,
+    CONTINUE_STATEMENT,
+    BREAK_STATEMENT,
+    RETURN_STATEMENT,
+    VARIABLE_DECLARATION,
+    CODE_BLOCK,
+    IF_STATEMENT,
+    ELSE_IF,
+    ASSIGN_STATEMENT,
+    EXPRESSION_STATEMENT,
+    FOR_LOOP,
+    BINARY_EXPRESSION,
+    UNARY_EXPRESSION,
+    FUNCTION_CALL,
+    BIND_FRONT,
+    TYPE_CAST_EXPRESSION,
+    IDENTIFIER,
+    LITERAL_INT,
+    LITERAL_FLOAT,
+    LITERAL_STRING,
+    LITERAL_BOOL,
+    COUNT,
+};
+
+constexpr std::size_t NODE_KIND_COUNT{static_cast<std::size_t>(NodeKind::COUNT)};
+
+/**
+ * @brief Name of the node kind, as the AST printer calls it.
+ */
+const char* node_kind_name(NodeKind kind);
+
+template <typename NodeT>
+constexpr NodeKind node_kind_of = NodeKind::COUNT;
+template <>
+constexpr NodeKind node_kind_of<Program> = NodeKind::PROGRAM;
+template <>
+constexpr NodeKind node_kind_of<FunctionDefinition> = NodeKind::FUNCTION_DEFINITION;
+template <>
+constexpr NodeKind node_kind_of<ContinueStatement> = NodeKind::CONTINUE_STATEMENT;
+template <>
+constexpr NodeKind node_kind_of<BreakStatement> = NodeKind::BREAK_STATEMENT;
+template <>
+constexpr NodeKind node_kind_of<ReturnStatement> = NodeKind::RETURN_STATEMENT;
+template <>
+constexpr NodeKind node_kind_of<VariableDeclaration> = NodeKind::VARIABLE_DECLARATION;
+template <>
+constexpr NodeKind node_kind_of<CodeBlock> = NodeKind::CODE_BLOCK;
+template <>
+constexpr NodeKind node_kind_of<IfStatement> = NodeKind::IF_STATEMENT;
+template <>
+constexpr NodeKind node_kind_of<ElseIf> = NodeKind::ELSE_IF;
+template <>
+constexpr NodeKind node_kind_of<AssignStatement> = NodeKind::ASSIGN_STATEMENT;
+template <>
+constexpr NodeKind node_kind_of<ExpressionStatement> = NodeKind::EXPRESSION_STATEMENT;
+template <>
+constexpr NodeKind node_kind_of<ForLoop> = NodeKind::FOR_LOOP;
+template <>
+constexpr NodeKind node_kind_of<BinaryExpression> = NodeKind::BINARY_EXPRESSION;
+template <>
+constexpr NodeKind node_kind_of<UnaryExpression> = NodeKind::UNARY_EXPRESSION;
+template <>
+constexpr NodeKind node_kind_of<FunctionCall> = NodeKind::FUNCTION_CALL;
+template <>
+constexpr NodeKind node_kind_of<BindFront> = NodeKind::BIND_FRONT;
+template <>
+constexpr NodeKind node_kind_of<TypeCastExpression> = NodeKind::TYPE_CAST_EXPRESSION;
+template <>
+constexpr NodeKind node_kind_of<Identifier> = NodeKind::IDENTIFIER;
+template <>
+constexpr NodeKind node_kind_of<LiteralInt> = NodeKind::LITERAL_INT;
+template <>
+constexpr NodeKind node_kind_of<LiteralFloat> = NodeKind::LITERAL_FLOAT;
+template <>
+constexpr NodeKind node_kind_of<LiteralString> = NodeKind::LITERAL_STRING;
+template <>
+constexpr NodeKind node_kind_of<LiteralBool> = NodeKind::LITERAL_BOOL;
+
+/**
+ * @ingroup interpreter
+ * @brief Hooks called by @ref InstrumentedInterpreter around execution of every node.
+ *
+ * exit is called also when the node's execution throws, so it must not throw itself.
+ */
+template <typename PolicyT>
+concept InstrumentationPolicy = requires(PolicyT policy, NodeKind kind, const Node& node) {
+    policy.enter(kind, node);
+    { policy.exit(kind, node) } noexcept;
+};
+
+/**
+ * @ingroup interpreter
+ * @brief Policy with empty hooks - instrumented interpreter using it compiles to the plain one.
+ */
+struct NoInstrumentation {
+    void enter(NodeKind, const Node&) noexcept {}
+    void exit(NodeKind, const Node&) noexcept {}
+};
+
+/**
+ * @ingroup interpreter
+ * @brief Counts executed nodes per kind.
+ */
+class CountingPolicy {
+   public:
+    void enter(NodeKind kind, const Node&) noexcept {
+        ++_counts[static_cast<std::size_t>(kind)];
+    }
+    void exit(NodeKind, const Node&) noexcept {}
+
+    std::uint64_t get_count(NodeKind kind) const;
+
+    /**
+     * @brief Prints execution count of every kind executed at least once.
+     */
+    void report(std::ostream& os) const;
+
+   private:
+    std::array<std::uint64_t, NODE_KIND_COUNT> _counts{};
+};
+
+/**
+ * @ingroup interpreter
+ * @brief Prints every executed node with its position, indented by nesting depth.
+ */
+class TracingPolicy {
+   public:
+    explicit TracingPolicy(std::ostream& os);
+    void enter(NodeKind kind, const Node& node);
+    void exit(NodeKind, const Node&) noexcept {
+        --_depth;
+    }
+
+   private:
+    std::ostream& _os;
+    std::size_t _depth{0};
+    // source of the traced program, taken when it is entered
+    const SourceBuffer* _source{nullptr};
+};
+
+/**
+ * @ingroup interpreter
+ * @brief Measures execution time per node kind - total (with nested nodes) and self.
+ *
+ * Total of a kind nested in itself (code blocks of called functions) counts the nested time again.
+ */
+class TimingPolicy {
+   public:
+    using clock = std::chrono::steady_clock;
+
+    void enter(NodeKind, const Node&) {
+        _open.push_back({clock::now(), clock::duration::zero()});
+    }
+    void exit(NodeKind kind, const Node&) noexcept {
+        OpenNode node{_open.back()};
+        _open.pop_back();
+        clock::duration elapsed{clock::now() - node.start};
+        KindTimes& times{_times[static_cast<std::size_t>(kind)]};
+        ++times.count;
+        times.total += elapsed;
+        times.self += elapsed - node.nested;
+        if (not _open.empty()) _open.back().nested += elapsed;
+    }
+
+    /**
+     * @brief Prints count, total and self time of every executed kind, by self time descending.
+     */
+    void report(std::ostream& os) const;
+
+   private:
+    struct OpenNode {
+        clock::time_point start;
+        clock::duration nested;
+    };
+    struct KindTimes {
+        std::uint64_t count{0};
+        clock::duration total{};
+        clock::duration self{};
+    };
+
+    std::vector<OpenNode> _open;
+    std::array<KindTimes, NODE_KIND_COUNT> _times{};
+};
+
+#endif  // INSTRUMENTATION_HPP
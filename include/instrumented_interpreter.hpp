@@ -0,0 +1,116 @@
+#ifndef INSTRUMENTED_INTERPRETER_HPP
+#define INSTRUMENTED_INTERPRETER_HPP
+#include <utility>
+
+#include "instrumentation.hpp"
+#include "interpreter.hpp"
+
+/**
+ * @ingroup interpreter
+ * @brief Interpreter calling the policy's hooks around execution of every node.
+ *
+ * Policy is chosen at compile time, so its hooks are inlined into the visits. The plain @ref Interpreter has no
+ * hooks at all - runs without instrumentation don't pay for it.
+ */
+template <InstrumentationPolicy PolicyT>
+class InstrumentedInterpreter : public Interpreter {
+   public:
+    explicit InstrumentedInterpreter(PolicyT policy = PolicyT{}) : _policy{std::move(policy)} {
+        // counted loops skip their condition and update nodes - counts and traces would depend on the optimization
+        _use_fast_paths = false;
+    }
+
+    PolicyT& get_policy() {
+        return _policy;
+    }
+
+    void visit(const Program& program) override {
+        _instrumented(program);
+    }
+    void visit(const FunctionDefinition& func_def) override {
+        _instrumented(func_def);
+    }
+    void visit(const ContinueStatement& continue_stmnt) override {
+        _instrumented(continue_stmnt);
+    }
+    void visit(const BreakStatement& break_stmnt) override {
+        _instrumented(break_stmnt);
+    }
+    void visit(const ReturnStatement& return_stmnt) override {
+        _instrumented(return_stmnt);
+    }
+    void visit(const VariableDeclaration& var_decl) override {
+        _instrumented(var_decl);
+    }
+    void visit(const CodeBlock& code_block) override {
+        _instrumented(code_block);
+    }
+    void visit(const IfStatement& if_stmnt) override {
+        _instrumented(if_stmnt);
+    }
+    void visit(const ElseIf& else_if) override {
+        _instrumented(else_if);
+    }
+    void visit(const AssignStatement& asgn_stmnt) override {
+        _instrumented(asgn_stmnt);
+    }
+    void visit(const ExpressionStatement& expr_stmnt) override {
+        _instrumented(expr_stmnt);
+    }
+    void visit(const ForLoop& for_loop) override {
+        _instrumented(for_loop);
+    }
+    void visit(const BinaryExpression& binary_expr) override {
+        _instrumented(binary_expr);
+    }
+    void visit(const UnaryExpression& unary_expr) override {
+        _instrumented(unary_expr);
+    }
+    void visit(const FunctionCall& func_call) override {
+        _instrumented(func_call);
+    }
+    void visit(const BindFront& bind_front_expr) override {
+        _instrumented(bind_front_expr);
+    }
+    void visit(const TypeCastExpression& type_cast_expr) override {
+        _instrumented(type_cast_expr);
+    }
+    void visit(const Identifier& identifier) override {
+        _instrumented(identifier);
+    }
+    void visit(const LiteralInt& literal_int) override {
+        _instrumented(literal_int);
+    }
+    void visit(const LiteralFloat& literal_float) override {
+        _instrumented(literal_float);
+    }
+    void visit(const LiteralString& literal_string) override {
+        _instrumented(literal_string);
+    }
+    void visit(const LiteralBool& literal_bool) override {
+        _instrumented(literal_bool);
+    }
+
+   private:
+    PolicyT _policy;
+
+    // calls exit also when the node's execution throws
+    template <typename NodeT>
+    struct ExitGuard {
+        PolicyT& policy;
+        const NodeT& node;
+        ~ExitGuard() {
+            policy.exit(node_kind_of<NodeT>, node);
+        }
+    };
+
+    template <typename NodeT>
+    void _instrumented(const NodeT& node) {
+        static_assert(node_kind_of<NodeT> != NodeKind::COUNT, "node kind missing in instrumentation.hpp");
+        _policy.enter(node_kind_of<NodeT>, node);
+        ExitGuard<NodeT> guard{_policy, node};
+        Interpreter::visit(node);
+    }
+};
+
+#endif  // INSTRUMENTED_INTERPRETER_HPP
@@ -0,0 +1,10 @@
+#ifndef INT_VALUE_HPP
+#define INT_VALUE_HPP
+#include <cstdint>
+
+/**
+ * @brief Representation of the language's int type - literals, tokens and runtime values.
+ */
+using int_value = std::int64_t;
+
+#endif  // INT_VALUE_HPP
@@ -1,10 +1,15 @@
 #ifndef INTERPRETER_HPP
 #define INTERPRETER_HPP
 
+#include <utility>
+
 #include "builtint_functions.hpp"
 #include "call_frame.hpp"
 #include "composed_function.hpp"
 #include "environment.hpp"
+#include "exceptions.hpp"
+#include "expression.hpp"
+#include "source_handler.hpp"
 #include "visitor.hpp"
 
 /**
@@ -173,16 +178,43 @@ class Interpreter : public Visitor {
     void visit(const FunctionSignature& func_sig) override{};
     void visit(const TypedIdentifier& typed_ident) override{};
 
+   protected:
+    /**
+     * @brief Allows shortcuts that run nodes without visiting them (counted loops).
+     *
+     * Turned off by @ref InstrumentedInterpreter - its policies have to see every executed node.
+     */
+    bool _use_fast_paths = true;
+
    private:
+    /**
+     * @brief Interpreter's Environment. Handles function/variables storing and visibility
+     *
+     * Declared before _tmp_result - a variable held there is released before the environment's pool.
+     */
+    Environment _env;
+
     /**
      * @brief Temporary result holder for expression evaluation.
      */
     opt_vhold_or_val _tmp_result;
 
     /**
-     * @brief Interpreter's Environment. Handles function/variables storing and visibility
+     * @brief Identifies current program run - call site caches filled in other runs are ignored.
      */
-    Environment _env;
+    std::uint64_t _run_id = 0;
+
+    /**
+     * @brief Source of the running program - node offsets are resolved against it when an error is raised.
+     */
+    const SourceBuffer* _source = nullptr;
+
+    /**
+     * @brief Expression whose operator is being applied, nullptr outside of operators.
+     *
+     * Left set when an operator throws - its position is added to the error in visit(Program).
+     */
+    const Expression* _operation_expr = nullptr;
 
     /**
      * @brief Indicates if on return.
@@ -211,6 +243,20 @@ class Interpreter : public Visitor {
      */
     bool _on_break = false;
 
+    /**
+     * @brief Rethrows currently handled operator error with position of the expression that raised it.
+     * @param e The exception being handled.
+     *
+     * Errors not raised by an operator already carry their position and are rethrown as they are.
+     */
+    template <typename ExceptionT>
+    [[noreturn]] void _rethrow_at_operation(const ExceptionT& e);
+
+    /**
+     * @brief Line and column of the node in the running program, for error messages.
+     */
+    Position _position_of(const Node& node) const;
+
     /**
      * @brief Calls the main function of the program.
      *
@@ -218,6 +264,13 @@ class Interpreter : public Visitor {
      */
     void _execute_main();
 
+    /**
+     * @brief Resolves callee of the call through its call site cache.
+     * @param func_call Reference to the function call
+     * @return Callee and its type info.
+     */
+    std::pair<sp_callable, Rc<FunctionTypeInfo>> _resolve_callee(const FunctionCall& func_call);
+
     /**
      * @brief Clears the temporary result holder.
      */
@@ -255,20 +308,27 @@ class Interpreter : public Visitor {
      * @param left Left operand value.
      * @param right Right operand value.
      */
-    void _evaluate_binary_expr(const ExprKind& expr_kind, value left, value right);
+    void _evaluate_binary_expr(const ExprKind& expr_kind, const value& left, const value& right);
 
     /**
      * @brief Delegate unary expression evaluation.
      * @param expr_kind Kind of unary expression.
      * @param val Operand value.
      */
-    void _evaluate_unary_expr(const ExprKind& expr_kind, value val);
+    void _evaluate_unary_expr(const ExprKind& expr_kind, const value& val);
 
     /**
      * @brief Evaluates a condition based on _tmp_result
-     * @param condition_pos Position of the condition in the source code.
+     * @param condition The condition expression, for the error position.
      */
-    void _evaluate_condition(const Position& condition_pos);
+    void _evaluate_condition(const Expression& condition);
+
+    /**
+     * @brief Runs the loop's iterations without dispatching its condition and update, if it is a counted loop.
+     * @param for_loop Loop with the counter already declared.
+     * @return False if the loop has to run through the general path - no iteration was run then.
+     */
+    bool _run_counted_loop(const ForLoop& for_loop);
 
     /**
      * @brief Loop setup.
@@ -289,4 +349,11 @@ class Interpreter : public Visitor {
     friend class BuiltinFunction;
 };
 
+template <typename ExceptionT>
+void Interpreter::_rethrow_at_operation(const ExceptionT& e) {
+    const Expression* operation_expr{std::exchange(_operation_expr, nullptr)};
+    if (not operation_expr) throw;
+    rethrow_with_position(e, _position_of(*operation_expr));
+}
+
 #endif  // INTERPRETER_HPP
\ No newline at end of file
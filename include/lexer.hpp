@@ -4,6 +4,7 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <string_view>
 #include <unordered_map>
 
 #include "ilexer.hpp"
@@ -24,13 +25,28 @@ class Lexer : public ILexer {
    public:
     explicit Lexer(std::unique_ptr<SourceHandler> source_handler);
     Token get_next_token() override;
+    sp_source_buffer get_source() const override;
 
    private:
+    /**
+     * @brief Allows looking up keywords by std::string_view without building a std::string.
+     */
+    struct KeywordHash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view keyword) const noexcept {
+            return std::hash<std::string_view>{}(keyword);
+        }
+    };
+
     std::unique_ptr<SourceHandler> _source_handler;
     char _character;
-    Position _position;
+    source_offset _offset;
 
     void _get_next_char();
+    /**
+     * @brief Resolves line and column of the current char - done only at token starts and on errors.
+     */
+    Position _get_position() const;
     void _ignore_white_chars();
     std::optional<Token> _try_build_identifier_or_keyword();
     std::optional<Token> _try_build_literal_int_or_float();
@@ -44,7 +60,8 @@ class Lexer : public ILexer {
      *
      * Used to compare if we have built keyword or identifier
      */
-    static const std::unordered_map<std::string, std::function<Token(Position)>> _keywords_build_map;
+    static const std::unordered_map<std::string, std::function<Token(source_offset)>, KeywordHash, std::equal_to<>>
+        _keywords_build_map;
     /**
      * @brief returns builder function/method that has only 1 correct @ref TokenType
      */
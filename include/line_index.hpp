@@ -0,0 +1,33 @@
+#ifndef LINE_INDEX_HPP
+#define LINE_INDEX_HPP
+#include <string_view>
+#include <vector>
+
+#include "position.hpp"
+
+/**
+ * @ingroup source_handler
+ * @brief Maps byte offsets in the source text to line/column @ref Position.
+ *
+ * Line starts are discovered lazily - the text is scanned only as far as the furthest offset
+ * requested so far. Lookups remember the last line found, so resolving offsets in increasing
+ * order costs constant time.
+ */
+class LineIndex {
+   public:
+    explicit LineIndex(std::string_view text);
+    Position position_of(source_offset offset) const;
+    source_offset offset_of(const Position& position) const;
+
+   private:
+    std::string_view _text;
+    mutable std::vector<source_offset> _line_starts;
+    mutable source_offset _scanned;
+    mutable std::size_t _last_line;
+
+    void _scan_up_to(source_offset offset) const;
+    void _scan_lines(std::size_t count) const;
+    std::size_t _find_line(source_offset offset) const;
+};
+
+#endif  // LINE_INDEX_HPP
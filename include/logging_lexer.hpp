@@ -13,6 +13,7 @@ class LoggingLexer : public ILexer {
    public:
     explicit LoggingLexer(std::unique_ptr<ILexer> inner);
     Token get_next_token() override;
+    sp_source_buffer get_source() const override;
 
    private:
     static const std::string _log_prefix;
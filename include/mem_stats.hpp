@@ -0,0 +1,95 @@
+#ifndef MEM_STATS_HPP
+#define MEM_STATS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+/**
+ * @ingroup app_core
+ * @brief Parts of the interpreter heap allocations are attributed to.
+ */
+enum class MemSubsystem : std::uint8_t { OTHER, LEXER, PARSER, ENVIRONMENT, VALUES, CALLABLES, COUNT };
+
+/**
+ * @ingroup app_core
+ * @brief Allocation counters of a single subsystem.
+ */
+struct MemCounters {
+    std::size_t allocations;
+    std::size_t deallocations;
+    std::size_t bytes_allocated;
+    std::size_t live_bytes;
+    std::size_t peak_live_bytes;
+};
+
+/**
+ * @ingroup app_core
+ * @brief Allocation accounting behind --mem-stats.
+ *
+ * Libraries only mark which subsystem is running with @ref MemStats::SubsystemScope. The counting itself is done by
+ * the operator new/delete replacement linked into the executable (MEM_STATS_HOOK option, off by default) - without it
+ * the counters stay empty and only the peak RSS is reported. Interpreter is single threaded, so the counters are not
+ * atomic.
+ */
+namespace MemStats {
+inline thread_local MemSubsystem current_subsystem{MemSubsystem::OTHER};
+inline std::array<MemCounters, static_cast<std::size_t>(MemSubsystem::COUNT)> counters{};
+inline MemCounters total{};
+inline bool hook_installed{false};
+
+inline void update_on_allocation(MemCounters& counters, std::size_t size) noexcept {
+    ++counters.allocations;
+    counters.bytes_allocated += size;
+    counters.live_bytes += size;
+    if (counters.live_bytes > counters.peak_live_bytes) counters.peak_live_bytes = counters.live_bytes;
+}
+
+inline void update_on_deallocation(MemCounters& counters, std::size_t size) noexcept {
+    ++counters.deallocations;
+    counters.live_bytes -= size;
+}
+
+inline void record_allocation(MemSubsystem subsystem, std::size_t size) noexcept {
+    update_on_allocation(counters[static_cast<std::size_t>(subsystem)], size);
+    update_on_allocation(total, size);
+}
+
+inline void record_deallocation(MemSubsystem subsystem, std::size_t size) noexcept {
+    update_on_deallocation(counters[static_cast<std::size_t>(subsystem)], size);
+    update_on_deallocation(total, size);
+}
+
+/**
+ * @brief Attributes allocations made during its lifetime to given subsystem, restores the previous one on exit.
+ */
+class SubsystemScope {
+   public:
+    explicit SubsystemScope(MemSubsystem subsystem) noexcept : _previous{current_subsystem} {
+        current_subsystem = subsystem;
+    }
+    ~SubsystemScope() {
+        current_subsystem = _previous;
+    }
+    SubsystemScope(const SubsystemScope&) = delete;
+    SubsystemScope& operator=(const SubsystemScope&) = delete;
+
+   private:
+    MemSubsystem _previous;
+};
+
+const char* subsystem_name(MemSubsystem subsystem);
+
+/**
+ * @brief Peak resident set size of the process in kilobytes, 0 if unavailable.
+ */
+std::size_t peak_rss_kb();
+
+/**
+ * @brief Prints per subsystem counters and peak RSS.
+ */
+void print_report(std::ostream& os);
+}  // namespace MemStats
+
+#endif  // MEM_STATS_HPP
@@ -8,8 +8,8 @@
  * @brief Node base class for
  */
 struct Node {
-    explicit Node(const Position& position);
-    Position position;
+    explicit Node(source_offset offset);
+    source_offset offset;
     virtual ~Node() = default;
 
     virtual void accept(Visitor& visitor) const {};
@@ -1,5 +1,6 @@
 #ifndef OPER_HANDLER_HPP
 #define OPER_HANDLER_HPP
+#include "checked_arithmetic.hpp"
 #include "variable.hpp"
 
 /**
@@ -7,13 +8,18 @@
  * @brief Operator handling utilities for arithmetic, comparison, logical, and function operations.
  */
 namespace OperHandler {
+/**
+ * @brief Throws exception matching the failed checked operation's status.
+ */
+[[noreturn]] void raise_arithmetic_error(ArithmeticStatus status);
+
 /**
  * @brief Adds two values.
  * @param left Left operand.
  * @param right Right operand.
  * @return Result of addition.
  */
-value add(value left, value right);
+value add(const value& left, const value& right);
 
 /**
  * @brief Subtracts right value from left value.
@@ -21,7 +27,7 @@ value add(value left, value right);
  * @param right Right operand.
  * @return Result of subtraction.
  */
-value subtract(value left, value right);
+value subtract(const value& left, const value& right);
 
 /**
  * @brief Multiplies two values.
@@ -29,7 +35,7 @@ value subtract(value left, value right);
  * @param right Right operand.
  * @return Result of multiplication.
  */
-value multiply(value left, value right);
+value multiply(const value& left, const value& right);
 
 /**
  * @brief Divides left value by right value.
@@ -37,7 +43,7 @@ value multiply(value left, value right);
  * @param right Right operand.
  * @return Result of division.
  */
-value divide(value left, value right);
+value divide(const value& left, const value& right);
 
 /**
  * @brief Checks if two values are equal.
@@ -45,7 +51,7 @@ value divide(value left, value right);
  * @param right Right operand.
  * @return True if equal, false otherwise.
  */
-bool check_eq(value left, value right);
+bool check_eq(const value& left, const value& right);
 
 /**
  * @brief Checks if two values are not equal.
@@ -53,7 +59,7 @@ bool check_eq(value left, value right);
  * @param right Right operand.
  * @return True if not equal, false otherwise.
  */
-bool check_neq(value left, value right);
+bool check_neq(const value& left, const value& right);
 
 /**
  * @brief Checks if left value is greater than right value.
@@ -61,7 +67,7 @@ bool check_neq(value left, value right);
  * @param right Right operand.
  * @return True if left > right, false otherwise.
  */
-bool check_gt(value left, value right);
+bool check_gt(const value& left, const value& right);
 
 /**
  * @brief Checks if left value is less than right value.
@@ -69,7 +75,7 @@ bool check_gt(value left, value right);
  * @param right Right operand.
  * @return True if left < right, false otherwise.
  */
-bool check_lt(value left, value right);
+bool check_lt(const value& left, const value& right);
 
 /**
  * @brief Checks if left value is greater than or equal to right value.
@@ -77,7 +83,7 @@ bool check_lt(value left, value right);
  * @param right Right operand.
  * @return True if left >= right, false otherwise.
  */
-bool check_gteq(value left, value right);
+bool check_gteq(const value& left, const value& right);
 
 /**
  * @brief Checks if left value is less than or equal to right value.
@@ -85,7 +91,7 @@ bool check_gteq(value left, value right);
  * @param right Right operand.
  * @return True if left <= right, false otherwise.
  */
-bool check_lteq(value left, value right);
+bool check_lteq(const value& left, const value& right);
 
 /**
  * @brief Logical AND operation.
@@ -93,7 +99,7 @@ bool check_lteq(value left, value right);
  * @param right Right operand.
  * @return Result of logical AND.
  */
-bool logical_and(value left, value right);
+bool logical_and(const value& left, const value& right);
 
 /**
  * @brief Logical OR operation.
@@ -101,21 +107,21 @@ bool logical_and(value left, value right);
  * @param right Right operand.
  * @return Result of logical OR.
  */
-bool logical_or(value left, value right);
+bool logical_or(const value& left, const value& right);
 
 /**
  * @brief Unary minus operation.
  * @param val Value to negate.
  * @return Negated value.
  */
-value unary_minus(value val);
+value unary_minus(const value& val);
 
 /**
  * @brief Logical NOT operation.
  * @param val Value to negate.
  * @return Result of logical NOT.
  */
-bool logical_not(value val);
+bool logical_not(const value& val);
 
 /**
  * @brief Composes two callables into a single callable.
@@ -123,7 +129,7 @@ bool logical_not(value val);
  * @param right Second callable value.
  * @return Shared pointer to composed callable.
  */
-sp_callable compose_functions(value left, value right);
+sp_callable compose_functions(const value& left, const value& right);
 
 /**
  * @brief Binds arguments to the front of a callable function.
@@ -131,7 +137,7 @@ sp_callable compose_functions(value left, value right);
  * @param args Arguments to bind.
  * @return Shared pointer to the new callable with bound arguments.
  */
-sp_callable bind_front_function(sp_callable bind_target, arg_list args);
+sp_callable bind_front_function(const sp_callable& bind_target, const arg_list& args);
 
 };  // namespace OperHandler
 
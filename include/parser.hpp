@@ -1,8 +1,7 @@
 #ifndef PARSER_HPP
 #define PARSER_HPP
+#include <array>
 #include <memory>
-#include <unordered_map>
-#include <unordered_set>
 
 #include "expression.hpp"
 #include "ilexer.hpp"
@@ -45,20 +44,39 @@ class Parser : public IParser {
     up_expression _try_parse_expression();
     up_expression _try_parse_assigned_expression();
 
-    up_expression _try_parse_chained_binary_expression(auto try_parse_subexpr,
-                                                       const std::unordered_set<TokenType>& token_types, auto on_error);
-    up_expression _try_parse_single_binary_expression(auto try_parse_subexpr,
-                                                      const std::unordered_set<TokenType>& token_types, auto on_error);
-
-    up_expression _try_parse_logical_or();
-    up_expression _try_parse_logical_and();
-    up_expression _try_parse_equality_expression();
-    up_expression _try_parse_comparison_expression();
-    up_expression _try_parse_additive_expression();
-    up_expression _try_parse_multiplicative_expression();
-    up_expression _try_parse_type_cast();
+    /**
+     * @brief Binding power of operators, from the loosest to the tightest.
+     */
+    enum Precedence : int {
+        P_NONE,
+        P_OR,
+        P_AND,
+        P_EQUALITY,
+        P_COMPARISON,
+        P_ADDITIVE,
+        P_MULTIPLICATIVE,
+        P_TYPE_CAST,
+        P_UNARY,
+        P_FUNC_COMPOSITION,
+        P_PRIMARY,
+    };
+
+    /**
+     * @brief Entry of the operator table. Token types that are not operators have P_NONE precedence.
+     *
+     * Equality, comparison and type cast are not chainable - they can't follow an operator
+     * of the same precedence without parentheses.
+     */
+    struct OperatorInfo {
+        int precedence{P_NONE};
+        bool is_chainable{false};
+        ExprKind kind{};
+        void (*on_missing_operand)(const Position&){nullptr};
+    };
+
+    up_expression _try_parse_operator_expression(int min_precedence);
     up_expression _try_parse_unary_expression();
-    up_expression _try_parse_function_composition();
+    up_expression _parse_type_cast(up_expression expr);
 
     // jest wspolny początek dla (expression) i bind front - arg_list= (expr, ...)
     // możliwe, że próbując zbudować arg_list zbudujemy tylko (expr) i jesli następny token nie jest
@@ -84,7 +102,8 @@ class Parser : public IParser {
     FunctionTypeInfo _parse_function_type_info();
     std::optional<Type> _parse_return_type();
 
-    Position _get_position_and_digest_token();
+    source_offset _get_offset_and_digest_token();
+    Position _token_position() const;
     bool _token_type_is(TokenType token_type) const;
 
     template <typename Exception>
@@ -95,16 +114,8 @@ class Parser : public IParser {
     std::unique_ptr<ILexer> _lexer;
     Token _token;
 
-    // for binary expressions
-    static const std::unordered_set<TokenType> _or_token_types;
-    static const std::unordered_set<TokenType> _and_token_types;
-    static const std::unordered_set<TokenType> _equality_token_types;
-    static const std::unordered_set<TokenType> _comparison_token_types;
-    static const std::unordered_set<TokenType> _additive_token_types;
-    static const std::unordered_set<TokenType> _multipicative_token_types;
-    static const std::unordered_set<TokenType> _func_comp_token_types;
-
-    static const std::unordered_map<TokenType, ExprKind> _token_type_to_expr_kind;
+    // indexed by TokenType
+    static const std::array<OperatorInfo, TOKEN_TYPES_COUNT> _operators;
 };
 
 // template <typename Except, typename... Args>
@@ -116,7 +127,7 @@ class Parser : public IParser {
 template <typename Exception>
 void Parser::_token_must_be(TokenType token_type) const {
     if (not _token_type_is(token_type)) {
-        throw Exception(_token.get_position());
+        throw Exception(_token_position());
     }
 }
 
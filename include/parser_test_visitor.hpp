@@ -9,6 +9,8 @@
 
 #include "visitor.hpp"
 
+struct SourceBuffer;
+
 struct ParserTestVisitor : public Visitor {
     void visit(const Program& program) override;
     void visit(const ContinueStatement& continue_stmnt) override;
@@ -72,6 +74,7 @@ struct ParserTestVisitor : public Visitor {
 
    private:
     int _nest_level = 0;
+    const SourceBuffer* _source = nullptr;
     std::string _get_name_position_str(const Node& node, std::string element_name) const;
     struct _NestGuard {
         int& level;
@@ -1,6 +1,7 @@
 #ifndef POSITION_HPP
 #define POSITION_HPP
 #include <compare>
+#include <cstdint>
 #include <ostream>
 #include <string>
 
@@ -9,6 +10,14 @@
  * @brief Module responsible for position representation.
  */
 
+/**
+ * @ingroup position
+ * @brief Byte offset into the source text - what tokens and tree nodes store instead of a @ref Position.
+ *
+ * Line and column are resolved from it only when they are shown (see LineIndex).
+ */
+using source_offset = std::uint32_t;
+
 /**
  * @ingroup position
  * @brief Position representation. Allowes to advance itself to the next column/line
@@ -4,6 +4,8 @@
 
 #include "visitor.hpp"
 
+struct SourceBuffer;
+
 struct Expression;
 /**
  * @ingroup parser
@@ -42,6 +44,8 @@ class Printer : public Visitor {
 
    private:
     int _indent_level = 0;
+    // positions of the nodes are resolved against it, set by visit(Program)
+    const SourceBuffer* _source = nullptr;
     void _print_indent() const;
     void _print_header(std::string type_str, const Node& node, std::string additional_info = "") const;
     void _print_expression_header(const Expression& expr, std::string type_spec = "",
@@ -5,15 +5,20 @@
 #include <vector>
 
 #include "node.hpp"
+#include "source_handler.hpp"
 #include "statement.hpp"
 /**
  * @ingroup parser
  * @brief Representation of the whole program.
  */
 struct Program : public Node {
-    Program(const Position& position, up_fun_def_vec function_definitions);
+    Program(source_offset offset, up_fun_def_vec function_definitions, sp_source_buffer source = nullptr);
     void accept(Visitor& visitor) const override;
     up_fun_def_vec function_definitions;
+    /**
+     * @brief Keeps alive the source that string literals in the tree point into.
+     */
+    sp_source_buffer source;
 };
 
 #endif  // PROGRAM_HPP
\ No newline at end of file
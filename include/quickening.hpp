@@ -0,0 +1,80 @@
+#ifndef QUICKENING_HPP
+#define QUICKENING_HPP
+#include <cstdint>
+#include <optional>
+
+#include "checked_arithmetic.hpp"
+#include "expression.hpp"
+#include "variable.hpp"
+
+/**
+ * @ingroup interpreter
+ * @brief Type specialized variants of binary expressions.
+ *
+ * Stored in @ref BinaryExpression::quickened after the node was executed for the first time.
+ */
+enum class QuickenedOp : std::uint8_t {
+    UNQUICKENED,
+    GENERIC,  // not specializable (eg. function composition) or specialization guard failed
+
+    INT_ADD,
+    INT_SUB,
+    INT_MUL,
+    INT_DIV,
+    INT_EQ,
+    INT_NEQ,
+    INT_LT,
+    INT_LTEQ,
+    INT_GT,
+    INT_GTEQ,
+
+    FLOAT_ADD,
+    FLOAT_SUB,
+    FLOAT_MUL,
+    FLOAT_DIV,
+    FLOAT_EQ,
+    FLOAT_NEQ,
+    FLOAT_LT,
+    FLOAT_LTEQ,
+    FLOAT_GT,
+    FLOAT_GTEQ,
+
+    STRING_CONCAT,
+    STRING_EQ,
+    STRING_NEQ,
+    STRING_LT,
+    STRING_LTEQ,
+    STRING_GT,
+    STRING_GTEQ,
+
+    BOOL_AND,
+    BOOL_OR,
+    BOOL_EQ,
+    BOOL_NEQ,
+    BOOL_LT,
+    BOOL_LTEQ,
+    BOOL_GT,
+    BOOL_GTEQ,
+};
+
+/**
+ * @ingroup interpreter
+ * @brief Selection and execution of quickened binary operations.
+ */
+namespace Quickening {
+/**
+ * @brief Picks specialization for operation of given kind on operands of these types.
+ * @return QuickenedOp::GENERIC if there is none.
+ */
+QuickenedOp select(ExprKind kind, const value& left, const value& right);
+
+/**
+ * @brief Executes specialized operation directly on the operands' values.
+ * @return std::nullopt if operands are not of types the operation was specialized for.
+ *
+ * Never throws on overflow or division by zero - reports it through the result's status.
+ */
+std::optional<Checked<value>> execute(QuickenedOp op, const value& left, const value& right);
+}  // namespace Quickening
+
+#endif  // QUICKENING_HPP
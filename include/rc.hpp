@@ -0,0 +1,182 @@
+#ifndef RC_HPP
+#define RC_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+template <typename T>
+class Rc;
+
+template <typename T>
+struct RcTraits;
+
+/**
+ * @ingroup interpreter
+ * @brief Base of objects owned through @ref Rc - holds the reference count and the resource it came from.
+ *
+ * The count is not atomic: an object and all handles to it belong to one thread. Runtime objects (variables,
+ * function values) are created by the interpreter instance that uses them and never cross instances - one moved to
+ * another thread has to be deep-copied there instead of shared.
+ */
+class RcCounted {
+   protected:
+    RcCounted() noexcept = default;
+    // copy of an object is a new object - it starts without owners
+    RcCounted(const RcCounted&) noexcept {}
+    RcCounted& operator=(const RcCounted&) noexcept {
+        return *this;
+    }
+    ~RcCounted() = default;
+
+   private:
+    template <typename T>
+    friend struct RcTraits;
+    template <typename T, typename... Args>
+    friend Rc<T> allocate_rc(std::pmr::memory_resource* resource, Args&&... args);
+
+    std::uint32_t _rc_count{0};
+    // nullptr for objects created with plain new
+    std::pmr::memory_resource* _rc_resource{nullptr};
+};
+
+/**
+ * @brief Counting and destruction of objects behind @ref Rc.
+ *
+ * Types used through Rc while still incomplete (Callable in variable.hpp) declare an explicit specialization and
+ * define it next to the complete type.
+ */
+template <typename T>
+struct RcTraits {
+    static void retain(T* ptr) noexcept {
+        ++static_cast<RcCounted*>(ptr)->_rc_count;
+    }
+
+    static void release(T* ptr) noexcept {
+        if (--static_cast<RcCounted*>(ptr)->_rc_count == 0) _destroy(ptr);
+    }
+
+    static std::uint32_t count(const T* ptr) noexcept {
+        return static_cast<const RcCounted*>(ptr)->_rc_count;
+    }
+
+   private:
+    // kept out of line - with the delete inlined into release, GCC reports -Wuse-after-free for later releases
+    // through handles it can't prove empty
+    [[gnu::noinline]] static void _destroy(T* ptr) noexcept {
+        if constexpr (std::has_virtual_destructor_v<T>) {
+            delete ptr;
+        } else if (std::pmr::memory_resource* resource = static_cast<RcCounted*>(ptr)->_rc_resource) {
+            ptr->~T();
+            resource->deallocate(ptr, sizeof(T), alignof(T));
+        } else {
+            delete ptr;
+        }
+    }
+};
+
+/**
+ * @ingroup interpreter
+ * @brief Intrusive, non-atomic reference counted handle - single threaded replacement of std::shared_ptr.
+ */
+template <typename T>
+class Rc {
+   public:
+    Rc() noexcept = default;
+    Rc(std::nullptr_t) noexcept {}
+    // takes ownership of object without other owners
+    explicit Rc(T* ptr) noexcept : _ptr{ptr} {
+        _retain();
+    }
+    Rc(const Rc& other) noexcept : _ptr{other._ptr} {
+        _retain();
+    }
+    Rc(Rc&& other) noexcept : _ptr{std::exchange(other._ptr, nullptr)} {}
+
+    // upcasts only within hierarchies destroyed through virtual destructor
+    template <typename U>
+        requires(std::is_convertible_v<U*, T*> and std::has_virtual_destructor_v<T>)
+    Rc(const Rc<U>& other) noexcept : _ptr{other._ptr} {
+        _retain();
+    }
+    template <typename U>
+        requires(std::is_convertible_v<U*, T*> and std::has_virtual_destructor_v<T>)
+    Rc(Rc<U>&& other) noexcept : _ptr{std::exchange(other._ptr, nullptr)} {}
+
+    ~Rc() {
+        if (_ptr) RcTraits<T>::release(_ptr);
+    }
+
+    Rc& operator=(Rc other) noexcept {
+        std::swap(_ptr, other._ptr);
+        return *this;
+    }
+
+    T* get() const noexcept {
+        return _ptr;
+    }
+    T& operator*() const noexcept {
+        return *_ptr;
+    }
+    T* operator->() const noexcept {
+        return _ptr;
+    }
+    explicit operator bool() const noexcept {
+        return _ptr != nullptr;
+    }
+    std::uint32_t use_count() const noexcept {
+        return _ptr ? RcTraits<T>::count(_ptr) : 0;
+    }
+
+    friend bool operator==(const Rc& lhs, const Rc& rhs) noexcept {
+        return lhs._ptr == rhs._ptr;
+    }
+    friend bool operator==(const Rc& lhs, std::nullptr_t) noexcept {
+        return lhs._ptr == nullptr;
+    }
+
+   private:
+    template <typename U>
+    friend class Rc;
+
+    T* _ptr{nullptr};
+
+    void _retain() noexcept {
+        if (_ptr) RcTraits<T>::retain(_ptr);
+    }
+};
+
+// prints the address, like std::shared_ptr
+template <typename T>
+std::ostream& operator<<(std::ostream& os, const Rc<T>& ptr) {
+    return os << static_cast<const void*>(ptr.get());
+}
+
+template <typename T, typename... Args>
+Rc<T> make_rc(Args&&... args) {
+    return Rc<T>{new T(std::forward<Args>(args)...)};
+}
+
+/**
+ * @brief Creates object in given memory resource, it is returned there when the last handle is gone.
+ */
+template <typename T, typename... Args>
+Rc<T> allocate_rc(std::pmr::memory_resource* resource, Args&&... args) {
+    static_assert(not std::has_virtual_destructor_v<T>, "pooled objects are destroyed as their static type");
+    void* memory{resource->allocate(sizeof(T), alignof(T))};
+    T* ptr{nullptr};
+    try {
+        ptr = new (memory) T(std::forward<Args>(args)...);
+    } catch (...) {
+        resource->deallocate(memory, sizeof(T), alignof(T));
+        throw;
+    }
+    static_cast<RcCounted*>(ptr)->_rc_resource = resource;
+    return Rc<T>{ptr};
+}
+
+#endif  // RC_HPP
@@ -0,0 +1,73 @@
+#ifndef SAMPLING_PROFILER_HPP
+#define SAMPLING_PROFILER_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+struct FunctionDefinition;
+
+/**
+ * @ingroup app_core
+ * @brief Timer signal driven sampling profiler behind --sample-out.
+ *
+ * The interpreter keeps a shadow stack of user functions being executed - @ref SamplingProfiler::ShadowFrame pushed
+ * by GlobalFunction::call, two stores per call. While profiling, SIGPROF fires every interval of CPU time and its
+ * handler copies the shadow stack into a buffer allocated up front. Samples are folded into stacks
+ * ("main;outer;inner count") after the run, ready for flame graph tools. Interpreter is single threaded - the stack
+ * is only shared with the signal handler of the same thread.
+ */
+namespace SamplingProfiler {
+// deeper frames are counted, but not stored - samples are truncated to the outermost ones
+constexpr std::size_t MAX_STACK_DEPTH{256};
+
+inline std::array<const FunctionDefinition*, MAX_STACK_DEPTH> shadow_stack{};
+inline std::atomic<std::size_t> shadow_depth{0};
+
+/**
+ * @brief Marks the function as executed during its lifetime.
+ */
+class ShadowFrame {
+   public:
+    explicit ShadowFrame(const FunctionDefinition& function) noexcept {
+        std::size_t depth{shadow_depth.load(std::memory_order_relaxed)};
+        if (depth < MAX_STACK_DEPTH) shadow_stack[depth] = &function;
+        // frame has to be in place before the handler can see it
+        std::atomic_signal_fence(std::memory_order_release);
+        shadow_depth.store(depth + 1, std::memory_order_relaxed);
+    }
+    ~ShadowFrame() {
+        shadow_depth.store(shadow_depth.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+    }
+    ShadowFrame(const ShadowFrame&) = delete;
+    ShadowFrame& operator=(const ShadowFrame&) = delete;
+};
+
+/**
+ * @brief Clears previous samples and starts sampling every interval of the process' CPU time.
+ * @return False if the timer or signal handler could not be installed.
+ */
+bool start(std::chrono::microseconds interval);
+
+/**
+ * @brief Stops sampling. Samples are kept until the next start.
+ */
+void stop();
+
+/**
+ * @brief Number of samples not stored because the buffer was full.
+ */
+std::size_t dropped_samples();
+
+/**
+ * @brief Writes samples folded by stack, one "frame;frame;frame count" line per distinct stack.
+ *
+ * Samples taken outside of any user function are reported as "(no function)".
+ */
+void write_folded(std::ostream& os);
+}  // namespace SamplingProfiler
+
+#endif  // SAMPLING_PROFILER_HPP
@@ -1,22 +1,39 @@
 #ifndef SCOPE_HPP
 #define SCOPE_HPP
+#include <memory_resource>
 #include <unordered_map>
+#include <utility>
 
+#include "small_vector.hpp"
+#include "symbol.hpp"
 #include "variable.hpp"
 
 /**
  * @ingroup interpreter
  * @brief Scope representation. Contains variables in scope.
+ *
+ * Up to INLINE_CAPACITY variables are kept inline and found by linear search over their symbol ids. Scope declaring
+ * more spills all of them to a hash map - its nodes come from given memory resource (the environment's pool), so
+ * scopes left and entered again reuse them.
  */
 class Scope {
    public:
-    std::optional<VariableHolder> get_variable(const std::string& identifier);
+    static constexpr std::size_t INLINE_CAPACITY{8};
+
+    explicit Scope(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    std::optional<VariableHolder> get_variable(symbol_id identifier);
     // to check if variable declared in scope
-    bool contains_variable(const std::string& identifier);
-    void add_variable(std::string identifier, VariableHolder variable);
+    bool contains_variable(symbol_id identifier);
+    void add_variable(symbol_id identifier, VariableHolder variable);
 
    private:
-    std::unordered_map<std::string, VariableHolder> _variables;
+    using entry = std::pair<symbol_id, VariableHolder>;
+
+    SmallVector<entry, INLINE_CAPACITY> _inline_variables;
+    // used instead of the inline entries once they are outgrown
+    std::pmr::unordered_map<symbol_id, VariableHolder> _spilled_variables;
+
+    VariableHolder* _find(symbol_id identifier);
 };
 
-#endif  // SCOPE_HPP
\ No newline at end of file
+#endif  // SCOPE_HPP
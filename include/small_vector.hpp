@@ -0,0 +1,185 @@
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+
+/**
+ * @ingroup interpreter
+ * @brief Vector keeping up to N elements inline - heap is used only after outgrowing them.
+ *
+ * Used for argument lists: calls rarely take more than a few arguments, so assembling them never allocates.
+ */
+template <typename T, std::size_t N>
+class SmallVector {
+   public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    SmallVector() noexcept = default;
+
+    SmallVector(std::initializer_list<T> elements) {
+        reserve(elements.size());
+        for (const T& element : elements) push_back(element);
+    }
+
+    SmallVector(const SmallVector& other) {
+        reserve(other.size());
+        for (const T& element : other) push_back(element);
+    }
+
+    SmallVector(SmallVector&& other) noexcept {
+        _take(std::move(other));
+    }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            clear();
+            reserve(other.size());
+            for (const T& element : other) push_back(element);
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept {
+        if (this != &other) {
+            clear();
+            _release_heap();
+            _take(std::move(other));
+        }
+        return *this;
+    }
+
+    ~SmallVector() {
+        clear();
+        _release_heap();
+    }
+
+    T* begin() noexcept {
+        return _data;
+    }
+    T* end() noexcept {
+        return _data + _size;
+    }
+    const T* begin() const noexcept {
+        return _data;
+    }
+    const T* end() const noexcept {
+        return _data + _size;
+    }
+    T* data() noexcept {
+        return _data;
+    }
+    const T* data() const noexcept {
+        return _data;
+    }
+
+    T& operator[](std::size_t index) noexcept {
+        return _data[index];
+    }
+    const T& operator[](std::size_t index) const noexcept {
+        return _data[index];
+    }
+    T& front() noexcept {
+        return _data[0];
+    }
+    T& back() noexcept {
+        return _data[_size - 1];
+    }
+
+    std::size_t size() const noexcept {
+        return _size;
+    }
+    std::size_t capacity() const noexcept {
+        return _capacity;
+    }
+    bool empty() const noexcept {
+        return _size == 0;
+    }
+    bool is_inline() const noexcept {
+        return _data == _inline_data();
+    }
+
+    void reserve(std::size_t new_capacity) {
+        if (new_capacity <= _capacity) return;
+
+        T* new_data{std::allocator<T>{}.allocate(new_capacity)};
+        std::uninitialized_move(begin(), end(), new_data);
+        std::destroy(begin(), end());
+        _release_heap();
+        _data = new_data;
+        _capacity = new_capacity;
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (_size == _capacity) {
+            // argument may live in this vector - build it before the elements move
+            T element(std::forward<Args>(args)...);
+            reserve(std::max<std::size_t>(_capacity * 2, 1));
+            return *std::construct_at(_data + _size++, std::move(element));
+        }
+        return *std::construct_at(_data + _size++, std::forward<Args>(args)...);
+    }
+
+    void push_back(const T& element) {
+        emplace_back(element);
+    }
+
+    void push_back(T&& element) {
+        emplace_back(std::move(element));
+    }
+
+    void pop_back() noexcept {
+        std::destroy_at(_data + --_size);
+    }
+
+    // keeps the capacity - buffer can be filled again without allocating
+    void clear() noexcept {
+        std::destroy(begin(), end());
+        _size = 0;
+    }
+
+    friend bool operator==(const SmallVector& lhs, const SmallVector& rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+   private:
+    alignas(T) std::byte _inline_storage[N * sizeof(T)];
+    T* _data{_inline_data()};
+    std::size_t _size{0};
+    std::size_t _capacity{N};
+
+    T* _inline_data() noexcept {
+        return reinterpret_cast<T*>(_inline_storage);
+    }
+    const T* _inline_data() const noexcept {
+        return reinterpret_cast<const T*>(_inline_storage);
+    }
+
+    void _release_heap() noexcept {
+        if (not is_inline()) std::allocator<T>{}.deallocate(_data, _capacity);
+        _data = _inline_data();
+        _capacity = N;
+    }
+
+    // expects empty vector using inline storage
+    void _take(SmallVector&& other) noexcept {
+        if (other.is_inline()) {
+            std::uninitialized_move(other.begin(), other.end(), _data);
+            _size = other._size;
+            other.clear();
+            return;
+        }
+        _data = std::exchange(other._data, other._inline_data());
+        _size = std::exchange(other._size, 0);
+        _capacity = std::exchange(other._capacity, N);
+    }
+};
+
+#endif  // SMALL_VECTOR_HPP
@@ -1,10 +1,14 @@
 #ifndef SOURCE_HANDLER_HPP
 #define SOURCE_HANDLER_HPP
+#include <deque>
 #include <istream>
 #include <memory>
+#include <string>
+#include <string_view>
 #include <utility>
 
 #include "constants.hpp"
+#include "line_index.hpp"
 #include "position.hpp"
 
 /**
@@ -12,21 +16,68 @@
  * @brief Module responsible for reading characters from the source.
  */
 
+/**
+ * @ingroup source_handler
+ * @brief Whole source text kept alive for tokens and tree nodes that reference it.
+ *
+ * String valued tokens are views into @ref text. Only string literals containing escape
+ * sequences need their own storage - those are kept in @ref decoded_literals.
+ * Views and @ref lines point into the buffer itself, so it is never copied.
+ */
+struct SourceBuffer {
+    explicit SourceBuffer(std::string text);
+    SourceBuffer(const SourceBuffer&) = delete;
+    SourceBuffer& operator=(const SourceBuffer&) = delete;
+
+    std::string text;
+    std::deque<std::string> decoded_literals;
+    LineIndex lines;
+};
+
+using sp_source_buffer = std::shared_ptr<const SourceBuffer>;
+
+/**
+ * @ingroup source_handler
+ * @brief Line and column of the offset - for error messages and reports only.
+ *
+ * Without a source (tokens not read from one) the offset is shown as a column of the first line.
+ */
+Position resolve_position(const SourceBuffer* source, source_offset offset);
+
 /**
  * @ingroup source_handler
  * @brief Class providing chars for @ref Lexer and controlling the positon in stream.
+ *
+ * Tracks only the byte offset of the last returned char. Line and column are resolved through
+ * the buffer's @ref LineIndex when they are actually requested.
  */
 class SourceHandler {
    public:
     explicit SourceHandler(std::unique_ptr<std::istream> source);
+    /**
+     * @brief Reads only [begin, end) of already loaded buffer - positions stay relative to the whole text.
+     */
+    SourceHandler(std::shared_ptr<SourceBuffer> buffer, source_offset begin, source_offset end);
+    char get_char();
     std::pair<char, Position> get_char_and_position();
 
-   private:
-    Position _position;
-    std::unique_ptr<std::istream> _source;
+    /**
+     * @brief Offset in the source text of the char last returned by @ref get_char.
+     */
+    source_offset get_char_offset() const noexcept;
+    Position get_position(source_offset offset) const;
+    std::string_view slice(source_offset begin, source_offset end) const;
+    /**
+     * @brief Moves decoded literal into the buffer and returns view that stays valid with it.
+     */
+    std::string_view store_decoded(std::string decoded);
+    sp_source_buffer get_buffer() const noexcept;
 
-    void _adjust_position(char c);
-    char _get_char();
+   private:
+    std::shared_ptr<SourceBuffer> _buffer;
+    source_offset _offset;
+    source_offset _char_offset;
+    source_offset _end;
 };
 
-#endif  // SOURCE_HANDLER_HPP
\ No newline at end of file
+#endif  // SOURCE_HANDLER_HPP
@@ -5,6 +5,7 @@
 
 #include "expression.hpp"
 #include "node.hpp"
+#include "source_handler.hpp"
 #include "typed_identifier.hpp"
 /**
  * @ingroup parser
@@ -50,7 +51,7 @@ struct BreakStatement : public Statement {
  * @brief Return statement representation.
  */
 struct ReturnStatement : public Statement {
-    explicit ReturnStatement(const Position& position, up_expression expression = nullptr);
+    explicit ReturnStatement(source_offset offset, up_expression expression = nullptr);
     up_expression expression;
     void accept(Visitor& visitor) const override;
 };
@@ -60,7 +61,7 @@ struct ReturnStatement : public Statement {
  * @brief Variable declaration statement representation.
  */
 struct VariableDeclaration : public Statement {
-    explicit VariableDeclaration(const Position& position, up_typed_identifier typed_identifier,
+    explicit VariableDeclaration(source_offset offset, up_typed_identifier typed_identifier,
                                  up_expression assigned_expression);
     up_typed_identifier typed_identifier;
     up_expression assigned_expression;
@@ -70,10 +71,14 @@ struct VariableDeclaration : public Statement {
 /**
  * @ingroup parser
  * @brief Code block representation.
+ *
+ * Counts its own variable declarations (nested blocks have their own scopes) - a block declaring nothing is executed
+ * without opening a scope.
  */
 struct CodeBlock : public Statement {
-    explicit CodeBlock(const Position& position, up_statement_vec statements);
+    explicit CodeBlock(source_offset offset, up_statement_vec statements);
     up_statement_vec statements;
+    std::size_t declaration_count;
     void accept(Visitor& visitor) const override;
 };
 
@@ -82,7 +87,7 @@ struct CodeBlock : public Statement {
  * @brief If statement representation.
  */
 struct IfStatement : public Statement {
-    explicit IfStatement(const Position& position, up_expression condition, up_statement body, up_else_if_vec else_ifs,
+    explicit IfStatement(source_offset offset, up_expression condition, up_statement body, up_else_if_vec else_ifs,
                          up_statement else_body);
     up_expression condition;
     up_statement body;
@@ -96,7 +101,7 @@ struct IfStatement : public Statement {
  * @brief Else if statement representation.
  */
 struct ElseIf : public Statement {
-    explicit ElseIf(const Position& position, up_expression condition, up_statement body);
+    explicit ElseIf(source_offset offset, up_expression condition, up_statement body);
     up_expression condition;
     up_statement body;
     void accept(Visitor& visitor) const override;
@@ -107,8 +112,9 @@ struct ElseIf : public Statement {
  * @brief Assignment statement representation.
  */
 struct AssignStatement : public Statement {
-    explicit AssignStatement(const Position& position, std::string identifier, up_expression expr);
+    explicit AssignStatement(source_offset offset, std::string identifier, up_expression expr);
     std::string identifier;
+    symbol_id symbol;
     up_expression expr;
     void accept(Visitor& visitor) const override;
 };
@@ -128,7 +134,7 @@ struct ExpressionStatement : public Statement {
  * @brief Function signature representation.
  */
 struct FunctionSignature : public Node {
-    explicit FunctionSignature(const Position& position, std::string identifier, up_typed_ident_vec params,
+    explicit FunctionSignature(source_offset offset, std::string identifier, up_typed_ident_vec params,
                                std::optional<Type> return_type);
     std::string identifier;
     Type type;
@@ -144,23 +150,33 @@ struct FunctionSignature : public Node {
  * @brief Function definition representation.
  */
 struct FunctionDefinition : public Statement {
-    explicit FunctionDefinition(up_func_sig signature, up_statement body);
+    explicit FunctionDefinition(up_func_sig signature, up_statement body, sp_source_buffer source = nullptr);
     up_func_sig signature;
     up_statement body;
+    /**
+     * @brief Source the definition was parsed from. Kept per definition, so definitions can be reused
+     * in a program reparsed from a newer text (see @ref IncrementalParser).
+     */
+    sp_source_buffer source;
     void accept(Visitor& visitor) const override;
 };
 
+struct CountedLoop;
+
 /**
  * @ingroup parser
  * @brief For loop representation.
+ *
+ * @ref counted_loop is filled by the interpreter - parser only reserves place for it.
  */
 struct ForLoop : public Statement {
-    explicit ForLoop(const Position& position, up_statement var_declaration, up_expression condition,
+    explicit ForLoop(source_offset offset, up_statement var_declaration, up_expression condition,
                      up_statement loop_update, up_statement body);
     up_statement var_declaration;
     up_expression condition;
     up_statement loop_update;
     up_statement body;
+    mutable std::shared_ptr<CountedLoop> counted_loop;
 
     void accept(Visitor& visitor) const override;
 };
@@ -0,0 +1,73 @@
+#ifndef STRING_VALUE_HPP
+#define STRING_VALUE_HPP
+#include <compare>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+/**
+ * @ingroup interpreter
+ * @brief Immutable string value of the language.
+ *
+ * Short strings (up to @ref INLINE_CAPACITY chars) are stored inline, without allocation.
+ * Longer ones are a prefix of a shared, append-only buffer - copies only share the buffer.
+ * Concatenation appends in place when the left operand covers the whole buffer (it's the most
+ * recent value built in it) - older values still see their own, unchanged prefix. So
+ * `s = s + piece;` in a loop costs amortized O(length of piece) instead of copying s every time.
+ */
+class StringValue {
+   public:
+    StringValue() noexcept;
+    StringValue(std::string text);
+    StringValue(std::string_view text);
+    StringValue(const char* text);
+
+    StringValue(const StringValue& other) noexcept;
+    StringValue(StringValue&& other) noexcept;
+    StringValue& operator=(const StringValue& other) noexcept;
+    StringValue& operator=(StringValue&& other) noexcept;
+    ~StringValue();
+
+    std::string_view view() const noexcept;
+    std::string str() const;
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+    bool is_inline() const noexcept;
+
+    /**
+     * @brief left + right, appending into left's buffer when possible.
+     */
+    static StringValue concat(const StringValue& left, std::string_view right);
+
+    friend StringValue operator+(const StringValue& left, const StringValue& right);
+    friend bool operator==(const StringValue& left, const StringValue& right) noexcept;
+    friend std::strong_ordering operator<=>(const StringValue& left, const StringValue& right) noexcept;
+
+   private:
+    struct Shared {
+        std::shared_ptr<std::string> buffer;
+        std::size_t size;
+    };
+
+   public:
+    static constexpr std::size_t INLINE_CAPACITY{sizeof(Shared)};
+
+   private:
+    static constexpr std::uint8_t SHARED_TAG{0xFF};
+
+    union {
+        Shared _shared;
+        char _inline[INLINE_CAPACITY];
+    };
+    // length of inline string or SHARED_TAG
+    std::uint8_t _inline_size;
+
+    StringValue(std::shared_ptr<std::string> buffer, std::size_t size) noexcept;
+    void _set_inline(std::string_view first, std::string_view second = {}) noexcept;
+};
+
+std::ostream& operator<<(std::ostream& os, const StringValue& string_value);
+
+#endif  // STRING_VALUE_HPP
@@ -0,0 +1,33 @@
+#ifndef SYMBOL_HPP
+#define SYMBOL_HPP
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @ingroup parser
+ * @brief Interned identifier - equal names always get the same id.
+ */
+using symbol_id = std::uint32_t;
+
+/**
+ * @ingroup parser
+ * @brief Process wide identifier interner.
+ *
+ * Identifiers are interned once, when the AST node holding them is created - the interpreter compares ids instead of
+ * hashing and comparing strings. Ids stay valid for the whole process, so AST reused between runs (watch mode, see
+ * @ref IncrementalParser) keeps working.
+ */
+namespace Symbols {
+/**
+ * @brief Returns id of given name, assigning a new one if it is seen for the first time.
+ */
+symbol_id intern(std::string_view name);
+
+/**
+ * @brief Returns the name the id was assigned to.
+ */
+const std::string& name(symbol_id symbol);
+}  // namespace Symbols
+
+#endif  // SYMBOL_HPP
@@ -1,35 +1,41 @@
 #ifndef TOKEN_HPP
 #define TOKEN_HPP
 
-#include <variant>
+#include <concepts>
 #include <string>
+#include <string_view>
+#include <variant>
 
 #include "exceptions.hpp"
+#include "int_value.hpp"
 #include "position.hpp"
 #include "token_type.hpp"
 
-using optional_token_value = std::variant<std::monostate, int, double, bool, std::string>;
+using optional_token_value = std::variant<std::monostate, int_value, double, bool, std::string_view>;
 
 /**
  * @ingroup lexer
  * @brief Class representing Token
  *
  * There are 6 posible @ref Token Types that have value:
- * - T_LITERAL_INT - int
+ * - T_LITERAL_INT - int_value
  * - T_LITERAL_FLOAT - double
- * - T_LITERAL_STRING - std::string
+ * - T_LITERAL_STRING - std::string_view
  * - T_LITERAL_BOOL - bool
- * - T_COMMENT - std::string
- * - T_IDENTIFIER - std::string
+ * - T_COMMENT - std::string_view
+ * - T_IDENTIFIER - std::string_view
+ *
+ * String values are not owned by the token - they reference the source buffer (see @ref SourceBuffer),
+ * which has to outlive the token. Requesting std::string makes an owned copy.
  */
 using namespace tkm;
 class Token {
    public:
-    Token(TokenType type, Position position);
-    Token(TokenType type, Position position, optional_token_value value);
+    Token(TokenType type, source_offset offset);
+    Token(TokenType type, source_offset offset, optional_token_value value);
 
     TokenType get_type() const noexcept;
-    Position get_position() const noexcept;
+    source_offset get_offset() const noexcept;
     std::string repr() const;
 
     template <typename T>
@@ -37,7 +43,7 @@ class Token {
 
    private:
     TokenType _type;
-    Position _position;
+    source_offset _offset;
     optional_token_value _value;
 
     static void _validate_token(const TokenType& type, const optional_token_value& value);
@@ -51,10 +57,14 @@ class Token {
  */
 template <typename T>
 T Token::get_value_as() const {
-    if (auto value = std::get_if<T>(&_value)) {
-        return *value;
+    if constexpr (std::same_as<T, std::string>) {
+        return std::string{get_value_as<std::string_view>()};
+    } else {
+        if (auto value = std::get_if<T>(&_value)) {
+            return *value;
+        }
+        throw InvalidGetTokenValueError(this->repr());
     }
-    throw InvalidGetTokenValueError(this->repr());
 }
 
 std::ostream& operator<<(std::ostream& os, const Token& token);
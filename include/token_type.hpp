@@ -1,5 +1,6 @@
 #ifndef TOKEN_TYPE_HPP
 #define TOKEN_TYPE_HPP
+#include <cstddef>
 #include <string>
 /**
  * @ingroup lexer
@@ -70,6 +71,8 @@ enum class TokenType {
     T_EOF,
 };
 
+constexpr std::size_t TOKEN_TYPES_COUNT{static_cast<std::size_t>(TokenType::T_EOF) + 1};
+
 std::string type_to_str(const TokenType& token_type);
 
 std::ostream& operator<<(std::ostream& os, const tkm::TokenType& token_type);
@@ -0,0 +1,98 @@
+#ifndef TRACE_EVENTS_HPP
+#define TRACE_EVENTS_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "source_handler.hpp"
+
+/**
+ * @ingroup app_core
+ * @brief Single complete ("X") event of the Chrome trace-event format.
+ */
+struct TraceEvent {
+    std::string name;
+    const char* category;
+    // microseconds since TraceEvents::origin
+    std::int64_t start_us;
+    std::int64_t duration_us;
+    // source position shown in the event's args, empty if none
+    std::string position;
+};
+
+/**
+ * @ingroup app_core
+ * @brief Timeline recording behind --trace-out.
+ *
+ * Libraries mark traced work with @ref TraceEvents::Span - function calls, loops and the app phases. Events are
+ * buffered in memory and written once, as Chrome trace JSON loadable in chrome://tracing or Perfetto. While
+ * recording is off a span costs a single check of @ref enabled.
+ */
+namespace TraceEvents {
+using clock = std::chrono::steady_clock;
+
+inline bool enabled{false};
+inline clock::time_point origin{clock::now()};
+inline std::vector<TraceEvent> events{};
+
+inline std::int64_t since_origin_us(clock::time_point time) noexcept {
+    return std::chrono::duration_cast<std::chrono::microseconds>(time - origin).count();
+}
+
+/**
+ * @brief Records an event covering its lifetime, if recording is enabled when it is created.
+ *
+ * Position of a span with a source offset is resolved only when its event is recorded.
+ */
+class Span {
+   public:
+    Span(const char* category, std::string_view name) {
+        if (not enabled) return;
+        _recording = true;
+        _category = category;
+        _name = name;
+        _start = clock::now();
+    }
+    Span(const char* category, std::string_view name, const SourceBuffer* source, source_offset offset)
+        : Span{category, name} {
+        _has_position = true;
+        _source = source;
+        _offset = offset;
+    }
+    ~Span() {
+        if (not _recording) return;
+        clock::time_point end{clock::now()};
+        events.push_back(TraceEvent{std::string{_name}, _category, since_origin_us(_start),
+                                    std::chrono::duration_cast<std::chrono::microseconds>(end - _start).count(),
+                                    _has_position ? resolve_position(_source, _offset).get_position_str()
+                                                  : std::string{}});
+    }
+    Span(const Span&) = delete;
+    Span& operator=(const Span&) = delete;
+
+   private:
+    bool _recording{false};
+    const char* _category{nullptr};
+    std::string_view _name{};
+    bool _has_position{false};
+    const SourceBuffer* _source{nullptr};
+    source_offset _offset{0};
+    clock::time_point _start{};
+};
+
+/**
+ * @brief Starts recording from an empty buffer.
+ */
+void start();
+
+/**
+ * @brief Writes recorded events as Chrome trace JSON.
+ */
+void write_json(std::ostream& os);
+}  // namespace TraceEvents
+
+#endif  // TRACE_EVENTS_HPP
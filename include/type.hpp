@@ -5,6 +5,8 @@
 #include <optional>
 #include <vector>
 
+#include "rc.hpp"
+
 /**
  * @ingroup parser
  * @brief Possible type kinds.
@@ -24,7 +26,7 @@ struct FunctionTypeInfo;
  */
 struct Type {
     TypeKind kind;
-    std::shared_ptr<FunctionTypeInfo> function_type_info = nullptr;
+    Rc<FunctionTypeInfo> function_type_info = nullptr;
 
     Type() = default;
     explicit Type(TypeKind kind);
@@ -51,10 +53,13 @@ struct VariableType {
  * @ingroup parser
  * @brief Contains function parameter types and return type.
  */
-struct FunctionTypeInfo {
+struct FunctionTypeInfo : RcCounted {
     std::vector<VariableType> param_types;
     std::optional<Type> return_type;
 
+    FunctionTypeInfo() = default;
+    FunctionTypeInfo(std::vector<VariableType> param_types, std::optional<Type> return_type = std::nullopt);
+
     std::string to_str() const;
 };
 
@@ -11,26 +11,34 @@
  */
 namespace TypeHandler {
 
-Type deduce_type(value val);
+Type deduce_type(const value& val);
 
-Type get_composed_func_type(value left, value right);
+Type get_composed_func_type(const value& left, const value& right);
 
-Type get_bind_front_func_type(sp_callable bind_target, const arg_list& args);
+Type get_bind_front_func_type(const sp_callable& bind_target, const arg_list& args);
 
-bool are_the_same_type(value lhs, value rhs);
+bool are_the_same_type(const value& lhs, const value& rhs);
 
 bool matches_return_type(const opt_vhold_or_val& ret_val, std::optional<Type> ret_type);
 
-bool args_match_params(const arg_list& args, std::vector<VariableType> param_types);
+bool args_match_params(const arg_list& args, const std::vector<VariableType>& param_types);
 
-bool arg_matches_param(vhold_or_val argument, VariableType param_type);
+bool arg_matches_param(const vhold_or_val& argument, const VariableType& param_type);
 
 vhold_or_val opt_value_to_arg(const opt_vhold_or_val& maybe_val_or_holder);
 
+vhold_or_val opt_value_to_arg(opt_vhold_or_val&& maybe_val_or_holder);
+
 value extract_value(const opt_vhold_or_val& maybe_val_or_holder);
 
 value extract_value(const vhold_or_val& val_or_holder);
 
+// moves the value out if it is an rvalue, copies the variable's value otherwise
+value extract_value(opt_vhold_or_val&& maybe_val_or_holder);
+
+// reference to the value itself or to the value of held variable - no copy
+const value& value_ref(const vhold_or_val& val_or_holder);
+
 bool ret_type_matches_param_type(std::optional<Type> ret_type, VariableType param_type);
 
 std::string get_type_string(std::optional<Type> opt_type);
@@ -43,7 +51,7 @@ std::string get_types_string(const arg_list& args);
 
 std::string get_types_string(const std::vector<VariableType> params);
 
-std::optional<value> as_type(Type type, value val);
+std::optional<value> as_type(const Type& type, const value& val);
 
 std::optional<value> as_int(const value& val);
 
@@ -95,7 +103,7 @@ T get_value_as(const vhold_or_val& argument) {
 }
 
 template <typename T>
-T get_value_as(opt_vhold_or_val opt_v_or_vh) {
+T get_value_as(const opt_vhold_or_val& opt_v_or_vh) {
     if (not opt_v_or_vh) {
         throw ImplementationError("get value as should never be called without checking if its none");
     }
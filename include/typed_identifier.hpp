@@ -3,6 +3,7 @@
 #include <string>
 
 #include "node.hpp"
+#include "symbol.hpp"
 #include "type.hpp"
 
 /**
@@ -11,8 +12,9 @@
  */
 struct TypedIdentifier : public Node {
     std::string name;
+    symbol_id symbol;
     VariableType type;
-    explicit TypedIdentifier(const Position& position, std::string name, VariableType type);
+    explicit TypedIdentifier(source_offset offset, std::string name, VariableType type);
 
     void accept(Visitor& visitor) const override;
 };
@@ -3,23 +3,35 @@
 #include <variant>
 
 #include "exceptions.hpp"
+#include "int_value.hpp"
+#include "small_vector.hpp"
+#include "string_value.hpp"
 #include "type.hpp"
 
 class Callable;
-using sp_callable = std::shared_ptr<Callable>;
+// counting defined in callable.cpp - handles are copied in places where Callable is incomplete
+template <>
+struct RcTraits<Callable> {
+    static void retain(Callable* callable) noexcept;
+    static void release(Callable* callable) noexcept;
+    static std::uint32_t count(const Callable* callable) noexcept;
+};
+using sp_callable = Rc<Callable>;
 
-using value = std::variant<int, double, bool, std::string, sp_callable>;
+using value = std::variant<int_value, double, bool, StringValue, sp_callable>;
 
 /**
  * @ingroup interpreter
  * @brief Variable representation - type and value.
  */
-struct Variable {
+struct Variable : RcCounted {
     VariableType type;
     value var_value;
+
+    Variable(VariableType type, value var_value);
 };
 
-using sp_variable = std::shared_ptr<Variable>;
+using sp_variable = Rc<Variable>;
 
 /**
  * @ingroup interpreter
@@ -40,7 +52,9 @@ struct VariableHolder {
 // to represent variable value
 // argument can be variable reference or rvalue -> to let variables be modified inside other functions
 using vhold_or_val = std::variant<VariableHolder, value>;
-using arg_list = std::vector<vhold_or_val>;
+// calls rarely take more arguments - lists up to this size are assembled without allocating
+constexpr std::size_t INLINE_ARGS_CAPACITY{4};
+using arg_list = SmallVector<vhold_or_val, INLINE_ARGS_CAPACITY>;
 // contains value, reference to variable or nothing
 using opt_vhold_or_val = std::optional<vhold_or_val>;
 
@@ -1,25 +1,146 @@
 #include "cli_app.hpp"
 
+#include <spdlog/spdlog.h>
+
 #include <boost/program_options.hpp>
+#include <chrono>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <sstream>
+#include <thread>
 
+#include "hot_spots.hpp"
+#include "incremental_parser.hpp"
+#include "instrumented_interpreter.hpp"
 #include "interpreter.hpp"
 #include "lexer.hpp"
 #include "logging_lexer.hpp"
+#include "mem_stats.hpp"
 #include "parser.hpp"
+#include "safe_exec.hpp"
+#include "sampling_profiler.hpp"
+#include "trace_events.hpp"
 #include "verbose_parser.hpp"
 
 namespace p_opt = boost::program_options;
 
-CLIApp::CLIApp(int argc, char* const argv[]) : _use_stdin{false}, _verbose{false}, _interpreter{} {
+namespace {
+constexpr std::chrono::milliseconds WATCH_POLL_INTERVAL{200};
+
+std::string read_file(const std::string& filename) {
+    std::ifstream file_stream{filename, std::ios::in};
+    if (!file_stream.is_open()) throw FileOpenException(filename);
+    std::ostringstream content;
+    content << file_stream.rdbuf();
+    return content.str();
+}
+
+// records trace events during its lifetime and writes them to the file on exit, also when the run fails
+class TraceFileWriter {
+   public:
+    explicit TraceFileWriter(const std::string& filename) : _filename{filename} {
+        if (not _filename.empty()) TraceEvents::start();
+    }
+    ~TraceFileWriter() {
+        if (_filename.empty()) return;
+        TraceEvents::enabled = false;
+        std::ofstream file{_filename, std::ios::out | std::ios::trunc};
+        if (not file.is_open()) {
+            spdlog::error("could not write trace to {}", _filename);
+            return;
+        }
+        TraceEvents::write_json(file);
+    }
+    TraceFileWriter(const TraceFileWriter&) = delete;
+    TraceFileWriter& operator=(const TraceFileWriter&) = delete;
+
+   private:
+    const std::string& _filename;
+};
+
+// samples function stacks during its lifetime and writes them folded to the file on exit, also when the run fails
+class SampleFileWriter {
+   public:
+    SampleFileWriter(const std::string& filename, int interval_us) : _filename{filename} {
+        if (_filename.empty()) return;
+        if (not SamplingProfiler::start(std::chrono::microseconds{interval_us})) {
+            spdlog::error("could not start sampling profiler");
+        }
+    }
+    ~SampleFileWriter() {
+        if (_filename.empty()) return;
+        SamplingProfiler::stop();
+        std::ofstream file{_filename, std::ios::out | std::ios::trunc};
+        if (not file.is_open()) {
+            spdlog::error("could not write samples to {}", _filename);
+            return;
+        }
+        SamplingProfiler::write_folded(file);
+        if (std::size_t dropped = SamplingProfiler::dropped_samples()) {
+            spdlog::warn("sample buffer full, {} samples dropped", dropped);
+        }
+    }
+    SampleFileWriter(const SampleFileWriter&) = delete;
+    SampleFileWriter& operator=(const SampleFileWriter&) = delete;
+
+   private:
+    const std::string& _filename;
+};
+}  // namespace
+
+CLIApp::CLIApp(int argc, char* const argv[])
+    : _use_stdin{false},
+      _verbose{false},
+      _watch{false},
+      _mem_stats{false},
+      _trace{false},
+      _profile{false},
+      _count_nodes{false},
+      _hot_spots{false},
+      _sample_interval_us{0} {
     _parse_args(argc, argv);
     _initialize_components();
 }
 
 void CLIApp::run() {
-    std::unique_ptr<Program> program = _parser->parse_program();
-    program->accept(_interpreter);
+    if (_watch) return _watch_input();
+    TraceFileWriter trace_writer{_trace_out_filename};
+    std::unique_ptr<Program> program{};
+    {
+        TraceEvents::Span trace_span{"phase", "lex and parse"};
+        program = _parser->parse_program();
+    }
+    {
+        TraceEvents::Span trace_span{"phase", "run"};
+        SampleFileWriter sample_writer{_sample_out_filename, _sample_interval_us};
+        _run_program(*program);
+    }
+    if (_mem_stats) MemStats::print_report(std::cerr);
+}
+
+void CLIApp::_run_program(const Program& program) {
+    if (_trace) {
+        InstrumentedInterpreter<TracingPolicy> interpreter{TracingPolicy{std::cerr}};
+        program.accept(interpreter);
+    } else if (_profile) {
+        InstrumentedInterpreter<TimingPolicy> interpreter{};
+        program.accept(interpreter);
+        interpreter.get_policy().report(std::cerr);
+    } else if (_count_nodes) {
+        InstrumentedInterpreter<CountingPolicy> interpreter{};
+        program.accept(interpreter);
+        interpreter.get_policy().report(std::cerr);
+    } else if (_hot_spots) {
+        InstrumentedInterpreter<HitCountingPolicy> interpreter{};
+        program.accept(interpreter);
+        HotSpotReport report{interpreter.get_policy()};
+        program.accept(report);
+        report.print(std::cerr);
+    } else {
+        Interpreter interpreter{};
+        program.accept(interpreter);
+    }
 }
 
 void CLIApp::_parse_args(int argc, char* const argv[]) {
@@ -31,6 +152,16 @@ void CLIApp::_parse_args(int argc, char* const argv[]) {
         ("help,h", "display help info")
         ("stdin,s", p_opt::bool_switch(&_use_stdin), "read data from standard input")
         ("verbose,v", p_opt::bool_switch(&_verbose), "enable verbosity")
+        ("watch,w", p_opt::bool_switch(&_watch), "rerun the input file whenever it changes")
+        ("mem-stats", p_opt::bool_switch(&_mem_stats), "print allocation counts and peak memory after the run")
+        ("trace", p_opt::bool_switch(&_trace), "print every executed node to standard error")
+        ("profile", p_opt::bool_switch(&_profile), "print execution time per node kind after the run")
+        ("count-nodes", p_opt::bool_switch(&_count_nodes), "print execution count per node kind after the run")
+        ("hot-spots", p_opt::bool_switch(&_hot_spots), "print source annotated with execution counts after the run")
+        ("trace-out", p_opt::value<std::string>(&_trace_out_filename), "write Chrome trace JSON of the run to file")
+        ("sample-out", p_opt::value<std::string>(&_sample_out_filename), "write sampled function stacks folded to file")
+        ("sample-interval", p_opt::value<int>(&_sample_interval_us)->default_value(1000),
+            "CPU time between samples in microseconds")
         ("input", p_opt::value<std::string>(&_input_filename), "input filename");  // clang-format on
 
     p.add("input", 1);
@@ -43,9 +174,22 @@ void CLIApp::_parse_args(int argc, char* const argv[]) {
         std::cout << "usage: ./tkm_interpreter [file] [options]\n" << desc << "\n";
         exit(0);
     }
+    if (_watch and _use_stdin) {
+        std::cout << "watch mode requires an input file\n";
+        exit(1);
+    }
+    if (int(_trace) + int(_profile) + int(_count_nodes) + int(_hot_spots) > 1) {
+        std::cout << "only one of --trace, --profile, --count-nodes and --hot-spots can be used\n";
+        exit(1);
+    }
+    if (_sample_interval_us <= 0) {
+        std::cout << "sample interval has to be positive\n";
+        exit(1);
+    }
 }
 
 void CLIApp::_initialize_components() {
+    if (_watch) return;
     std::unique_ptr<std::istream> input_stream;
     if (_use_stdin) {
         input_stream = std::make_unique<std::istream>(std::cin.rdbuf());
@@ -66,4 +210,35 @@ void CLIApp::_initialize_components() {
     if (_verbose) {
         _parser = std::make_unique<VerboseParser>(std::move(_parser));
     }
-}
\ No newline at end of file
+}
+void CLIApp::_watch_input() {
+    std::unique_ptr<IncrementalParser> parser;
+    std::filesystem::file_time_type last_write{};
+    while (true) {
+        std::error_code error;
+        auto write_time = std::filesystem::last_write_time(_input_filename, error);
+        if (error or write_time == last_write) {
+            std::this_thread::sleep_for(WATCH_POLL_INTERVAL);
+            continue;
+        }
+        last_write = write_time;
+
+        safe_exec::run_safe([this, &parser]() {
+            TraceFileWriter trace_writer{_trace_out_filename};
+            std::string text{read_file(_input_filename)};
+            {
+                TraceEvents::Span trace_span{"phase", "lex and parse"};
+                if (not parser) {
+                    parser = std::make_unique<IncrementalParser>(std::move(text));
+                } else {
+                    parser->apply_edit(TextEdit::diff(parser->get_text(), text));
+                }
+            }
+            TraceEvents::Span trace_span{"phase", "run"};
+            SampleFileWriter sample_writer{_sample_out_filename, _sample_interval_us};
+            _run_program(parser->get_program());
+        });
+        if (_mem_stats) MemStats::print_report(std::cerr);
+        spdlog::info("waiting for changes in {}", _input_filename);
+    }
+}
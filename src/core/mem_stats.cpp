@@ -0,0 +1,57 @@
+#include "mem_stats.hpp"
+
+#include <sys/resource.h>
+
+#include <iomanip>
+#include <ostream>
+
+namespace MemStats {
+namespace {
+void print_row(std::ostream& os, const char* name, const MemCounters& row) {
+    os << "  " << std::left << std::setw(13) << name << std::right << std::setw(12) << row.allocations
+       << std::setw(12) << row.deallocations << std::setw(16) << row.bytes_allocated << std::setw(16)
+       << row.peak_live_bytes << "\n";
+}
+}  // namespace
+
+const char* subsystem_name(MemSubsystem subsystem) {
+    switch (subsystem) {
+        case MemSubsystem::OTHER:
+            return "other";
+        case MemSubsystem::LEXER:
+            return "lexer";
+        case MemSubsystem::PARSER:
+            return "parser";
+        case MemSubsystem::ENVIRONMENT:
+            return "environment";
+        case MemSubsystem::VALUES:
+            return "values";
+        case MemSubsystem::CALLABLES:
+            return "callables";
+        default:
+            return "unknown";
+    }
+}
+
+std::size_t peak_rss_kb() {
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+    // linux reports kilobytes
+    return static_cast<std::size_t>(usage.ru_maxrss);
+}
+
+void print_report(std::ostream& os) {
+    os << "memory stats:\n";
+    if (hook_installed) {
+        os << "  " << std::left << std::setw(13) << "subsystem" << std::right << std::setw(12) << "allocs"
+           << std::setw(12) << "frees" << std::setw(16) << "bytes" << std::setw(16) << "peak live" << "\n";
+        for (std::size_t i = 0; i < counters.size(); ++i) {
+            print_row(os, subsystem_name(static_cast<MemSubsystem>(i)), counters[i]);
+        }
+        print_row(os, "total", total);
+    } else {
+        os << "  allocation counters unavailable - built without MEM_STATS_HOOK\n";
+    }
+    os << "  peak RSS: " << peak_rss_kb() << " kB\n";
+}
+}  // namespace MemStats
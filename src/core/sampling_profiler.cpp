@@ -0,0 +1,94 @@
+#include "sampling_profiler.hpp"
+
+#include <signal.h>
+#include <sys/time.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+
+#include "statement.hpp"
+
+namespace SamplingProfiler {
+namespace {
+// samples are stored one after another as: depth, frames... - enough for minutes of typical stacks at 1 kHz
+constexpr std::size_t BUFFER_SLOTS{1 << 20};
+
+std::unique_ptr<std::uintptr_t[]> buffer{};
+std::atomic<std::size_t> used_slots{0};
+std::atomic<std::size_t> dropped{0};
+struct sigaction previous_action{};
+bool running{false};
+
+void on_sample(int) {
+    std::size_t depth{shadow_depth.load(std::memory_order_relaxed)};
+    std::atomic_signal_fence(std::memory_order_acquire);
+    std::size_t stored_depth{std::min(depth, MAX_STACK_DEPTH)};
+
+    std::size_t used{used_slots.load(std::memory_order_relaxed)};
+    if (used + stored_depth + 1 > BUFFER_SLOTS) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    buffer[used] = stored_depth;
+    for (std::size_t i = 0; i < stored_depth; ++i) {
+        buffer[used + 1 + i] = reinterpret_cast<std::uintptr_t>(shadow_stack[i]);
+    }
+    used_slots.store(used + stored_depth + 1, std::memory_order_relaxed);
+}
+}  // namespace
+
+bool start(std::chrono::microseconds interval) {
+    if (running) stop();
+    if (not buffer) buffer = std::make_unique<std::uintptr_t[]>(BUFFER_SLOTS);
+    used_slots = 0;
+    dropped = 0;
+
+    struct sigaction action{};
+    action.sa_handler = on_sample;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGPROF, &action, &previous_action) != 0) return false;
+
+    itimerval timer{};
+    timer.it_interval.tv_sec = static_cast<time_t>(interval.count() / 1'000'000);
+    timer.it_interval.tv_usec = static_cast<suseconds_t>(interval.count() % 1'000'000);
+    timer.it_value = timer.it_interval;
+    if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+        sigaction(SIGPROF, &previous_action, nullptr);
+        return false;
+    }
+    running = true;
+    return true;
+}
+
+void stop() {
+    if (not running) return;
+    itimerval timer{};
+    setitimer(ITIMER_PROF, &timer, nullptr);
+    sigaction(SIGPROF, &previous_action, nullptr);
+    running = false;
+}
+
+std::size_t dropped_samples() {
+    return dropped.load(std::memory_order_relaxed);
+}
+
+void write_folded(std::ostream& os) {
+    std::map<std::string, std::size_t> folded{};
+    std::size_t used{used_slots.load(std::memory_order_relaxed)};
+    for (std::size_t slot = 0; slot < used;) {
+        std::size_t depth{buffer[slot++]};
+        std::string stack{};
+        for (std::size_t i = 0; i < depth; ++i) {
+            auto function{reinterpret_cast<const FunctionDefinition*>(buffer[slot++])};
+            if (i != 0) stack += ';';
+            stack += function->signature->identifier;
+        }
+        ++folded[depth == 0 ? "(no function)" : stack];
+    }
+    for (const auto& [stack, count] : folded) os << stack << " " << count << "\n";
+}
+}  // namespace SamplingProfiler
@@ -0,0 +1,54 @@
+#include "trace_events.hpp"
+
+#include <ostream>
+
+namespace TraceEvents {
+namespace {
+void write_escaped(std::ostream& os, std::string_view text) {
+    os << '"';
+    for (char character : text) {
+        switch (character) {
+            case '"':
+                os << "\\\"";
+                break;
+            case '\\':
+                os << "\\\\";
+                break;
+            case '\n':
+                os << "\\n";
+                break;
+            case '\t':
+                os << "\\t";
+                break;
+            default:
+                os << character;
+        }
+    }
+    os << '"';
+}
+}  // namespace
+
+void start() {
+    events.clear();
+    origin = clock::now();
+    enabled = true;
+}
+
+void write_json(std::ostream& os) {
+    os << "{\"traceEvents\":[";
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        const TraceEvent& event{events[i]};
+        os << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+        write_escaped(os, event.name);
+        os << ",\"cat\":\"" << event.category << "\",\"ph\":\"X\",\"ts\":" << event.start_us
+           << ",\"dur\":" << event.duration_us << ",\"pid\":1,\"tid\":1";
+        if (not event.position.empty()) {
+            os << ",\"args\":{\"at\":";
+            write_escaped(os, event.position);
+            os << "}";
+        }
+        os << "}";
+    }
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+}  // namespace TraceEvents
@@ -14,6 +14,8 @@ LexerException::LexerException(const std::string& message) : std::runtime_error(
 FileOpenException::FileOpenException(const std::string& filename)
     : std::runtime_error("Failed to open file: " + filename) {}
 
+SourceTooLargeException::SourceTooLargeException() : LexerException("Source exceeds maximal supported size") {}
+
 InvalidTokenValueError::InvalidTokenValueError(const TokenType& type)
     : ImplementationError(std::string{"Invalid token value for"} + type_to_str(type)) {}
 
@@ -1,14 +1,41 @@
 #include "bind_front_function.hpp"
 
+#include "mem_stats.hpp"
+#include "trace_events.hpp"
+
 BindFrontFunction::BindFrontFunction(Type type, sp_callable bind_target, arg_list bind_args)
-    : _type{type}, _target_func{bind_target}, _bound_args{bind_args} {}
+    : _type{std::move(type)}, _target_func{std::move(bind_target)}, _bound_args{std::move(bind_args)} {}
+
+sp_callable BindFrontFunction::bind(Type type, const sp_callable& bind_target, arg_list bind_args) {
+    auto bound = dynamic_cast<const BindFrontFunction*>(bind_target.get());
+    if (not bound) return make_rc<BindFrontFunction>(std::move(type), bind_target, std::move(bind_args));
+
+    arg_list merged_args{bound->_bound_args};
+    for (auto& argument : bind_args) merged_args.push_back(std::move(argument));
+    return make_rc<BindFrontFunction>(std::move(type), bound->_target_func, std::move(merged_args));
+}
 
-void BindFrontFunction::call(Interpreter& interpreter, arg_list call_args) {
-    arg_list all_args{_bound_args};
-    all_args.insert(all_args.end(), call_args.begin(), call_args.end());
-    _target_func->call(interpreter, all_args);
+void BindFrontFunction::call(Interpreter& interpreter, arg_list&& call_args) {
+    TraceEvents::Span trace_span{"call", "bound function"};
+    // inline buffer - allocates only when more arguments than INLINE_ARGS_CAPACITY are passed
+    arg_list all_args{};
+    {
+        MemStats::SubsystemScope mem_scope{MemSubsystem::CALLABLES};
+        all_args.reserve(_bound_args.size() + call_args.size());
+        for (const auto& argument : _bound_args) all_args.push_back(argument);
+        for (auto& argument : call_args) all_args.push_back(std::move(argument));
+    }
+    _target_func->call(interpreter, std::move(all_args));
 }
 
 Type BindFrontFunction::get_type() const {
     return _type;
+}
+
+const sp_callable& BindFrontFunction::get_target() const {
+    return _target_func;
+}
+
+const arg_list& BindFrontFunction::get_bound_args() const {
+    return _bound_args;
 }
\ No newline at end of file
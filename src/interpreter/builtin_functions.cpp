@@ -4,14 +4,17 @@
 
 #include "builtint_functions.hpp"
 #include "interpreter.hpp"
+#include "trace_events.hpp"
 #include "type_handler.hpp"
 
-BuiltinFunction::BuiltinFunction(Type type, function_impl impl) : _type{type}, _impl{impl} {}
+BuiltinFunction::BuiltinFunction(Type type, function_impl impl, std::string name)
+    : _type{std::move(type)}, _impl{std::move(impl)}, _name{std::move(name)} {}
 
-void BuiltinFunction::call(Interpreter& interpreter, arg_list call_args) {
+void BuiltinFunction::call(Interpreter& interpreter, arg_list&& call_args) {
+    TraceEvents::Span trace_span{"call", _name};
     auto opt_val = _impl(interpreter, call_args);
     if (opt_val)
-        interpreter._tmp_result = opt_val.value();
+        interpreter._tmp_result = std::move(opt_val.value());
     else
         interpreter._tmp_result = std::nullopt;
 }
@@ -27,8 +30,8 @@ const Type _print_type{
 // comment for _impls interpreter already checked if arg_list matches taken params - here we have:
 // string value or variable holder(values passed as references) of string type
 
-function_impl _print_impl = [](Interpreter& interpreter, arg_list args) -> std::optional<value> {
-    std::cout << TypeHandler::get_value_as<std::string>(args[0]) << std::endl;
+function_impl _print_impl = [](Interpreter& interpreter, const arg_list& args) -> std::optional<value> {
+    std::cout << TypeHandler::get_value_as<StringValue>(args[0]) << std::endl;
     return std::nullopt;
 };
 
@@ -38,9 +41,9 @@ const Type _round_type{FunctionTypeInfo{std::vector<VariableType>{
                                         },
                                         Type{TypeKind::FLOAT}}};
 
-function_impl _round_impl = [](Interpreter& interpreter, arg_list args) -> std::optional<value> {
+function_impl _round_impl = [](Interpreter& interpreter, const arg_list& args) -> std::optional<value> {
     double to_roud{TypeHandler::get_value_as<double>(args[0])};
-    int precision{TypeHandler::get_value_as<int>(args[1])};
+    int_value precision{TypeHandler::get_value_as<int_value>(args[1])};
 
     double factor = std::pow(10.0, precision);
     return (std::round(to_roud * factor)) / factor;
@@ -48,7 +51,7 @@ function_impl _round_impl = [](Interpreter& interpreter, arg_list args) -> std::
 
 const Type _input_type{FunctionTypeInfo{{}, Type{TypeKind::STRING}}};
 
-function_impl _input_impl = [](Interpreter& interpreter, arg_list args) -> std::optional<value> {
+function_impl _input_impl = [](Interpreter& interpreter, const arg_list& args) -> std::optional<value> {
     std::string line;
     std::getline(std::cin, line);
     return line;
@@ -58,8 +61,8 @@ const Type _is_int_type{FunctionTypeInfo{std::vector<VariableType>{
                                          },
                                          Type{TypeKind::BOOL}}};
 
-function_impl _is_int_impl = [](Interpreter& interpreter, arg_list args) -> std::optional<value> {
-    return TypeHandler::as_int(TypeHandler::extract_value(args[0])).has_value();
+function_impl _is_int_impl = [](Interpreter& interpreter, const arg_list& args) -> std::optional<value> {
+    return TypeHandler::as_int(TypeHandler::value_ref(args[0])).has_value();
 };
 
 const Type _is_float_type{FunctionTypeInfo{std::vector<VariableType>{
@@ -67,8 +70,8 @@ const Type _is_float_type{FunctionTypeInfo{std::vector<VariableType>{
                                            },
                                            Type{TypeKind::BOOL}}};
 
-function_impl _is_float_impl = [](Interpreter& interpreter, arg_list args) -> std::optional<value> {
-    return TypeHandler::as_float(TypeHandler::extract_value(args[0])).has_value();
+function_impl _is_float_impl = [](Interpreter& interpreter, const arg_list& args) -> std::optional<value> {
+    return TypeHandler::as_float(TypeHandler::value_ref(args[0])).has_value();
 };
 
 const Type _lower_type{FunctionTypeInfo{std::vector<VariableType>{
@@ -76,8 +79,8 @@ const Type _lower_type{FunctionTypeInfo{std::vector<VariableType>{
                                         },
                                         Type{TypeKind::STRING}}};
 
-function_impl _lower_impl = [](Interpreter& interpreter, arg_list args) -> std::optional<value> {
-    std::string s = TypeHandler::get_value_as<std::string>(args[0]);
+function_impl _lower_impl = [](Interpreter& interpreter, const arg_list& args) -> std::optional<value> {
+    std::string s{TypeHandler::get_value_as<StringValue>(args[0]).str()};
     std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return std::tolower(c); });
     return s;
 };
@@ -87,8 +90,8 @@ const Type _upper_type{FunctionTypeInfo{std::vector<VariableType>{
                                         },
                                         Type{TypeKind::STRING}}};
 
-function_impl _upper_impl = [](Interpreter& interpreter, arg_list args) -> std::optional<value> {
-    std::string s = TypeHandler::get_value_as<std::string>(args[0]);
+function_impl _upper_impl = [](Interpreter& interpreter, const arg_list& args) -> std::optional<value> {
+    std::string s{TypeHandler::get_value_as<StringValue>(args[0]).str()};
     std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return std::toupper(c); });
     return s;
 };
@@ -98,8 +101,8 @@ const Type _capitalized_type{FunctionTypeInfo{std::vector<VariableType>{
                                               },
                                               Type{TypeKind::STRING}}};
 
-function_impl _capitalized_impl = [](Interpreter& interpreter, arg_list args) -> std::optional<value> {
-    std::string s = TypeHandler::get_value_as<std::string>(args[0]);
+function_impl _capitalized_impl = [](Interpreter& interpreter, const arg_list& args) -> std::optional<value> {
+    std::string s{TypeHandler::get_value_as<StringValue>(args[0]).str()};
     if (!s.empty()) {
         s[0] = std::toupper(static_cast<unsigned char>(s[0]));
         std::transform(s.begin() + 1, s.end(), s.begin() + 1, [](unsigned char c) { return std::tolower(c); });
@@ -1,26 +1,33 @@
 #include "call_frame.hpp"
 
+#include <ranges>
+
+CallFrame::CallFrame(std::optional<Type> return_type, std::pmr::memory_resource* resource)
+    : _scopes{resource}, _return_type{std::move(return_type)} {
+    _scopes.emplace_back(resource);
+}
+
 void CallFrame::push_scope() {
-    _scopes.push_front(Scope{});
+    _scopes.emplace_back(_scopes.get_allocator().resource());
 }
 
 void CallFrame::pop_scope() {
-    _scopes.pop_front();
+    _scopes.pop_back();
 }
 
-void CallFrame::add_variable(std::string identifier, VariableHolder variable) {
-    _scopes.front().add_variable(identifier, variable);
+void CallFrame::add_variable(symbol_id identifier, VariableHolder variable) {
+    _scopes.back().add_variable(identifier, std::move(variable));
 }
 
-std::optional<VariableHolder> CallFrame::find_variable(const std::string& identifier) {
-    for (auto& scope : _scopes) {
+std::optional<VariableHolder> CallFrame::find_variable(symbol_id identifier) {
+    for (auto& scope : _scopes | std::views::reverse) {
         if (auto var = scope.get_variable(identifier)) return var;
     }
     return std::nullopt;
 }
 
-bool CallFrame::is_in_current_scope(const std::string& identifier) {
-    return _scopes.front().contains_variable(identifier);
+bool CallFrame::is_in_current_scope(symbol_id identifier) {
+    return _scopes.back().contains_variable(identifier);
 }
 
 std::optional<Type> CallFrame::get_ret_type() const {
@@ -1,5 +1,17 @@
 #include "callable.hpp"
 
+void RcTraits<Callable>::retain(Callable* callable) noexcept {
+    ++static_cast<RcCounted*>(callable)->_rc_count;
+}
+
+void RcTraits<Callable>::release(Callable* callable) noexcept {
+    if (--static_cast<RcCounted*>(callable)->_rc_count == 0) delete callable;
+}
+
+std::uint32_t RcTraits<Callable>::count(const Callable* callable) noexcept {
+    return static_cast<const RcCounted*>(callable)->_rc_count;
+}
+
 std::ostream& operator<<(std::ostream& os, const Callable& callable) {
     os << std::format("Callable - {}]", callable.get_type().to_str());
     return os;
@@ -1,23 +1,50 @@
 #include "composed_function.hpp"
 
 #include "interpreter.hpp"
+#include "trace_events.hpp"
 #include "type_handler.hpp"
 
-ComposedFunction::ComposedFunction(Type type, sp_callable first, sp_callable second)
-    : _type{type}, _first_func{first}, _second_func{second} {}
+namespace {
+void append_stages(std::vector<sp_callable>& stages, const sp_callable& callable) {
+    if (auto composed = dynamic_cast<const ComposedFunction*>(callable.get())) {
+        stages.insert(stages.end(), composed->get_stages().begin(), composed->get_stages().end());
+    } else {
+        stages.push_back(callable);
+    }
+}
+}  // namespace
+
+ComposedFunction::ComposedFunction(Type type, std::vector<sp_callable> stages)
+    : _type{std::move(type)}, _stages{std::move(stages)} {}
+
+sp_callable ComposedFunction::compose(Type type, const sp_callable& first, const sp_callable& second) {
+    std::vector<sp_callable> stages{};
+    append_stages(stages, first);
+    append_stages(stages, second);
+    return make_rc<ComposedFunction>(std::move(type), std::move(stages));
+}
 
 Type ComposedFunction::get_type() const {
     return _type;
 }
 
-void ComposedFunction::call(Interpreter& interpreter, arg_list call_args) {
-    interpreter._env.calling_function(_first_func->get_type().function_type_info->return_type);
-    _first_func->call(interpreter, call_args);
-    interpreter._env.exiting_function();
+const std::vector<sp_callable>& ComposedFunction::get_stages() const {
+    return _stages;
+}
 
-    arg_list second_func_args = {TypeHandler::opt_value_to_arg(interpreter._tmp_result)};
-    interpreter._clear_tmp_result();
-    interpreter._env.calling_function(_second_func->get_type().function_type_info->return_type);
-    _second_func->call(interpreter, second_func_args);
-    interpreter._env.exiting_function();
-}
\ No newline at end of file
+void ComposedFunction::call(Interpreter& interpreter, arg_list&& call_args) {
+    TraceEvents::Span trace_span{"call", "composed function"};
+    for (std::size_t i = 0; i < _stages.size(); ++i) {
+        if (i != 0) {
+            // previous stage result becomes the only argument - buffer keeps its capacity
+            call_args.clear();
+            call_args.push_back(TypeHandler::opt_value_to_arg(std::move(interpreter._tmp_result)));
+            interpreter._clear_tmp_result();
+        }
+        const sp_callable& stage{_stages[i]};
+        interpreter._env.calling_function(stage->get_type().function_type_info->return_type);
+        stage->call(interpreter, std::move(call_args));
+        // also ends the stage's return - next stage body has to run in full
+        interpreter._handle_function_call_end();
+    }
+}
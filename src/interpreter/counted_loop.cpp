@@ -0,0 +1,70 @@
+#include "counted_loop.hpp"
+
+#include <algorithm>
+
+namespace {
+const Identifier* as_identifier(const up_expression& expr, symbol_id symbol) {
+    auto identifier{dynamic_cast<const Identifier*>(expr.get())};
+    return identifier and identifier->symbol == symbol ? identifier : nullptr;
+}
+
+// conservative - assignment anywhere in the body counts, even to a shadowing variable
+bool assigns_to(const Statement* statement, symbol_id symbol) {
+    if (not statement) return false;
+    if (auto assignment = dynamic_cast<const AssignStatement*>(statement)) {
+        return assignment->symbol == symbol;
+    }
+    if (auto code_block = dynamic_cast<const CodeBlock*>(statement)) {
+        return std::ranges::any_of(code_block->statements,
+                                   [symbol](const auto& inner) { return assigns_to(inner.get(), symbol); });
+    }
+    if (auto if_stmnt = dynamic_cast<const IfStatement*>(statement)) {
+        return assigns_to(if_stmnt->body.get(), symbol) or assigns_to(if_stmnt->else_body.get(), symbol) or
+               std::ranges::any_of(if_stmnt->else_ifs,
+                                   [symbol](const auto& else_if) { return assigns_to(else_if->body.get(), symbol); });
+    }
+    if (auto for_loop = dynamic_cast<const ForLoop*>(statement)) {
+        return assigns_to(for_loop->loop_update.get(), symbol) or assigns_to(for_loop->body.get(), symbol);
+    }
+    return false;
+}
+}  // namespace
+
+CountedLoop CountedLoop::match(const ForLoop& for_loop) {
+    CountedLoop counted{};
+
+    auto var_decl{dynamic_cast<const VariableDeclaration*>(for_loop.var_declaration.get())};
+    if (not var_decl or var_decl->typed_identifier->type.type != Type{TypeKind::INT}) return counted;
+    counted.counter = var_decl->typed_identifier->symbol;
+
+    auto condition{dynamic_cast<const BinaryExpression*>(for_loop.condition.get())};
+    if (not condition or not as_identifier(condition->left, counted.counter)) return counted;
+    switch (condition->kind) {
+        case ExprKind::LESS:
+        case ExprKind::LESS_EQUAL:
+        case ExprKind::GREATER:
+        case ExprKind::GREATER_EQUAL:
+            counted.comparison = condition->kind;
+            break;
+        default:
+            return counted;
+    }
+    if (auto literal = dynamic_cast<const LiteralInt*>(condition->right.get())) {
+        counted.bound_literal = literal->value;
+    } else if (not(counted.bound_variable = dynamic_cast<const Identifier*>(condition->right.get()))) {
+        return counted;
+    }
+
+    auto update{dynamic_cast<const AssignStatement*>(for_loop.loop_update.get())};
+    if (not update or update->symbol != counted.counter) return counted;
+    auto step_expr{dynamic_cast<const BinaryExpression*>(update->expr.get())};
+    if (not step_expr or not as_identifier(step_expr->left, counted.counter)) return counted;
+    if (step_expr->kind != ExprKind::ADDITION and step_expr->kind != ExprKind::SUBTRACTION) return counted;
+    auto step{dynamic_cast<const LiteralInt*>(step_expr->right.get())};
+    if (not step) return counted;
+    counted.step_kind = step_expr->kind;
+    counted.step = step->value;
+
+    counted.matches = not assigns_to(for_loop.body.get(), counted.counter);
+    return counted;
+}
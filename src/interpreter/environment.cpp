@@ -4,36 +4,42 @@
 
 #include "builtint_functions.hpp"
 #include "global_function.hpp"
+#include "mem_stats.hpp"
 #include "statement.hpp"
 
-Environment::Environment() : _call_frames{} {
+Environment::Environment() : _pool{}, _functions{}, _call_frames{std::pmr::vector<CallFrame>{&_pool}} {
     // Initialize built-in functions
     std::for_each(Builtins::builtin_function_infos.begin(), Builtins::builtin_function_infos.end(),
                   [this](auto& builtin_info) {
-                      this->_functions[builtin_info.identifier] =
-                          std::make_shared<BuiltinFunction>(builtin_info.type, builtin_info.impl);
+                      this->_functions[Symbols::intern(builtin_info.identifier)] =
+                          make_rc<BuiltinFunction>(builtin_info.type, builtin_info.impl, builtin_info.identifier);
                   });
 }
 
-void Environment::register_function(const FunctionDefinition& function) {
-    std::string identifier{function.signature->identifier};
+bool Environment::register_function(const FunctionDefinition& function) {
+    MemStats::SubsystemScope mem_scope{MemSubsystem::ENVIRONMENT};
+    symbol_id identifier{Symbols::intern(function.signature->identifier)};
     if (_functions.contains(identifier)) {
-        throw AlreadyDefinedException(identifier, function.position);
+        return false;
     }
-    _functions[identifier] = std::make_shared<GlobalFunction>(function);
+    _functions[identifier] = make_rc<GlobalFunction>(function);
+    return true;
 }
 
-void Environment::declare_variable(std::string identifier, VariableHolder var_holder) {
-    _call_frames.top().add_variable(identifier, var_holder);
+void Environment::declare_variable(symbol_id identifier, VariableHolder var_holder) {
+    MemStats::SubsystemScope mem_scope{MemSubsystem::ENVIRONMENT};
+    _call_frames.top().add_variable(identifier, std::move(var_holder));
 }
 
-void Environment::declare_variable(std::string identifier, VariableType var_type, value var_value) {
-    sp_variable var = std::make_shared<Variable>(var_type, var_value);
-    declare_variable(identifier, VariableHolder{var});
+void Environment::declare_variable(symbol_id identifier, VariableType var_type, value var_value) {
+    MemStats::SubsystemScope mem_scope{MemSubsystem::ENVIRONMENT};
+    sp_variable var = allocate_rc<Variable>(&_pool, std::move(var_type), std::move(var_value));
+    declare_variable(identifier, VariableHolder{std::move(var)});
 };
 
 void Environment::calling_function(std::optional<Type> ret_type) {
-    _call_frames.push(CallFrame{ret_type});
+    MemStats::SubsystemScope mem_scope{MemSubsystem::ENVIRONMENT};
+    _call_frames.emplace(std::move(ret_type), &_pool);
 }
 
 void Environment::exiting_function() {
@@ -41,6 +47,7 @@ void Environment::exiting_function() {
 }
 
 void Environment::add_scope() {
+    MemStats::SubsystemScope mem_scope{MemSubsystem::ENVIRONMENT};
     _call_frames.top().push_scope();
 }
 
@@ -48,16 +55,15 @@ void Environment::pop_scope() {
     _call_frames.top().pop_scope();
 }
 
-bool Environment::can_define(const std::string& identifier) {
+bool Environment::can_define(symbol_id identifier) {
     return not(_functions.contains(identifier) or _call_frames.top().is_in_current_scope(identifier));
 }
 
-std::optional<VariableHolder> Environment::get_by_identifier(const std::string& identifier) {
-    std::optional<VariableHolder> var_hold{std::nullopt};
+std::optional<VariableHolder> Environment::get_by_identifier(symbol_id identifier) {
     return _call_frames.top().find_variable(identifier);
 }
 
-sp_callable Environment::get_global_function(const std::string& identifier) {
+sp_callable Environment::get_global_function(symbol_id identifier) {
     auto it = _functions.find(identifier);
     return it != _functions.end() ? it->second : nullptr;
 }
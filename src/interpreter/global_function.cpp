@@ -1,7 +1,9 @@
 #include "global_function.hpp"
 
 #include "interpreter.hpp"
+#include "sampling_profiler.hpp"
 #include "statement.hpp"
+#include "trace_events.hpp"
 #include "type_handler.hpp"
 
 GlobalFunction::GlobalFunction(const FunctionDefinition& function) : _function{function} {}
@@ -10,20 +12,20 @@ Type GlobalFunction::get_type() const {
     return _function.signature->type;
 }
 
-void GlobalFunction::call(Interpreter& inter, arg_list arguments) {
-    std::string id{_function.signature->identifier};
+void GlobalFunction::call(Interpreter& inter, arg_list&& arguments) {
+    TraceEvents::Span trace_span{"call", _function.signature->identifier, inter._source, _function.offset};
+    SamplingProfiler::ShadowFrame shadow_frame{_function};
     auto& params{_function.signature->params};
 
     // initializing args
     for (size_t i = 0; i < arguments.size(); ++i) {
         std::visit(
-            [&]<typename T>(const T& val_or_vh) {
+            [&]<typename T>(T& val_or_vh) {
                 if constexpr (std::same_as<VariableHolder, T>) {
-                    VariableHolder var_holder{val_or_vh.var, params[i]->type.is_mutable};
-                    inter._env.declare_variable(params[i]->name, var_holder);
+                    VariableHolder var_holder{std::move(val_or_vh.var), params[i]->type.is_mutable};
+                    inter._env.declare_variable(params[i]->symbol, std::move(var_holder));
                 } else if constexpr (std::same_as<value, T>) {
-                    sp_variable var = std::make_shared<Variable>(params[i]->type, val_or_vh);
-                    inter._env.declare_variable(params[i]->name, VariableHolder{var});
+                    inter._env.declare_variable(params[i]->symbol, params[i]->type, std::move(val_or_vh));
                 }
             },
             arguments[i]);
@@ -0,0 +1,193 @@
+#include "hot_spots.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <string_view>
+
+std::uint64_t HitCountingPolicy::get_hits(const Node& node) const {
+    auto it = _hits.find(&node);
+    return it != _hits.end() ? it->second : 0;
+}
+
+HotSpotReport::HotSpotReport(const HitCountingPolicy& hits) : _hits{hits} {}
+
+void HotSpotReport::_count_line(const Node& node, std::uint64_t hits) {
+    std::uint64_t& line_hits{_line_hits[resolve_position(_source, node.offset).get_line()]};
+    line_hits = std::max(line_hits, hits);
+}
+
+void HotSpotReport::_record(const Node& node) {
+    _count_line(node, _hits.get_hits(node));
+}
+
+void HotSpotReport::_record_statement(NodeKind kind, const Node& node) {
+    std::uint64_t hits{_hits.get_hits(node)};
+    _count_line(node, hits);
+    _statements.push_back(StatementHits{kind, resolve_position(_source, node.offset), hits, std::nullopt});
+}
+
+/* -----------------------------------------------------------------------------*
+ *                              VISITING STATEMENTS                             *
+ *------------------------------------------------------------------------------*/
+
+void HotSpotReport::visit(const Program& program) {
+    _source = program.source.get();
+    std::ranges::for_each(program.function_definitions, [this](const auto& func_def) { func_def->accept(*this); });
+}
+
+void HotSpotReport::visit(const ContinueStatement& continue_stmnt) {
+    _record_statement(NodeKind::CONTINUE_STATEMENT, continue_stmnt);
+}
+
+void HotSpotReport::visit(const BreakStatement& break_stmnt) {
+    _record_statement(NodeKind::BREAK_STATEMENT, break_stmnt);
+}
+
+void HotSpotReport::visit(const ReturnStatement& return_stmnt) {
+    _record_statement(NodeKind::RETURN_STATEMENT, return_stmnt);
+    if (return_stmnt.expression) return_stmnt.expression->accept(*this);
+}
+
+void HotSpotReport::visit(const VariableDeclaration& var_decl) {
+    _record_statement(NodeKind::VARIABLE_DECLARATION, var_decl);
+    var_decl.assigned_expression->accept(*this);
+}
+
+void HotSpotReport::visit(const CodeBlock& code_block) {
+    _record(code_block);
+    std::ranges::for_each(code_block.statements, [this](const auto& statement) { statement->accept(*this); });
+}
+
+void HotSpotReport::visit(const IfStatement& if_stmnt) {
+    _record_statement(NodeKind::IF_STATEMENT, if_stmnt);
+    if_stmnt.condition->accept(*this);
+    if_stmnt.body->accept(*this);
+    std::ranges::for_each(if_stmnt.else_ifs, [this](const auto& else_if) { else_if->accept(*this); });
+    if (if_stmnt.else_body) if_stmnt.else_body->accept(*this);
+}
+
+void HotSpotReport::visit(const ElseIf& else_if) {
+    _record_statement(NodeKind::ELSE_IF, else_if);
+    else_if.condition->accept(*this);
+    else_if.body->accept(*this);
+}
+
+void HotSpotReport::visit(const AssignStatement& asgn_stmnt) {
+    _record_statement(NodeKind::ASSIGN_STATEMENT, asgn_stmnt);
+    asgn_stmnt.expr->accept(*this);
+}
+
+void HotSpotReport::visit(const ExpressionStatement& expr_stmnt) {
+    _record_statement(NodeKind::EXPRESSION_STATEMENT, expr_stmnt);
+    expr_stmnt.expr->accept(*this);
+}
+
+void HotSpotReport::visit(const FunctionDefinition& func_def) {
+    // definition itself is executed once, at registration - its line shows calls, counted by the body
+    func_def.body->accept(*this);
+}
+
+void HotSpotReport::visit(const ForLoop& for_loop) {
+    _record_statement(NodeKind::FOR_LOOP, for_loop);
+    _statements.back().iterations = _hits.get_hits(*for_loop.body);
+    for_loop.var_declaration->accept(*this);
+    for_loop.condition->accept(*this);
+    for_loop.loop_update->accept(*this);
+    for_loop.body->accept(*this);
+}
+
+/* -----------------------------------------------------------------------------*
+ *                             VISITING EXPRESSIONS                             *
+ *------------------------------------------------------------------------------*/
+
+void HotSpotReport::visit(const BinaryExpression& binary_expr) {
+    _record(binary_expr);
+    binary_expr.left->accept(*this);
+    binary_expr.right->accept(*this);
+}
+
+void HotSpotReport::visit(const UnaryExpression& unary_expr) {
+    _record(unary_expr);
+    unary_expr.expr->accept(*this);
+}
+
+void HotSpotReport::visit(const FunctionCall& func_call_expr) {
+    _record(func_call_expr);
+    func_call_expr.callee->accept(*this);
+    std::ranges::for_each(func_call_expr.argument_list, [this](const auto& argument) { argument->accept(*this); });
+}
+
+void HotSpotReport::visit(const BindFront& bind_front_expr) {
+    _record(bind_front_expr);
+    std::ranges::for_each(bind_front_expr.argument_list, [this](const auto& argument) { argument->accept(*this); });
+    bind_front_expr.target->accept(*this);
+}
+
+void HotSpotReport::visit(const TypeCastExpression& type_cast_expr) {
+    _record(type_cast_expr);
+    type_cast_expr.expr->accept(*this);
+}
+
+void HotSpotReport::visit(const Identifier& identifier) {
+    _record(identifier);
+}
+
+void HotSpotReport::visit(const LiteralInt& literal_int) {
+    _record(literal_int);
+}
+
+void HotSpotReport::visit(const LiteralFloat& literal_float) {
+    _record(literal_float);
+}
+
+void HotSpotReport::visit(const LiteralString& literal_string) {
+    _record(literal_string);
+}
+
+void HotSpotReport::visit(const LiteralBool& literal_bool) {
+    _record(literal_bool);
+}
+
+/* -----------------------------------------------------------------------------*
+ *                                   PRINTING                                   *
+ *------------------------------------------------------------------------------*/
+
+std::uint64_t HotSpotReport::get_line_hits(int line) const {
+    auto it = _line_hits.find(line);
+    return it != _line_hits.end() ? it->second : 0;
+}
+
+void HotSpotReport::print(std::ostream& os, std::size_t top_count) const {
+    if (_source) {
+        os << "annotated source:\n";
+        std::istringstream lines{_source->text};
+        std::string line_text;
+        for (int line = 1; std::getline(lines, line_text); ++line) {
+            auto it = _line_hits.find(line);
+            if (it != _line_hits.end() and it->second != 0) {
+                os << std::setw(12) << it->second;
+            } else {
+                os << std::setw(12) << (it != _line_hits.end() ? "." : "");
+            }
+            os << std::setw(6) << line << " | " << line_text << "\n";
+        }
+    }
+
+    std::vector<StatementHits> hottest{_statements};
+    std::ranges::stable_sort(hottest, [](const auto& lhs, const auto& rhs) { return lhs.hits > rhs.hits; });
+    if (hottest.size() > top_count) hottest.resize(top_count);
+    os << "hot spots:\n";
+    for (const StatementHits& statement : hottest) {
+        if (statement.hits == 0) break;
+        os << std::setw(12) << statement.hits << "  " << std::left << std::setw(22) << node_kind_name(statement.kind)
+           << std::right << statement.position.get_position_str() << "\n";
+    }
+
+    os << "loops:\n";
+    for (const StatementHits& statement : _statements) {
+        if (not statement.iterations) continue;
+        os << "  for at " << statement.position.get_position_str() << ": entered " << statement.hits << " times, "
+           << *statement.iterations << " iterations\n";
+    }
+}
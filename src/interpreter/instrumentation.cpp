@@ -0,0 +1,106 @@
+#include "instrumentation.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <numeric>
+#include <string>
+
+namespace {
+double to_ms(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+}  // namespace
+
+const char* node_kind_name(NodeKind kind) {
+    switch (kind) {
+        case NodeKind::PROGRAM:
+            return "Program";
+        case NodeKind::FUNCTION_DEFINITION:
+            return "FunctionDefinition";
+        case NodeKind::CONTINUE_STATEMENT:
+            return "ContinueStatement";
+        case NodeKind::BREAK_STATEMENT:
+            return "BreakStatement";
+        case NodeKind::RETURN_STATEMENT:
+            return "ReturnStatement";
+        case NodeKind::VARIABLE_DECLARATION:
+            return "VariableDeclaration";
+        case NodeKind::CODE_BLOCK:
+            return "CodeBlock";
+        case NodeKind::IF_STATEMENT:
+            return "IfStatement";
+        case NodeKind::ELSE_IF:
+            return "ElseIf";
+        case NodeKind::ASSIGN_STATEMENT:
+            return "AssignStatement";
+        case NodeKind::EXPRESSION_STATEMENT:
+            return "ExpressionStatement";
+        case NodeKind::FOR_LOOP:
+            return "ForLoop";
+        case NodeKind::BINARY_EXPRESSION:
+            return "BinaryExpression";
+        case NodeKind::UNARY_EXPRESSION:
+            return "UnaryExpression";
+        case NodeKind::FUNCTION_CALL:
+            return "FunctionCall";
+        case NodeKind::BIND_FRONT:
+            return "BindFront";
+        case NodeKind::TYPE_CAST_EXPRESSION:
+            return "TypeCastExpression";
+        case NodeKind::IDENTIFIER:
+            return "Identifier";
+        case NodeKind::LITERAL_INT:
+            return "LiteralInt";
+        case NodeKind::LITERAL_FLOAT:
+            return "LiteralFloat";
+        case NodeKind::LITERAL_STRING:
+            return "LiteralString";
+        case NodeKind::LITERAL_BOOL:
+            return "LiteralBool";
+        default:
+            return "unknown";
+    }
+}
+
+std::uint64_t CountingPolicy::get_count(NodeKind kind) const {
+    return _counts[static_cast<std::size_t>(kind)];
+}
+
+void CountingPolicy::report(std::ostream& os) const {
+    os << "executed nodes:\n";
+    for (std::size_t kind = 0; kind < NODE_KIND_COUNT; ++kind) {
+        if (_counts[kind] == 0) continue;
+        os << "  " << std::left << std::setw(22) << node_kind_name(static_cast<NodeKind>(kind)) << std::right
+           << std::setw(14) << _counts[kind] << "\n";
+    }
+}
+
+TracingPolicy::TracingPolicy(std::ostream& os) : _os{os} {}
+
+void TracingPolicy::enter(NodeKind kind, const Node& node) {
+    if (kind == NodeKind::PROGRAM) _source = static_cast<const Program&>(node).source.get();
+    _os << std::string(2 * _depth, ' ') << node_kind_name(kind) << " "
+        << resolve_position(_source, node.offset).get_position_str() << "\n";
+    ++_depth;
+}
+
+void TimingPolicy::report(std::ostream& os) const {
+    std::vector<std::size_t> kinds(NODE_KIND_COUNT);
+    std::iota(kinds.begin(), kinds.end(), 0);
+    std::ranges::sort(kinds, [this](std::size_t lhs, std::size_t rhs) { return _times[lhs].self > _times[rhs].self; });
+
+    os << "  " << std::left << std::setw(22) << "node" << std::right << std::setw(14) << "count" << std::setw(14)
+       << "total [ms]" << std::setw(14) << "self [ms]" << "\n";
+    std::ios_base::fmtflags flags{os.flags()};
+    std::streamsize precision{os.precision()};
+    os << std::fixed << std::setprecision(3);
+    for (std::size_t kind : kinds) {
+        const KindTimes& times{_times[kind]};
+        if (times.count == 0) continue;
+        os << "  " << std::left << std::setw(22) << node_kind_name(static_cast<NodeKind>(kind)) << std::right
+           << std::setw(14) << times.count << std::setw(14) << to_ms(times.total) << std::setw(14) << to_ms(times.self)
+           << "\n";
+    }
+    os.flags(flags);
+    os.precision(precision);
+}
@@ -1,132 +1,186 @@
 #include "interpreter.hpp"
 
 #include "builtint_functions.hpp"
+#include "call_site_cache.hpp"
+#include "counted_loop.hpp"
 #include "exceptions.hpp"
 #include "global_function.hpp"
+#include "mem_stats.hpp"
 #include "oper_handler.hpp"
 #include "program.hpp"
+#include "quickening.hpp"
 #include "statement.hpp"
+#include "trace_events.hpp"
 #include "type_handler.hpp"
 
 #include <algorithm>
 
+namespace {
+std::uint64_t next_run_id{0};
+}
+
 void Interpreter::visit(const Program& program) {
-    std::for_each(program.function_definitions.begin(), program.function_definitions.end(),
-                  [this](const auto& func_def) { func_def->accept(*this); });
-    _execute_main();
+    _run_id = ++next_run_id;
+    _source = program.source.get();
+    _operation_expr = nullptr;
+    // errors of operators come without position - it is added here, once, instead of around every operation
+    try {
+        std::for_each(program.function_definitions.begin(), program.function_definitions.end(),
+                      [this](const auto& func_def) { func_def->accept(*this); });
+        _execute_main();
+    } catch (const CantPerformOperationException& e) {
+        _rethrow_at_operation(e);
+    } catch (const RequiredFunctionException& e) {
+        _rethrow_at_operation(e);
+    } catch (const BinaryExprTypeMismatchException& e) {
+        _rethrow_at_operation(e);
+    } catch (const InvalidFucTForCompositionExeption& e) {
+        _rethrow_at_operation(e);
+    } catch (const IntOverflowException& e) {
+        _rethrow_at_operation(e);
+    } catch (const DivByZeroException& e) {
+        _rethrow_at_operation(e);
+    } catch (const ArgTypesNotMatchingException& e) {
+        _rethrow_at_operation(e);
+    } catch (const TooManyArgsToBindException& e) {
+        _rethrow_at_operation(e);
+    }
 }
 
 void Interpreter::visit(const FunctionDefinition& func_def) {
-    _env.register_function(func_def);
+    if (not _env.register_function(func_def)) {
+        throw AlreadyDefinedException(func_def.signature->identifier, _position_of(func_def));
+    }
 }
 
 void Interpreter::visit(const FunctionCall& func_call) {
-    func_call.callee->accept(*this);
-
-    if (not TypeHandler::value_type_is<sp_callable>(_tmp_result)) {
-        throw RequiredFunctionException(expr_kind_to_str(func_call.kind), func_call.callee->position,
-                                        TypeHandler::get_type_string(_tmp_result));
-    }
-    auto func{TypeHandler::get_value_as<sp_callable>(_tmp_result)};
-    auto func_type_info{func->get_type().function_type_info};
+    auto [func, func_type_info] = _resolve_callee(func_call);
     arg_list arguments{_get_arg_list(func_call.argument_list)};
     _clear_tmp_result();
 
     if (not TypeHandler::args_match_params(arguments, func_type_info->param_types)) {
         throw ArgTypesNotMatchingException(expr_kind_to_str(func_call.kind), TypeHandler::get_types_string(arguments),
                                            TypeHandler::get_types_string(func_type_info->param_types),
-                                           func_call.position);
+                                           _position_of(func_call));
     }
     _env.calling_function(func_type_info->return_type);
-    func->call(*this, arguments);
+    func->call(*this, std::move(arguments));
     _handle_function_call_end();
 }
 
+std::pair<sp_callable, Rc<FunctionTypeInfo>> Interpreter::_resolve_callee(const FunctionCall& func_call) {
+    std::shared_ptr<CallSiteCache>& cache{func_call.call_cache};
+    bool cache_valid{cache and cache->run_id == _run_id};
+    if (cache_valid and cache->is_global) {
+        return {cache->callee, cache->type_info};
+    }
+
+    func_call.callee->accept(*this);
+    if (not TypeHandler::value_type_is<sp_callable>(_tmp_result)) {
+        throw RequiredFunctionException(expr_kind_to_str(func_call.kind), _position_of(*func_call.callee),
+                                        TypeHandler::get_type_string(_tmp_result));
+    }
+    auto func{TypeHandler::get_value_as<sp_callable>(_tmp_result)};
+    if (cache_valid and cache->callee == func) {
+        return {func, cache->type_info};
+    }
+
+    auto identifier = dynamic_cast<const Identifier*>(func_call.callee.get());
+    bool is_global{identifier and _env.get_global_function(identifier->symbol) == func};
+    MemStats::SubsystemScope mem_scope{MemSubsystem::CALLABLES};
+
+    auto func_type_info{func->get_type().function_type_info};
+    cache = std::make_shared<CallSiteCache>(_run_id, func, func_type_info, is_global);
+    return {func, func_type_info};
+}
+
 void Interpreter::visit(const Identifier& var_reference) {
     // sprawdzamy czy jest funkcja globalna, lub czy mamy taka zmienna
-    if (auto global_func{_env.get_global_function(var_reference.name)}) {
-        _tmp_result = global_func;
-    } else if (auto opt_var_holder = _env.get_by_identifier(var_reference.name)) {
-        _tmp_result = opt_var_holder.value();
+    if (auto global_func{_env.get_global_function(var_reference.symbol)}) {
+        _tmp_result = std::move(global_func);
+    } else if (auto opt_var_holder = _env.get_by_identifier(var_reference.symbol)) {
+        _tmp_result = std::move(opt_var_holder.value());
     } else {
-        throw UnknownIdentifierException(var_reference.name, var_reference.position);
+        throw UnknownIdentifierException(var_reference.name, _position_of(var_reference));
     }
 }
 
 void Interpreter::visit(const CodeBlock& code_block) {
-    _env.add_scope();
+    // nothing can be declared in it - lookups would fall through an empty scope anyway
+    bool opens_scope{code_block.declaration_count != 0};
+    if (opens_scope) _env.add_scope();
     for (auto& statment : code_block.statements) {
         statment->accept(*this);
         if (_should_exit_code_block()) {
             break;
         }
     }
-    _env.pop_scope();
+    if (opens_scope) _env.pop_scope();
 }
 
 void Interpreter::visit(const TypeCastExpression& type_cast_expr) {
     type_cast_expr.expr->accept(*this);
-    Type target_type{type_cast_expr.target_type};
+    const Type& target_type{type_cast_expr.target_type};
 
     if (_tmp_result_is_empty()) {
         throw CannotCastException(TypeHandler::get_type_string(_tmp_result), target_type.to_str(),
-                                  type_cast_expr.position);
+                                  _position_of(type_cast_expr));
     }
 
-    value unwraped_value{TypeHandler::extract_value(_tmp_result)};
+    value unwraped_value{TypeHandler::extract_value(std::move(_tmp_result))};
     if (auto opt_casted = TypeHandler::as_type(target_type, unwraped_value)) {
-        _tmp_result = opt_casted.value();
+        _tmp_result = std::move(opt_casted.value());
         return;
     }
 
     throw CannotCastException(TypeHandler::deduce_type(unwraped_value).to_str(), target_type.to_str(),
-                              type_cast_expr.position);
+                              _position_of(type_cast_expr));
 }
 
 void Interpreter::visit(const VariableDeclaration& var_decl) {
-    std::string identifier{var_decl.typed_identifier->name};
+    symbol_id identifier{var_decl.typed_identifier->symbol};
     if (not _env.can_define(identifier)) {
-        throw AlreadyDefinedException(identifier, var_decl.position);
+        throw AlreadyDefinedException(var_decl.typed_identifier->name, _position_of(var_decl));
     }
-    auto var_type{var_decl.typed_identifier->type};
+    const VariableType& var_type{var_decl.typed_identifier->type};
 
     var_decl.assigned_expression->accept(*this);
     if (_tmp_result_is_empty())
         throw AssignTypeMismatchException(var_type.type.to_str(), TypeHandler::get_type_string(_tmp_result),
-                                          var_decl.assigned_expression->position);
+                                          _position_of(*var_decl.assigned_expression));
 
-    auto value_to_assign{TypeHandler::extract_value(_tmp_result)};
+    auto value_to_assign{TypeHandler::extract_value(std::move(_tmp_result))};
     if (TypeHandler::deduce_type(value_to_assign) != var_type.type) {
         throw AssignTypeMismatchException(var_type.type.to_str(), TypeHandler::deduce_type(value_to_assign).to_str(),
-                                          var_decl.assigned_expression->position);
+                                          _position_of(*var_decl.assigned_expression));
     }
-    _env.declare_variable(var_decl.typed_identifier->name, var_type, value_to_assign);
+    _env.declare_variable(identifier, var_type, std::move(value_to_assign));
     _clear_tmp_result();
 }
 
 void Interpreter::visit(const AssignStatement& asgn_stmnt) {
-    auto opt_var_holder{_env.get_by_identifier(asgn_stmnt.identifier)};
+    auto opt_var_holder{_env.get_by_identifier(asgn_stmnt.symbol)};
     if (not opt_var_holder) {
-        throw UnknownIdentifierException(asgn_stmnt.identifier, asgn_stmnt.position);
+        throw UnknownIdentifierException(asgn_stmnt.identifier, _position_of(asgn_stmnt));
     }
 
-    auto var_holder{opt_var_holder.value()};
+    const VariableHolder& var_holder{opt_var_holder.value()};
     if (not var_holder.can_change_var) {
-        throw CantAssignToImmutableException(asgn_stmnt.identifier, asgn_stmnt.position);
+        throw CantAssignToImmutableException(asgn_stmnt.identifier, _position_of(asgn_stmnt));
     }
 
     asgn_stmnt.expr->accept(*this);
     if (_tmp_result_is_empty())
         throw AssignTypeMismatchException(var_holder.get_type().to_str(), TypeHandler::get_type_string(_tmp_result),
-                                          asgn_stmnt.expr->position);
+                                          _position_of(*asgn_stmnt.expr));
 
-    auto value_to_assign{TypeHandler::extract_value(_tmp_result)};
+    auto value_to_assign{TypeHandler::extract_value(std::move(_tmp_result))};
     if (TypeHandler::deduce_type(value_to_assign) != var_holder.get_type()) {
         throw AssignTypeMismatchException(var_holder.get_type().to_str(),
                                           TypeHandler::deduce_type(value_to_assign).to_str(),
-                                          asgn_stmnt.expr->position);
+                                          _position_of(*asgn_stmnt.expr));
     }
-    var_holder.var->var_value = value_to_assign;
+    var_holder.var->var_value = std::move(value_to_assign);
     _clear_tmp_result();
 }
 
@@ -140,12 +194,12 @@ void Interpreter::visit(const ReturnStatement& return_stmnt) {
 
     if (not TypeHandler::matches_return_type(_tmp_result, _env.get_cur_func_ret_type())) {
         throw ReturnTypeMismatchException{TypeHandler::get_type_string(_env.get_cur_func_ret_type()),
-                                          TypeHandler::get_type_string(_tmp_result), return_stmnt.position};
+                                          TypeHandler::get_type_string(_tmp_result), _position_of(return_stmnt)};
     }
 
     // if function returns something make sure for it to be a value not var holder
     if (not _tmp_result_is_empty()) {
-        _tmp_result = TypeHandler::extract_value(_tmp_result);
+        _tmp_result = TypeHandler::extract_value(std::move(_tmp_result));
     }
 
     _is_returning = true;
@@ -153,24 +207,29 @@ void Interpreter::visit(const ReturnStatement& return_stmnt) {
 
 void Interpreter::visit(const ContinueStatement& continue_stmnt) {
     if (not _inside_loop) {
-        throw LoopStmtOutsideLoopException("Continue", continue_stmnt.position);
+        throw LoopStmtOutsideLoopException("Continue", _position_of(continue_stmnt));
     }
     _on_continue = true;
 }
 
 void Interpreter::visit(const BreakStatement& break_stmnt) {
     if (not _inside_loop) {
-        throw LoopStmtOutsideLoopException("Break", break_stmnt.position);
+        throw LoopStmtOutsideLoopException("Break", _position_of(break_stmnt));
     }
     _on_break = true;
 }
 
 void Interpreter::visit(const ForLoop& for_loop) {
+    TraceEvents::Span trace_span{"loop", "for", _source, for_loop.offset};
     _enter_loop();
     for_loop.var_declaration->accept(*this);
+    if (_use_fast_paths and _run_counted_loop(for_loop)) {
+        _exit_loop();
+        return;
+    }
 
     for_loop.condition->accept(*this);
-    _evaluate_condition(for_loop.condition->position);
+    _evaluate_condition(*for_loop.condition);
 
     while (_condition_met) {
         _on_continue = false;
@@ -180,7 +239,7 @@ void Interpreter::visit(const ForLoop& for_loop) {
         for_loop.loop_update->accept(*this);
 
         for_loop.condition->accept(*this);
-        _evaluate_condition(for_loop.condition->position);
+        _evaluate_condition(*for_loop.condition);
     }
     _exit_loop();
 }
@@ -188,41 +247,50 @@ void Interpreter::visit(const ForLoop& for_loop) {
 void Interpreter::visit(const BinaryExpression& binary_expr) {
     binary_expr.left->accept(*this);
     if (_tmp_result_is_empty()) {
-        throw ExpectedEvaluableExprException(expr_kind_to_str(binary_expr.kind), binary_expr.left->position);
+        throw ExpectedEvaluableExprException(expr_kind_to_str(binary_expr.kind), _position_of(*binary_expr.left));
     }
-    auto left{TypeHandler::extract_value(_tmp_result)};
+    // right operand may change the variable through a mut parameter - left one is read before it, as a copy
+    value left{TypeHandler::extract_value(std::move(_tmp_result))};
     _clear_tmp_result();
 
     binary_expr.right->accept(*this);
     if (_tmp_result_is_empty()) {
-        throw ExpectedEvaluableExprException(expr_kind_to_str(binary_expr.kind), binary_expr.right->position);
+        throw ExpectedEvaluableExprException(expr_kind_to_str(binary_expr.kind), _position_of(*binary_expr.right));
     }
-    auto right{TypeHandler::extract_value(_tmp_result)};
+    // right operand is read in place - nothing runs between its evaluation and the operation
+    vhold_or_val right_operand{std::move(_tmp_result.value())};
+    const value& right{TypeHandler::value_ref(right_operand)};
     _clear_tmp_result();
 
-    try {
-        _evaluate_binary_expr(binary_expr.kind, left, right);
-    } catch (const CantPerformOperationException& e) {
-        rethrow_with_position(e, binary_expr.position);
-    } catch (const RequiredFunctionException& e) {
-        rethrow_with_position(e, binary_expr.position);
-    } catch (const BinaryExprTypeMismatchException& e) {
-        rethrow_with_position(e, binary_expr.position);
-    } catch (const InvalidFucTForCompositionExeption& e) {
-        rethrow_with_position(e, binary_expr.position);
-    } catch (const IntOverflowException& e) {
-        rethrow_with_position(e, binary_expr.position);
-    } catch (const DivByZeroException& e) {
-        rethrow_with_position(e, binary_expr.position);
+    _operation_expr = &binary_expr;
+    auto quickened = static_cast<QuickenedOp>(binary_expr.quickened);
+    if (quickened == QuickenedOp::UNQUICKENED) {
+        quickened = Quickening::select(binary_expr.kind, left, right);
+        binary_expr.quickened = static_cast<std::uint8_t>(quickened);
     }
+    if (quickened != QuickenedOp::GENERIC) {
+        if (auto result = Quickening::execute(quickened, left, right)) {
+            if (not result->ok()) OperHandler::raise_arithmetic_error(result->status);
+            _tmp_result = std::move(result->value);
+            _operation_expr = nullptr;
+            return;
+        }
+        // operand types differ from the ones seen before - stay on the generic path
+        binary_expr.quickened = static_cast<std::uint8_t>(QuickenedOp::GENERIC);
+    }
+    _evaluate_binary_expr(binary_expr.kind, left, right);
+    _operation_expr = nullptr;
 }
 
 void Interpreter::visit(const UnaryExpression& unary_expr) {
     unary_expr.expr->accept(*this);
     if (_tmp_result_is_empty()) {
-        throw ExpectedEvaluableExprException(expr_kind_to_str(unary_expr.kind), unary_expr.expr->position);
+        throw ExpectedEvaluableExprException(expr_kind_to_str(unary_expr.kind), _position_of(*unary_expr.expr));
     }
-    _evaluate_unary_expr(unary_expr.kind, TypeHandler::extract_value(_tmp_result));
+    vhold_or_val operand{std::move(_tmp_result.value())};
+    _operation_expr = &unary_expr;
+    _evaluate_unary_expr(unary_expr.kind, TypeHandler::value_ref(operand));
+    _operation_expr = nullptr;
 }
 
 void Interpreter::visit(const BindFront& bind_front_expr) {
@@ -230,21 +298,17 @@ void Interpreter::visit(const BindFront& bind_front_expr) {
     bind_front_expr.target->accept(*this);
 
     if (not TypeHandler::value_type_is<sp_callable>(_tmp_result)) {
-        throw RequiredFunctionException(expr_kind_to_str(bind_front_expr.kind), bind_front_expr.target->position,
+        throw RequiredFunctionException(expr_kind_to_str(bind_front_expr.kind), _position_of(*bind_front_expr.target),
                                         TypeHandler::get_type_string(_tmp_result));
     }
-    try {
-        _tmp_result = OperHandler::bind_front_function(TypeHandler::get_value_as<sp_callable>(_tmp_result), args);
-    } catch (const ArgTypesNotMatchingException& e) {
-        rethrow_with_position(e, bind_front_expr.position);
-    } catch (const TooManyArgsToBindException& e) {
-        rethrow_with_position(e, bind_front_expr.position);
-    }
+    _operation_expr = &bind_front_expr;
+    _tmp_result = OperHandler::bind_front_function(TypeHandler::get_value_as<sp_callable>(_tmp_result), args);
+    _operation_expr = nullptr;
 }
 
 void Interpreter::visit(const IfStatement& if_stmnt) {
     if_stmnt.condition->accept(*this);
-    _evaluate_condition(if_stmnt.condition->position);
+    _evaluate_condition(*if_stmnt.condition);
 
     if (_condition_met) {
         if_stmnt.body->accept(*this);
@@ -263,13 +327,13 @@ void Interpreter::visit(const IfStatement& if_stmnt) {
 
 void Interpreter::visit(const ElseIf& else_if) {
     else_if.condition->accept(*this);
-    _evaluate_condition(else_if.condition->position);
+    _evaluate_condition(*else_if.condition);
 
     if (_condition_met) else_if.body->accept(*this);
 }
 
 void Interpreter::visit(const LiteralString& literal_string) {
-    _tmp_result = literal_string.value;
+    _tmp_result = StringValue{literal_string.value};
 }
 
 void Interpreter::visit(const LiteralInt& literal_int) {
@@ -284,7 +348,7 @@ void Interpreter::visit(const LiteralBool& literal_bool) {
 }
 
 void Interpreter::_execute_main() {
-    auto main{_env.get_global_function(MainProperties::main_identifier)};
+    auto main{_env.get_global_function(Symbols::intern(MainProperties::main_identifier))};
     if (not main) throw MissingMainFuncException();
 
     if (not(main->get_type() == MainProperties::type)) {
@@ -292,20 +356,21 @@ void Interpreter::_execute_main() {
     };
 
     _env.calling_function(main->get_type().function_type_info->return_type);
-    main->call(*this, {});
+    main->call(*this, arg_list{});
     _handle_function_call_end();
 }
 
 arg_list Interpreter::_get_arg_list(const up_expression_vec& arguments) {
+    MemStats::SubsystemScope mem_scope{MemSubsystem::CALLABLES};
     arg_list args{};
 
     std::for_each(arguments.begin(), arguments.end(), [&](const up_expression& expr) {
         expr->accept(*this);
 
         if (_tmp_result_is_empty()) {
-            throw ExpectedEvaluableExprException("Argument list", expr->position);
+            throw ExpectedEvaluableExprException("Argument list", _position_of(*expr));
         }
-        args.push_back(TypeHandler::opt_value_to_arg(_tmp_result));
+        args.push_back(TypeHandler::opt_value_to_arg(std::move(_tmp_result)));
     });
 
     return args;
@@ -316,7 +381,7 @@ void Interpreter::_handle_function_call_end() {
     _env.exiting_function();
 }
 
-void Interpreter::_evaluate_binary_expr(const ExprKind& expr_kind, value left, value right) {
+void Interpreter::_evaluate_binary_expr(const ExprKind& expr_kind, const value& left, const value& right) {
     if (not TypeHandler::are_the_same_type(left, right)) {  // values have to be the same type
         throw BinaryExprTypeMismatchException(expr_kind_to_str(expr_kind), TypeHandler::deduce_type(left).to_str(),
                                               TypeHandler::deduce_type(right).to_str());
@@ -367,7 +432,7 @@ void Interpreter::_evaluate_binary_expr(const ExprKind& expr_kind, value left, v
     }
 }
 
-void Interpreter::_evaluate_unary_expr(const ExprKind& expr_kind, value val) {
+void Interpreter::_evaluate_unary_expr(const ExprKind& expr_kind, const value& val) {
     if (expr_kind == ExprKind::LOGICAL_NOT) {
         _tmp_result = OperHandler::logical_not(val);
     } else if (expr_kind == ExprKind::UNARY_MINUS) {
@@ -377,14 +442,18 @@ void Interpreter::_evaluate_unary_expr(const ExprKind& expr_kind, value val) {
     }
 }
 
-void Interpreter::_evaluate_condition(const Position& condition_pos) {
+void Interpreter::_evaluate_condition(const Expression& condition) {
     if (not TypeHandler::value_type_is<bool>(_tmp_result)) {
-        throw ConditionMustBeBoolException(TypeHandler::get_type_string(_tmp_result), condition_pos);
+        throw ConditionMustBeBoolException(TypeHandler::get_type_string(_tmp_result), _position_of(condition));
     }
     _condition_met = TypeHandler::get_value_as<bool>(_tmp_result);
     _clear_tmp_result();
 }
 
+Position Interpreter::_position_of(const Node& node) const {
+    return resolve_position(_source, node.offset);
+}
+
 bool Interpreter::_tmp_result_is_empty() const {
     return not _tmp_result.has_value();
 }
@@ -397,6 +466,61 @@ void Interpreter::_clear_tmp_result() {
     _tmp_result = std::nullopt;
 }
 
+bool Interpreter::_run_counted_loop(const ForLoop& for_loop) {
+    if (not for_loop.counted_loop) {
+        for_loop.counted_loop = std::make_shared<CountedLoop>(CountedLoop::match(for_loop));
+    }
+    const CountedLoop& counted{*for_loop.counted_loop};
+    if (not counted.matches) return false;
+
+    // bound is read every iteration, like the condition would - global function or non int bound is left to the
+    // general path to report
+    sp_variable bound_var{};
+    if (counted.bound_variable) {
+        if (_env.get_global_function(counted.bound_variable->symbol)) return false;
+        auto bound_holder{_env.get_by_identifier(counted.bound_variable->symbol)};
+        if (not bound_holder or not std::holds_alternative<int_value>(bound_holder->var->var_value)) return false;
+        bound_var = std::move(bound_holder->var);
+    }
+    // stays in its variable - the body reads it by name and may change it through a mutable parameter
+    sp_variable counter{_env.get_by_identifier(counted.counter)->var};
+
+    while (true) {
+        int_value current{std::get<int_value>(counter->var_value)};
+        int_value bound{bound_var ? std::get<int_value>(bound_var->var_value) : counted.bound_literal};
+        bool in_range{};
+        switch (counted.comparison) {
+            case ExprKind::LESS:
+                in_range = current < bound;
+                break;
+            case ExprKind::LESS_EQUAL:
+                in_range = current <= bound;
+                break;
+            case ExprKind::GREATER:
+                in_range = current > bound;
+                break;
+            default:
+                in_range = current >= bound;
+                break;
+        }
+        if (not in_range) break;
+
+        _on_continue = false;
+        for_loop.body->accept(*this);
+        if (_on_break or _is_returning) break;
+
+        current = std::get<int_value>(counter->var_value);
+        auto next{counted.step_kind == ExprKind::ADDITION ? CheckedArithmetic::add(current, counted.step)
+                                                          : CheckedArithmetic::subtract(current, counted.step)};
+        if (not next.ok()) {
+            // general update raises the error with its position
+            for_loop.loop_update->accept(*this);
+        }
+        counter->var_value = next.value;
+    }
+    return true;
+}
+
 void Interpreter::_enter_loop() {
     _inside_loop = true;
     // so the loop variable is visible only within the scope
@@ -1,29 +1,44 @@
 #include "oper_handler.hpp"
 
 #include <algorithm>
-#include <cstdlib>
-#include <limits>
 
 #include "bind_front_function.hpp"
 #include "composed_function.hpp"
 #include "exceptions.hpp"
+#include "mem_stats.hpp"
 #include "type_handler.hpp"
 
 namespace OperHandler {
 
-value add(value left, value right) {
+void raise_arithmetic_error(ArithmeticStatus status) {
+    switch (status) {
+        case ArithmeticStatus::INT_OVERFLOW:
+            throw IntOverflowException();
+        case ArithmeticStatus::DIV_BY_ZERO:
+            throw DivByZeroException();
+        case ArithmeticStatus::OK:
+            break;
+    }
+    throw ImplementationError("raise_arithmetic_error called without error");
+}
+
+namespace {
+template <typename T>
+T unwrap(Checked<T> checked) {
+    if (not checked.ok()) raise_arithmetic_error(checked.status);
+    return checked.value;
+}
+}  // namespace
+
+value add(const value& left, const value& right) {
     return std::visit(
-        [right]<typename T>(const T& left) -> value {
-            if constexpr (std::same_as<int, T>) {
-                int rhs = TypeHandler::get_value_as<int>(right);
-                if (std::abs((double)left + (double)rhs) > std::numeric_limits<int>::max()) {
-                    throw IntOverflowException();
-                }
-                return left + rhs;
+        [&right]<typename T>(const T& left) -> value {
+            if constexpr (std::same_as<int_value, T>) {
+                return unwrap(CheckedArithmetic::add(left, TypeHandler::get_value_as<int_value>(right)));
             } else if constexpr (std::same_as<double, T>) {
                 return left + TypeHandler::get_value_as<double>(right);
-            } else if constexpr (std::same_as<std::string, T>) {
-                return left + TypeHandler::get_value_as<std::string>(right);
+            } else if constexpr (std::same_as<StringValue, T>) {
+                return StringValue::concat(left, std::get<StringValue>(right).view());
             } else {
                 throw CantPerformOperationException(expr_kind_to_str(ExprKind::ADDITION),
                                                     TypeHandler::deduce_type(left).to_str());
@@ -32,15 +47,11 @@ value add(value left, value right) {
         left);
 }
 
-value subtract(value left, value right) {
+value subtract(const value& left, const value& right) {
     return std::visit(
-        [right]<typename T>(const T& left) -> value {
-            if constexpr (std::same_as<int, T>) {
-                int rhs = TypeHandler::get_value_as<int>(right);
-                if (std::abs((double)left - (double)rhs) > std::numeric_limits<int>::max()) {
-                    throw IntOverflowException();
-                }
-                return left - rhs;
+        [&right]<typename T>(const T& left) -> value {
+            if constexpr (std::same_as<int_value, T>) {
+                return unwrap(CheckedArithmetic::subtract(left, TypeHandler::get_value_as<int_value>(right)));
             } else if constexpr (std::same_as<double, T>) {
                 return left - TypeHandler::get_value_as<double>(right);
             } else {
@@ -51,15 +62,11 @@ value subtract(value left, value right) {
         left);
 }
 
-value multiply(value left, value right) {
+value multiply(const value& left, const value& right) {
     return std::visit(
-        [right]<typename T>(const T& left) -> value {
-            if constexpr (std::same_as<int, T>) {
-                int rhs = TypeHandler::get_value_as<int>(right);
-                if (std::abs((double)left * (double)rhs) > std::numeric_limits<int>::max()) {
-                    throw IntOverflowException();
-                }
-                return left * rhs;
+        [&right]<typename T>(const T& left) -> value {
+            if constexpr (std::same_as<int_value, T>) {
+                return unwrap(CheckedArithmetic::multiply(left, TypeHandler::get_value_as<int_value>(right)));
             } else if constexpr (std::same_as<double, T>) {
                 return left * TypeHandler::get_value_as<double>(right);
             } else {
@@ -70,21 +77,13 @@ value multiply(value left, value right) {
         left);
 }
 
-value divide(value left, value right) {
+value divide(const value& left, const value& right) {
     return std::visit(
-        [right]<typename T>(const T& left) -> value {
-            if constexpr (std::same_as<int, T>) {
-                int rhs = TypeHandler::get_value_as<int>(right);
-                if (rhs == 0) {
-                    throw DivByZeroException();
-                }
-                return left / rhs;
+        [&right]<typename T>(const T& left) -> value {
+            if constexpr (std::same_as<int_value, T>) {
+                return unwrap(CheckedArithmetic::divide(left, TypeHandler::get_value_as<int_value>(right)));
             } else if constexpr (std::same_as<double, T>) {
-                auto rhs{TypeHandler::get_value_as<double>(right)};
-                if (rhs == 0) {
-                    throw DivByZeroException();
-                }
-                return left / rhs;
+                return unwrap(CheckedArithmetic::divide(left, TypeHandler::get_value_as<double>(right)));
             } else {
                 throw CantPerformOperationException(expr_kind_to_str(ExprKind::DIVISION),
                                                     TypeHandler::deduce_type(left).to_str());
@@ -93,15 +92,15 @@ value divide(value left, value right) {
         left);
 }
 
-bool check_eq(value left, value right) {
+bool check_eq(const value& left, const value& right) {
     return std::visit(
-        [right]<typename T>(const T& left) -> bool {
-            if constexpr (std::same_as<int, T>) {
-                return left == TypeHandler::get_value_as<int>(right);
+        [&right]<typename T>(const T& left) -> bool {
+            if constexpr (std::same_as<int_value, T>) {
+                return left == TypeHandler::get_value_as<int_value>(right);
             } else if constexpr (std::same_as<double, T>) {
                 return left == TypeHandler::get_value_as<double>(right);
-            } else if constexpr (std::same_as<std::string, T>) {
-                return left == TypeHandler::get_value_as<std::string>(right);
+            } else if constexpr (std::same_as<StringValue, T>) {
+                return left == std::get<StringValue>(right);
             } else if constexpr (std::same_as<bool, T>) {
                 return left == TypeHandler::get_value_as<bool>(right);
             } else {  // all comparison operators are implemented usind == and < - so the debug info is limited
@@ -112,19 +111,19 @@ bool check_eq(value left, value right) {
         left);
 }
 
-bool check_neq(value left, value right) {
+bool check_neq(const value& left, const value& right) {
     return not check_eq(left, right);
 }
 
-bool check_lt(value left, value right) {
+bool check_lt(const value& left, const value& right) {
     return std::visit(
-        [right]<typename T>(const T& left) -> bool {
-            if constexpr (std::same_as<int, T>) {
-                return left < TypeHandler::get_value_as<int>(right);
+        [&right]<typename T>(const T& left) -> bool {
+            if constexpr (std::same_as<int_value, T>) {
+                return left < TypeHandler::get_value_as<int_value>(right);
             } else if constexpr (std::same_as<double, T>) {
                 return left < TypeHandler::get_value_as<double>(right);
-            } else if constexpr (std::same_as<std::string, T>) {
-                return left < TypeHandler::get_value_as<std::string>(right);
+            } else if constexpr (std::same_as<StringValue, T>) {
+                return left < std::get<StringValue>(right);
             } else if constexpr (std::same_as<bool, T>) {
                 return left < TypeHandler::get_value_as<bool>(right);
             } else {
@@ -134,19 +133,19 @@ bool check_lt(value left, value right) {
         left);
 }
 
-bool check_gt(value left, value right) {
+bool check_gt(const value& left, const value& right) {
     return check_lt(right, left);
 }
 
-bool check_gteq(value left, value right) {
+bool check_gteq(const value& left, const value& right) {
     return not check_lt(left, right);
 }
 
-bool check_lteq(value left, value right) {
+bool check_lteq(const value& left, const value& right) {
     return not check_gt(left, right);
 }
 
-bool logical_and(value left, value right) {
+bool logical_and(const value& left, const value& right) {
     if (auto lhs = std::get_if<bool>(&left)) {
         return *lhs and std::get<bool>(right);
     }
@@ -154,7 +153,7 @@ bool logical_and(value left, value right) {
                                         TypeHandler::deduce_type(left).to_str());
 }
 
-bool logical_or(value left, value right) {
+bool logical_or(const value& left, const value& right) {
     if (auto lhs = std::get_if<bool>(&left)) {
         return *lhs or std::get<bool>(right);
     }
@@ -164,7 +163,7 @@ bool logical_or(value left, value right) {
 
 // UNARY
 
-bool logical_not(value val) {
+bool logical_not(const value& val) {
     if (auto bool_val = std::get_if<bool>(&val)) {
         return not *bool_val;
     }
@@ -172,11 +171,11 @@ bool logical_not(value val) {
                                         TypeHandler::deduce_type(val).to_str());
 }
 
-value unary_minus(value val) {
+value unary_minus(const value& val) {
     return std::visit(
         []<typename T>(const T& val) -> value {
-            if constexpr (std::same_as<int, T>) {
-                return -val;
+            if constexpr (std::same_as<int_value, T>) {
+                return unwrap(CheckedArithmetic::negate(val));
             } else if constexpr (std::same_as<double, T>) {
                 return -val;
             } else {
@@ -187,20 +186,21 @@ value unary_minus(value val) {
         val);
 }
 
-sp_callable compose_functions(value left, value right) {
+sp_callable compose_functions(const value& left, const value& right) {
+    MemStats::SubsystemScope mem_scope{MemSubsystem::CALLABLES};
     Type type{TypeHandler::get_composed_func_type(left, right)};
     // if it passed through getting type, the values are functions and are correct
-    return std::make_shared<ComposedFunction>(type, TypeHandler::get_value_as<sp_callable>(left),
-                                              TypeHandler::get_value_as<sp_callable>(right));
+    return ComposedFunction::compose(std::move(type), std::get<sp_callable>(left), std::get<sp_callable>(right));
 }
 
-sp_callable bind_front_function(sp_callable bind_target, arg_list args) {
+sp_callable bind_front_function(const sp_callable& bind_target, const arg_list& args) {
+    MemStats::SubsystemScope mem_scope{MemSubsystem::CALLABLES};
     // save vars passed by reference as their values
     arg_list value_args{};
     std::for_each(args.begin(), args.end(),
-                  [&](auto argument) { value_args.push_back(TypeHandler::extract_value(argument)); });
+                  [&](const auto& argument) { value_args.push_back(TypeHandler::extract_value(argument)); });
 
     Type bfront_type{TypeHandler::get_bind_front_func_type(bind_target, args)};
-    return std::make_shared<BindFrontFunction>(bfront_type, bind_target, value_args);
+    return BindFrontFunction::bind(std::move(bfront_type), bind_target, std::move(value_args));
 }
 }  // namespace OperHandler
\ No newline at end of file
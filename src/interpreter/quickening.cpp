@@ -0,0 +1,169 @@
+#include "quickening.hpp"
+
+#include <functional>
+
+#include "checked_arithmetic.hpp"
+
+namespace {
+/**
+ * @brief Specializations of one expression kind for int, float, string and bool operands.
+ */
+struct KindOps {
+    QuickenedOp int_op;
+    QuickenedOp float_op;
+    QuickenedOp string_op;
+    QuickenedOp bool_op;
+};
+
+constexpr QuickenedOp GENERIC{QuickenedOp::GENERIC};
+
+std::optional<KindOps> ops_for_kind(ExprKind kind) {
+    switch (kind) {
+        case ExprKind::ADDITION:
+            return KindOps{QuickenedOp::INT_ADD, QuickenedOp::FLOAT_ADD, QuickenedOp::STRING_CONCAT, GENERIC};
+        case ExprKind::SUBTRACTION:
+            return KindOps{QuickenedOp::INT_SUB, QuickenedOp::FLOAT_SUB, GENERIC, GENERIC};
+        case ExprKind::MULTIPICATION:
+            return KindOps{QuickenedOp::INT_MUL, QuickenedOp::FLOAT_MUL, GENERIC, GENERIC};
+        case ExprKind::DIVISION:
+            return KindOps{QuickenedOp::INT_DIV, QuickenedOp::FLOAT_DIV, GENERIC, GENERIC};
+        case ExprKind::EQUAL:
+            return KindOps{QuickenedOp::INT_EQ, QuickenedOp::FLOAT_EQ, QuickenedOp::STRING_EQ, QuickenedOp::BOOL_EQ};
+        case ExprKind::NOT_EQUAL:
+            return KindOps{QuickenedOp::INT_NEQ, QuickenedOp::FLOAT_NEQ, QuickenedOp::STRING_NEQ,
+                           QuickenedOp::BOOL_NEQ};
+        case ExprKind::LESS:
+            return KindOps{QuickenedOp::INT_LT, QuickenedOp::FLOAT_LT, QuickenedOp::STRING_LT, QuickenedOp::BOOL_LT};
+        case ExprKind::LESS_EQUAL:
+            return KindOps{QuickenedOp::INT_LTEQ, QuickenedOp::FLOAT_LTEQ, QuickenedOp::STRING_LTEQ,
+                           QuickenedOp::BOOL_LTEQ};
+        case ExprKind::GREATER:
+            return KindOps{QuickenedOp::INT_GT, QuickenedOp::FLOAT_GT, QuickenedOp::STRING_GT, QuickenedOp::BOOL_GT};
+        case ExprKind::GREATER_EQUAL:
+            return KindOps{QuickenedOp::INT_GTEQ, QuickenedOp::FLOAT_GTEQ, QuickenedOp::STRING_GTEQ,
+                           QuickenedOp::BOOL_GTEQ};
+        case ExprKind::LOGICAL_AND:
+            return KindOps{GENERIC, GENERIC, GENERIC, QuickenedOp::BOOL_AND};
+        case ExprKind::LOGICAL_OR:
+            return KindOps{GENERIC, GENERIC, GENERIC, QuickenedOp::BOOL_OR};
+        default:
+            return std::nullopt;
+    }
+}
+
+template <typename R>
+Checked<value> to_checked(R result) {
+    return {value{std::move(result)}, ArithmeticStatus::OK};
+}
+
+template <typename R>
+Checked<value> to_checked(Checked<R> result) {
+    return {value{result.value}, result.status};
+}
+
+template <typename T, typename Operation>
+std::optional<Checked<value>> apply(const value& left, const value& right, Operation operation) {
+    auto lhs = std::get_if<T>(&left);
+    auto rhs = std::get_if<T>(&right);
+    if (not(lhs and rhs)) return std::nullopt;
+    return to_checked(operation(*lhs, *rhs));
+}
+
+// comparisons built the same way as in OperHandler - from == and < only
+template <typename T>
+std::optional<Checked<value>> apply_comparison(QuickenedOp op, QuickenedOp first_of_type, const value& left,
+                                      const value& right) {
+    // order of comparison ops is the same for every type: EQ, NEQ, LT, LTEQ, GT, GTEQ
+    switch (static_cast<int>(op) - static_cast<int>(first_of_type)) {
+        case 0:
+            return apply<T>(left, right, std::equal_to<>{});
+        case 1:
+            return apply<T>(left, right, std::not_equal_to<>{});
+        case 2:
+            return apply<T>(left, right, std::less<>{});
+        case 3:
+            return apply<T>(left, right, [](const T& lhs, const T& rhs) { return not(rhs < lhs); });
+        case 4:
+            return apply<T>(left, right, [](const T& lhs, const T& rhs) { return rhs < lhs; });
+        case 5:
+            return apply<T>(left, right, [](const T& lhs, const T& rhs) { return not(lhs < rhs); });
+    }
+    return std::nullopt;
+}
+}  // namespace
+
+namespace Quickening {
+QuickenedOp select(ExprKind kind, const value& left, const value& right) {
+    auto kind_ops = ops_for_kind(kind);
+    if (not kind_ops or left.index() != right.index()) return GENERIC;
+
+    if (std::holds_alternative<int_value>(left)) return kind_ops->int_op;
+    if (std::holds_alternative<double>(left)) return kind_ops->float_op;
+    if (std::holds_alternative<StringValue>(left)) return kind_ops->string_op;
+    if (std::holds_alternative<bool>(left)) return kind_ops->bool_op;
+    return GENERIC;
+}
+
+std::optional<Checked<value>> execute(QuickenedOp op, const value& left, const value& right) {
+    switch (op) {
+        case QuickenedOp::INT_ADD:
+            return apply<int_value>(left, right, CheckedArithmetic::add<int_value>);
+        case QuickenedOp::INT_SUB:
+            return apply<int_value>(left, right, CheckedArithmetic::subtract<int_value>);
+        case QuickenedOp::INT_MUL:
+            return apply<int_value>(left, right, CheckedArithmetic::multiply<int_value>);
+        case QuickenedOp::INT_DIV:
+            return apply<int_value>(left, right, CheckedArithmetic::divide<int_value>);
+        case QuickenedOp::INT_EQ:
+        case QuickenedOp::INT_NEQ:
+        case QuickenedOp::INT_LT:
+        case QuickenedOp::INT_LTEQ:
+        case QuickenedOp::INT_GT:
+        case QuickenedOp::INT_GTEQ:
+            return apply_comparison<int_value>(op, QuickenedOp::INT_EQ, left, right);
+
+        case QuickenedOp::FLOAT_ADD:
+            return apply<double>(left, right, std::plus<>{});
+        case QuickenedOp::FLOAT_SUB:
+            return apply<double>(left, right, std::minus<>{});
+        case QuickenedOp::FLOAT_MUL:
+            return apply<double>(left, right, std::multiplies<>{});
+        case QuickenedOp::FLOAT_DIV:
+            return apply<double>(left, right, CheckedArithmetic::divide<double>);
+        case QuickenedOp::FLOAT_EQ:
+        case QuickenedOp::FLOAT_NEQ:
+        case QuickenedOp::FLOAT_LT:
+        case QuickenedOp::FLOAT_LTEQ:
+        case QuickenedOp::FLOAT_GT:
+        case QuickenedOp::FLOAT_GTEQ:
+            return apply_comparison<double>(op, QuickenedOp::FLOAT_EQ, left, right);
+
+        case QuickenedOp::STRING_CONCAT:
+            return apply<StringValue>(left, right, std::plus<>{});
+        case QuickenedOp::STRING_EQ:
+        case QuickenedOp::STRING_NEQ:
+        case QuickenedOp::STRING_LT:
+        case QuickenedOp::STRING_LTEQ:
+        case QuickenedOp::STRING_GT:
+        case QuickenedOp::STRING_GTEQ:
+            return apply_comparison<StringValue>(op, QuickenedOp::STRING_EQ, left, right);
+
+        case QuickenedOp::BOOL_AND:
+            return apply<bool>(left, right, std::logical_and<>{});
+        case QuickenedOp::BOOL_OR:
+            return apply<bool>(left, right, std::logical_or<>{});
+        case QuickenedOp::BOOL_EQ:
+        case QuickenedOp::BOOL_NEQ:
+        case QuickenedOp::BOOL_LT:
+        case QuickenedOp::BOOL_LTEQ:
+        case QuickenedOp::BOOL_GT:
+        case QuickenedOp::BOOL_GTEQ:
+            return apply_comparison<bool>(op, QuickenedOp::BOOL_EQ, left, right);
+
+        case QuickenedOp::UNQUICKENED:
+        case QuickenedOp::GENERIC:
+            return std::nullopt;
+    }
+    return std::nullopt;
+}
+}  // namespace Quickening
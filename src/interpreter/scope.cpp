@@ -2,15 +2,40 @@
 
 #include <unordered_map>
 
-std::optional<VariableHolder> Scope::get_variable(const std::string& identifier) {
-    auto it = _variables.find(identifier);
-    return it != _variables.end() ? std::make_optional(it->second) : std::nullopt;
+Scope::Scope(std::pmr::memory_resource* resource) : _inline_variables{}, _spilled_variables{resource} {}
+
+std::optional<VariableHolder> Scope::get_variable(symbol_id identifier) {
+    VariableHolder* var_holder{_find(identifier)};
+    return var_holder ? std::make_optional(*var_holder) : std::nullopt;
+}
+
+bool Scope::contains_variable(symbol_id identifier) {
+    return _find(identifier) != nullptr;
 }
 
-bool Scope::contains_variable(const std::string& identifier) {
-    return _variables.contains(identifier);
+void Scope::add_variable(symbol_id identifier, VariableHolder variable) {
+    if (VariableHolder* existing = _find(identifier)) {
+        *existing = std::move(variable);
+        return;
+    }
+    if (_inline_variables.size() < INLINE_CAPACITY and _spilled_variables.empty()) {
+        _inline_variables.emplace_back(identifier, std::move(variable));
+        return;
+    }
+    for (auto& [inline_identifier, inline_variable] : _inline_variables) {
+        _spilled_variables.emplace(inline_identifier, std::move(inline_variable));
+    }
+    _inline_variables.clear();
+    _spilled_variables.emplace(identifier, std::move(variable));
 }
 
-void Scope::add_variable(std::string identifier, VariableHolder variable) {
-    _variables[identifier] = variable;
-}
\ No newline at end of file
+VariableHolder* Scope::_find(symbol_id identifier) {
+    if (not _spilled_variables.empty()) {
+        auto it = _spilled_variables.find(identifier);
+        return it != _spilled_variables.end() ? &it->second : nullptr;
+    }
+    for (auto& [inline_identifier, variable] : _inline_variables) {
+        if (inline_identifier == identifier) return &variable;
+    }
+    return nullptr;
+}
@@ -0,0 +1,143 @@
+#include "string_value.hpp"
+
+#include <cstring>
+#include <functional>
+
+#include "mem_stats.hpp"
+
+StringValue::StringValue() noexcept : _inline_size{0} {}
+
+StringValue::StringValue(std::string text) {
+    if (text.size() <= INLINE_CAPACITY) {
+        _set_inline(text);
+    } else {
+        MemStats::SubsystemScope mem_scope{MemSubsystem::VALUES};
+        std::size_t size{text.size()};
+        new (&_shared) Shared{std::make_shared<std::string>(std::move(text)), size};
+        _inline_size = SHARED_TAG;
+    }
+}
+
+StringValue::StringValue(std::string_view text) {
+    if (text.size() <= INLINE_CAPACITY) {
+        _set_inline(text);
+    } else {
+        MemStats::SubsystemScope mem_scope{MemSubsystem::VALUES};
+        new (&_shared) Shared{std::make_shared<std::string>(text), text.size()};
+        _inline_size = SHARED_TAG;
+    }
+}
+
+StringValue::StringValue(const char* text) : StringValue{std::string_view{text}} {}
+
+StringValue::StringValue(std::shared_ptr<std::string> buffer, std::size_t size) noexcept
+    : _shared{std::move(buffer), size}, _inline_size{SHARED_TAG} {}
+
+StringValue::StringValue(const StringValue& other) noexcept : _inline_size{other._inline_size} {
+    if (other.is_inline()) {
+        std::memcpy(_inline, other._inline, _inline_size);
+    } else {
+        new (&_shared) Shared{other._shared};
+    }
+}
+
+StringValue::StringValue(StringValue&& other) noexcept : _inline_size{other._inline_size} {
+    if (other.is_inline()) {
+        std::memcpy(_inline, other._inline, _inline_size);
+    } else {
+        new (&_shared) Shared{std::move(other._shared)};
+        other._shared.~Shared();
+        other._inline_size = 0;
+    }
+}
+
+StringValue& StringValue::operator=(const StringValue& other) noexcept {
+    if (this != &other) {
+        this->~StringValue();
+        new (this) StringValue{other};
+    }
+    return *this;
+}
+
+StringValue& StringValue::operator=(StringValue&& other) noexcept {
+    if (this != &other) {
+        this->~StringValue();
+        new (this) StringValue{std::move(other)};
+    }
+    return *this;
+}
+
+StringValue::~StringValue() {
+    if (not is_inline()) _shared.~Shared();
+}
+
+std::string_view StringValue::view() const noexcept {
+    if (is_inline()) return std::string_view{_inline, _inline_size};
+    return std::string_view{_shared.buffer->data(), _shared.size};
+}
+
+std::string StringValue::str() const {
+    return std::string{view()};
+}
+
+std::size_t StringValue::size() const noexcept {
+    return is_inline() ? _inline_size : _shared.size;
+}
+
+bool StringValue::empty() const noexcept {
+    return size() == 0;
+}
+
+bool StringValue::is_inline() const noexcept {
+    return _inline_size != SHARED_TAG;
+}
+
+StringValue StringValue::concat(const StringValue& left, std::string_view right) {
+    if (right.empty()) return left;
+
+    std::size_t total_size{left.size() + right.size()};
+    if (total_size <= INLINE_CAPACITY) {
+        StringValue result{};
+        result._set_inline(left.view(), right);
+        return result;
+    }
+
+    MemStats::SubsystemScope mem_scope{MemSubsystem::VALUES};
+    if (not left.is_inline()) {
+        std::string& buffer{*left._shared.buffer};
+        bool right_in_buffer{std::less_equal<>{}(buffer.data(), right.data()) and
+                             std::less<>{}(right.data(), buffer.data() + buffer.size())};
+        if (left._shared.size == buffer.size() and not right_in_buffer) {
+            buffer.append(right);
+            return StringValue{left._shared.buffer, total_size};
+        }
+    }
+
+    // left is inline or an older prefix (or right would move with the buffer) - start a new buffer
+    auto new_buffer = std::make_shared<std::string>();
+    new_buffer->reserve(total_size);
+    new_buffer->append(left.view()).append(right);
+    return StringValue{std::move(new_buffer), total_size};
+}
+
+void StringValue::_set_inline(std::string_view first, std::string_view second) noexcept {
+    if (not first.empty()) std::memcpy(_inline, first.data(), first.size());
+    if (not second.empty()) std::memcpy(_inline + first.size(), second.data(), second.size());
+    _inline_size = static_cast<std::uint8_t>(first.size() + second.size());
+}
+
+StringValue operator+(const StringValue& left, const StringValue& right) {
+    return StringValue::concat(left, right.view());
+}
+
+bool operator==(const StringValue& left, const StringValue& right) noexcept {
+    return left.view() == right.view();
+}
+
+std::strong_ordering operator<=>(const StringValue& left, const StringValue& right) noexcept {
+    return left.view() <=> right.view();
+}
+
+std::ostream& operator<<(std::ostream& os, const StringValue& string_value) {
+    return os << string_value.view();
+}
@@ -7,16 +7,16 @@
 #include "exceptions.hpp"
 
 namespace TypeHandler {
-Type deduce_type(value val) {
+Type deduce_type(const value& val) {
     return std::visit(
         []<typename T>(const T& _val) -> Type {
-            if constexpr (std::same_as<int, T>) {
+            if constexpr (std::same_as<int_value, T>) {
                 return Type{TypeKind::INT};
             } else if constexpr (std::same_as<double, T>) {
                 return Type{TypeKind::FLOAT};
             } else if constexpr (std::same_as<bool, T>) {
                 return Type{TypeKind::BOOL};
-            } else if constexpr (std::same_as<std::string, T>) {
+            } else if constexpr (std::same_as<StringValue, T>) {
                 return Type{TypeKind::STRING};
             } else if constexpr (std::same_as<sp_callable, T>) {
                 return _val->get_type();
@@ -25,16 +25,16 @@ Type deduce_type(value val) {
         val);
 }
 
-bool args_match_params(const arg_list& args, std::vector<VariableType> param_types) {
+bool args_match_params(const arg_list& args, const std::vector<VariableType>& param_types) {
     if (args.size() != param_types.size()) return false;
 
     return std::ranges::all_of(std::views::iota(size_t{0}, args.size()),
                                [&](size_t i) { return arg_matches_param(args[i], param_types[i]); });
 }
 
-bool arg_matches_param(vhold_or_val argument, VariableType param_type) {
+bool arg_matches_param(const vhold_or_val& argument, const VariableType& param_type) {
     return std::visit(
-        [param_type]<typename T>(const T& argument) -> bool {
+        [&param_type]<typename T>(const T& argument) -> bool {
             if constexpr (std::same_as<value, T>) {
                 return deduce_type(argument) == param_type.type;
             } else if constexpr (std::same_as<VariableHolder, T>) {
@@ -54,6 +54,13 @@ vhold_or_val opt_value_to_arg(const opt_vhold_or_val& opt_v_or_vh) {
     return opt_v_or_vh.value();
 }
 
+vhold_or_val opt_value_to_arg(opt_vhold_or_val&& opt_v_or_vh) {
+    if (not opt_v_or_vh) {
+        throw ImplementationError("opt_value_to_arg should never be called before value check");
+    }
+    return std::move(opt_v_or_vh.value());
+}
+
 value extract_value(const opt_vhold_or_val& opt_v_or_vh) {
     if (not opt_v_or_vh) {
         throw ImplementationError("opt_value_to_arg should never be called before value check");
@@ -73,7 +80,24 @@ value extract_value(const vhold_or_val& v_or_vh) {
         v_or_vh);
 }
 
-std::optional<value> as_type(Type type, value val) {
+value extract_value(opt_vhold_or_val&& opt_v_or_vh) {
+    if (not opt_v_or_vh) {
+        throw ImplementationError("extract_value should never be called before value check");
+    }
+    if (auto val = std::get_if<value>(&opt_v_or_vh.value())) {
+        return std::move(*val);
+    }
+    return std::get<VariableHolder>(opt_v_or_vh.value()).var->var_value;
+}
+
+const value& value_ref(const vhold_or_val& v_or_vh) {
+    if (auto holder = std::get_if<VariableHolder>(&v_or_vh)) {
+        return holder->var->var_value;
+    }
+    return std::get<value>(v_or_vh);
+}
+
+std::optional<value> as_type(const Type& type, const value& val) {
     switch (type.kind) {
         case TypeKind::INT:
             return as_int(val);
@@ -91,13 +115,13 @@ std::optional<value> as_type(Type type, value val) {
 std::optional<value> as_string(const value& val) {
     return std::visit(
         []<typename T>(const T& val) -> std::optional<value> {
-            if constexpr (std::same_as<int, T>) {
-                return std::format("{}", val);
+            if constexpr (std::same_as<int_value, T>) {
+                return StringValue{std::format("{}", val)};
             } else if constexpr (std::same_as<double, T>) {
-                return std::format("{}", val);
+                return StringValue{std::format("{}", val)};
             } else if constexpr (std::same_as<bool, T>) {
-                return std::format("{}", val ? "true" : "false");
-            } else if constexpr (std::same_as<std::string, T>) {
+                return StringValue{val ? "true" : "false"};
+            } else if constexpr (std::same_as<StringValue, T>) {
                 return val;
             } else {
                 return std::nullopt;
@@ -109,17 +133,20 @@ std::optional<value> as_string(const value& val) {
 std::optional<value> as_int(const value& val) {
     return std::visit(
         []<typename T>(const T& val) -> std::optional<value> {
-            if constexpr (std::same_as<int, T>) {
+            if constexpr (std::same_as<int_value, T>) {
                 return val;
             } else if constexpr (std::same_as<double, T>) {
-                return (int)val;
+                // 2^63 is exactly representable, every double in [-2^63, 2^63) fits after truncation
+                constexpr double int_value_limit{9223372036854775808.0};
+                if (not(val >= -int_value_limit and val < int_value_limit)) return std::nullopt;
+                return static_cast<int_value>(val);
             } else if constexpr (std::same_as<bool, T>) {
-                return (int)val;
-            } else if constexpr (std::same_as<std::string, T>) {
+                return static_cast<int_value>(val);
+            } else if constexpr (std::same_as<StringValue, T>) {
                 try {
                     size_t idx;
-                    int i = std::stoi(val, &idx);
-                    if (idx != val.length()) return std::nullopt;
+                    int_value i = std::stoll(val.str(), &idx);
+                    if (idx != val.size()) return std::nullopt;
                     return i;
                 } catch (const std::invalid_argument&) {
                     return std::nullopt;
@@ -136,17 +163,17 @@ std::optional<value> as_int(const value& val) {
 std::optional<value> as_float(const value& val) {
     return std::visit(
         []<typename T>(const T& val) -> std::optional<value> {
-            if constexpr (std::same_as<int, T>) {
+            if constexpr (std::same_as<int_value, T>) {
                 return (double)val;
             } else if constexpr (std::same_as<double, T>) {
                 return val;
             } else if constexpr (std::same_as<bool, T>) {
                 return (double)val;
-            } else if constexpr (std::same_as<std::string, T>) {
+            } else if constexpr (std::same_as<StringValue, T>) {
                 try {
                     size_t idx;
-                    double d = std::stod(val, &idx);
-                    if (idx != val.length()) return std::nullopt;
+                    double d = std::stod(val.str(), &idx);
+                    if (idx != val.size()) return std::nullopt;
                     return d;
                 } catch (const std::invalid_argument&) {
                     return std::nullopt;
@@ -163,13 +190,13 @@ std::optional<value> as_float(const value& val) {
 std::optional<value> as_bool(const value& val) {
     return std::visit(
         []<typename T>(const T& val) -> std::optional<value> {
-            if constexpr (std::same_as<int, T>) {
+            if constexpr (std::same_as<int_value, T>) {
                 return (bool)val;
             } else if constexpr (std::same_as<double, T>) {
                 return (bool)val;
             } else if constexpr (std::same_as<bool, T>) {
                 return val;
-            } else if constexpr (std::same_as<std::string, T>) {
+            } else if constexpr (std::same_as<StringValue, T>) {
                 return not val.empty();
             } else {
                 return std::nullopt;
@@ -182,15 +209,15 @@ bool matches_return_type(const opt_vhold_or_val& ret_val, std::optional<Type> re
     if (not ret_val) {  // returning none
         return not ret_type.has_value();
     }
-    return ret_type.has_value() and deduce_type(extract_value(ret_val)) == ret_type.value();
+    return ret_type.has_value() and deduce_type(value_ref(ret_val.value())) == ret_type.value();
 }
 
-bool are_the_same_type(value lhs, value rhs) {
+bool are_the_same_type(const value& lhs, const value& rhs) {
     return std::visit([]<typename T, typename U>(const T& left, const U& right) -> bool { return std::same_as<T, U>; },
                       lhs, rhs);
 }
 
-Type get_composed_func_type(value left, value right) {
+Type get_composed_func_type(const value& left, const value& right) {
     // it was already check if both left and right are the same type
     if (not std::holds_alternative<sp_callable>(left)) {
         throw RequiredFunctionException(expr_kind_to_str(ExprKind::FUNCTION_COMPOSITION),
@@ -209,7 +236,7 @@ Type get_composed_func_type(value left, value right) {
     return Type{FunctionTypeInfo{l_ftype_info->param_types, r_ftype_info->return_type}};
 }
 
-Type get_bind_front_func_type(sp_callable bind_target, const arg_list& args) {
+Type get_bind_front_func_type(const sp_callable& bind_target, const arg_list& args) {
     auto ftype_info{bind_target->get_type().function_type_info};
     auto param_types{ftype_info->param_types};
 
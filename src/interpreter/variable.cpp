@@ -1,9 +1,12 @@
 #include "variable.hpp"
 #include <iostream>
 
-VariableHolder::VariableHolder(sp_variable var) : var{var}, can_change_var{var->type.is_mutable} {}
+Variable::Variable(VariableType type, value var_value) : type{std::move(type)}, var_value{std::move(var_value)} {}
 
-VariableHolder::VariableHolder(sp_variable var, bool can_change_var) : var{var}, can_change_var{can_change_var} {}
+VariableHolder::VariableHolder(sp_variable var) : var{std::move(var)}, can_change_var{this->var->type.is_mutable} {}
+
+VariableHolder::VariableHolder(sp_variable var, bool can_change_var)
+    : var{std::move(var)}, can_change_var{can_change_var} {}
 
 Type VariableHolder::get_type() const {
     return var->type.type;
@@ -5,11 +5,14 @@
 #include <iostream>
 #include <limits>
 
+#include "mem_stats.hpp"
+
 Lexer::Lexer(std::unique_ptr<SourceHandler> source_handler) : _source_handler{std::move(source_handler)} {
     _get_next_char();
 }
 
 Token Lexer::get_next_token() {
+    MemStats::SubsystemScope mem_scope{MemSubsystem::LEXER};
     _ignore_white_chars();
 
     if (auto it = _simple_builders_map.find(_character); it != _simple_builders_map.end()) {
@@ -23,13 +26,20 @@ Token Lexer::get_next_token() {
         return *token;
     }
 
-    throw UnexpectedCharacterException(_position, _character);
+    throw UnexpectedCharacterException(_get_position(), _character);
+}
+
+sp_source_buffer Lexer::get_source() const {
+    return _source_handler->get_buffer();
 }
 
 void Lexer::_get_next_char() {
-    std::pair char_and_position = _source_handler.get()->get_char_and_position();
-    _character = char_and_position.first;
-    _position = char_and_position.second;
+    _character = _source_handler->get_char();
+    _offset = _source_handler->get_char_offset();
+}
+
+Position Lexer::_get_position() const {
+    return _source_handler->get_position(_offset);
 }
 
 void Lexer::_ignore_white_chars() {
@@ -41,61 +51,77 @@ std::optional<Token> Lexer::_try_build_identifier_or_keyword() {
         return std::nullopt;
     }
 
-    std::string lexeme{};
-    Position token_position{_position};
+    source_offset begin{_offset};
 
     do {
-        if (lexeme.length() == MAX_IDENTIFIER_LEN) {
-            throw IdentifierTooLongException(_position);
+        if (_offset - begin == MAX_IDENTIFIER_LEN) {
+            throw IdentifierTooLongException(_get_position());
         }
 
-        lexeme += _character;
         _get_next_char();
     } while (std::isalnum(_character) or _character == '_');
 
+    std::string_view lexeme{_source_handler->slice(begin, _offset)};
+
     if (auto it = _keywords_build_map.find(lexeme); it != _keywords_build_map.end()) {
-        return it->second(token_position);
+        return it->second(begin);
     }
-    return Token{TokenType::T_IDENTIFIER, token_position, lexeme};
+    return Token{TokenType::T_IDENTIFIER, begin, lexeme};
 }
 
+/**
+ * Literals without escape sequences are returned as a view of the source. Decoded copy is built
+ * only after the first escape sequence is found and is then stored in the source buffer.
+ */
 Token Lexer::_build_literal_string() {
-    Position position{_position};
-    std::string token_value{};
+    source_offset start{_offset};
     _get_next_char();
+    source_offset begin{_offset};
+    std::size_t length{0};
+    std::optional<std::string> decoded{};
 
-    while (token_value.length() < MAX_STR_LITERAL_LEN and _character != '\"') {
+    while (length < MAX_STR_LITERAL_LEN and _character != '\"') {
         if (_character == '\n' or _character == EOF_CHAR) {
-            throw UnfinishedStringException(_position);
+            throw UnfinishedStringException(_get_position());
         }
         if (_character == '\\') {
+            if (not decoded) {
+                decoded = std::string{_source_handler->slice(begin, _offset)};
+            }
             _get_next_char();
             switch (_character) {
                 case 'n':
-                    token_value += '\n';
+                    *decoded += '\n';
                     break;
                 case 't':
-                    token_value += '\t';
+                    *decoded += '\t';
                     break;
                 case '\\':
-                    token_value += '\\';
+                    *decoded += '\\';
                     break;
                 case '\"':
-                    token_value += '\"';
+                    *decoded += '\"';
                     break;
                 default:
-                    token_value += _character;
+                    *decoded += _character;
                     break;
             }
+            ++length;
             _get_next_char();
             continue;
         }
-        token_value += _character;
+        if (decoded) {
+            *decoded += _character;
+        }
+        ++length;
         _get_next_char();
     }
+
+    std::string_view token_value{decoded ? _source_handler->store_decoded(std::move(*decoded))
+                                         : _source_handler->slice(begin, _offset)};
     _get_next_char();
 
-    return Token{TokenType::T_LITERAL_STRING, position, token_value};
+    return Token{TokenType::T_LITERAL_STRING, start, token_value};
 }
 
 std::optional<Token> Lexer::_try_build_literal_int_or_float() {
@@ -103,30 +129,30 @@ std::optional<Token> Lexer::_try_build_literal_int_or_float() {
         return std::nullopt;
     }
 
-    Position position{_position};
+    source_offset start{_offset};
     int digit{_character - '0'};
-    int integer_value{digit};
+    int_value integer_value{digit};
     _get_next_char();
 
     if (integer_value) {
         while (std::isdigit(_character)) {
-            // equivalent to token_value * 10 + digit > INT_MAX
-            if (integer_value > (std::numeric_limits<int>::max() - digit) / 10) {
-                throw ParseIntOverflowException(position);
-            }
             digit = _character - '0';
+            // equivalent to integer_value * 10 + digit > max
+            if (integer_value > (std::numeric_limits<int_value>::max() - digit) / 10) {
+                throw ParseIntOverflowException(_source_handler->get_position(start));
+            }
             integer_value = integer_value * 10 + digit;
             _get_next_char();
         }
     }
 
     if (_character != '.') {
-        return Token{TokenType::T_LITERAL_INT, position, integer_value};
+        return Token{TokenType::T_LITERAL_INT, start, integer_value};
     }
     _get_next_char();
 
     if (not std::isdigit(_character)) {
-        throw UnexpectedCharacterException(_position, _character);
+        throw UnexpectedCharacterException(_get_position(), _character);
     }
 
     uint64_t fraction_value{0};
@@ -139,21 +165,21 @@ std::optional<Token> Lexer::_try_build_literal_int_or_float() {
         digit = _character - '0';
 
         if (fraction_value > (std::numeric_limits<uint64_t>::max() - digit) / 10) {
-            throw ParseFractionRangeExceededException(position);
+            throw ParseFractionRangeExceededException(_source_handler->get_position(start));
         }
         fraction_value = fraction_value * 10 + digit;
         fraction_digits += 1;
         _get_next_char();
     }
 
-    double float_value = integer_value + ((double)fraction_value / std::pow(10.0, fraction_digits));
+    double float_value = static_cast<double>(integer_value) + ((double)fraction_value / std::pow(10.0, fraction_digits));
 
-    return Token{TokenType::T_LITERAL_FLOAT, position, float_value};
+    return Token{TokenType::T_LITERAL_FLOAT, start, float_value};
 }
 
 std::function<Token(Lexer&)> Lexer::_create_unequivocal_operator_builder(TokenType type) {
     return [type](Lexer& lexer) -> Token {
-        Token single_operator_token{type, lexer._position};
+        Token single_operator_token{type, lexer._offset};
         lexer._get_next_char();
         return single_operator_token;
     };
@@ -162,101 +188,102 @@ std::function<Token(Lexer&)> Lexer::_create_unequivocal_operator_builder(TokenTy
 std::function<Token(Lexer&)> Lexer::_create_equivocal_operator_builder(TokenType type, char lookahead_char,
                                                                        TokenType extended_type) {
     return [type, lookahead_char, extended_type](Lexer& lexer) -> Token {
-        Position position{lexer._position};
+        source_offset start{lexer._offset};
         lexer._get_next_char();
 
         if (lexer._character == lookahead_char) {
             lexer._get_next_char();
-            return Token{extended_type, position};
+            return Token{extended_type, start};
         }
-        return Token{type, position};
+        return Token{type, start};
     };
 }
 
-const std::unordered_map<std::string, std::function<Token(Position)>> Lexer::_keywords_build_map = {
+const std::unordered_map<std::string, std::function<Token(source_offset)>, Lexer::KeywordHash, std::equal_to<>>
+    Lexer::_keywords_build_map = {
     {"int",
-     [](Position pos) {
-         return Token{TokenType::T_INT, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_INT, offset};
      }},
     {"float",
-     [](Position pos) {
-         return Token{TokenType::T_FLOAT, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_FLOAT, offset};
      }},
     {"bool",
-     [](Position pos) {
-         return Token{TokenType::T_BOOL, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_BOOL, offset};
      }},
     {"string",
-     [](Position pos) {
-         return Token{TokenType::T_STRING, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_STRING, offset};
      }},
     {"function",
-     [](Position pos) {
-         return Token{TokenType::T_FUNCTION, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_FUNCTION, offset};
      }},
     {"none",
-     [](Position pos) {
-         return Token{TokenType::T_NONE, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_NONE, offset};
      }},
     {"not",
-     [](Position pos) {
-         return Token{TokenType::T_NOT, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_NOT, offset};
      }},
     {"and",
-     [](Position pos) {
-         return Token{TokenType::T_AND, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_AND, offset};
      }},
     {"or",
-     [](Position pos) {
-         return Token{TokenType::T_OR, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_OR, offset};
      }},
     {"def",
-     [](Position pos) {
-         return Token{TokenType::T_DEF, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_DEF, offset};
      }},
     {"let",
-     [](Position pos) {
-         return Token{TokenType::T_LET, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_LET, offset};
      }},
     {"mut",
-     [](Position pos) {
-         return Token{TokenType::T_MUT, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_MUT, offset};
      }},
     {"as",
-     [](Position pos) {
-         return Token{TokenType::T_AS, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_AS, offset};
      }},
     {"if",
-     [](Position pos) {
-         return Token{TokenType::T_IF, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_IF, offset};
      }},
     {"else",
-     [](Position pos) {
-         return Token{TokenType::T_ELSE, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_ELSE, offset};
      }},
     {"break",
-     [](Position pos) {
-         return Token{TokenType::T_BREAK, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_BREAK, offset};
      }},
     {"continue",
-     [](Position pos) {
-         return Token{TokenType::T_CONTINUE, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_CONTINUE, offset};
      }},
     {"return",
-     [](Position pos) {
-         return Token{TokenType::T_RETURN, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_RETURN, offset};
      }},
     {"for",
-     [](Position pos) {
-         return Token{TokenType::T_FOR, pos};
+     [](source_offset offset) {
+         return Token{TokenType::T_FOR, offset};
      }},
     {"true",
-     [](Position pos) {
-         return Token{TokenType::T_LITERAL_BOOL, pos, true};
+     [](source_offset offset) {
+         return Token{TokenType::T_LITERAL_BOOL, offset, true};
      }},
     {"false",
-     [](Position pos) {
-         return Token{TokenType::T_LITERAL_BOOL, pos, false};
+     [](source_offset offset) {
+         return Token{TokenType::T_LITERAL_BOOL, offset, false};
      }},
 };
 
@@ -280,35 +307,37 @@ const std::unordered_map<char, std::function<Token(Lexer&)>> Lexer::_simple_buil
     {'\"', [](Lexer& lexer) -> Token { return lexer._build_literal_string(); }},
     {'>',
      [](Lexer& lexer) -> Token {  // can be >, >= or >>
-         Position position{lexer._position};
+         source_offset start{lexer._offset};
          lexer._get_next_char();
 
          if (lexer._character == '=') {
              lexer._get_next_char();
-             return Token{TokenType::T_GREATER_EQUAL, position};
+             return Token{TokenType::T_GREATER_EQUAL, start};
          } else if (lexer._character == '>') {
              lexer._get_next_char();
-             return Token{TokenType::T_BIND_FRONT, position};
+             return Token{TokenType::T_BIND_FRONT, start};
          }
-         return Token{TokenType::T_GREATER, position};
+         return Token{TokenType::T_GREATER, start};
      }},
     {'!',
      [](Lexer& lexer) -> Token {
-         Position position{lexer._position};
+         source_offset start{lexer._offset};
          lexer._get_next_char();
-         if (lexer._character != '=') throw UnexpectedCharacterException(position, lexer._character);
+         if (lexer._character != '=') {
+             throw UnexpectedCharacterException(lexer._source_handler->get_position(start), lexer._character);
+         }
          lexer._get_next_char();
-         return Token{TokenType::T_NOT_EQUAL, position};
+         return Token{TokenType::T_NOT_EQUAL, start};
      }},
     {'#',
      [](Lexer& lexer) -> Token {
-         Position position{lexer._position};
-         std::string token_value{};
+         source_offset start{lexer._offset};
          lexer._get_next_char();
-         while (token_value.length() < MAX_COMMENT_LEN and lexer._character != '\n' and lexer._character != EOF_CHAR) {
-             token_value += lexer._character;
+         source_offset begin{lexer._offset};
+         while (lexer._offset - begin < MAX_COMMENT_LEN and lexer._character != '\n' and
+                lexer._character != EOF_CHAR) {
              lexer._get_next_char();
          }
-         return Token{TokenType::T_COMMENT, position, token_value};
+         return Token{TokenType::T_COMMENT, start, lexer._source_handler->slice(begin, lexer._offset)};
      }},
 };
@@ -12,6 +12,10 @@ Token LoggingLexer::get_next_token() {
     return token;
 }
 
+sp_source_buffer LoggingLexer::get_source() const {
+    return _inner->get_source();
+}
+
 void LoggingLexer::_log_token_creation(const Token& token) {
     spdlog::info("{} Created Token: {}", _log_prefix, token.repr());
 }
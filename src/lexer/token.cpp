@@ -5,12 +5,12 @@
 #include <typeindex>
 
 using namespace tkm;
-Token::Token(TokenType type, Position position) : Token(type, position, std::monostate{}) {}
+Token::Token(TokenType type, source_offset offset) : Token(type, offset, std::monostate{}) {}
 
-Token::Token(TokenType type, Position position, optional_token_value value) {
+Token::Token(TokenType type, source_offset offset, optional_token_value value) {
     _validate_token(type, value);
     _type = type;
-    _position = position;
+    _offset = offset;
     _value = value;
 }
 
@@ -18,12 +18,12 @@ TokenType Token::get_type() const noexcept {
     return _type;
 }
 
-Position Token::get_position() const noexcept {
-    return _position;
+source_offset Token::get_offset() const noexcept {
+    return _offset;
 }
 
 std::string Token::repr() const {
-    std::string repr{std::string("Token(") + type_to_str(_type) + "," + _position.repr()};
+    std::string repr{std::string("Token(") + type_to_str(_type) + ",Offset(" + std::to_string(_offset) + ")"};
     if (not std::holds_alternative<std::monostate>(_value)) {
         repr += "," + _stringify_value();
     }
@@ -38,7 +38,7 @@ std::ostream& operator<<(std::ostream& os, const Token& token) {
 std::string Token::_stringify_value() const {
     return std::visit(
         []<typename T>(const T& value) -> std::string {
-            if constexpr (std::same_as<std::string, T>) {
+            if constexpr (std::same_as<std::string_view, T>) {
                 return std::format(R"("{}")", value);
             } else if constexpr (std::same_as<std::monostate, T>) {
                 throw ImplementationError("error in Token::stringify_value after validation");
@@ -52,7 +52,7 @@ std::string Token::_stringify_value() const {
 void Token::_validate_token(const TokenType& type, const optional_token_value& value) {
     switch (type) {
         case TokenType::T_LITERAL_INT:
-            if (std::holds_alternative<int>(value)) return;
+            if (std::holds_alternative<int_value>(value)) return;
             break;
         case TokenType::T_LITERAL_FLOAT:
             if (std::holds_alternative<double>(value)) return;
@@ -63,7 +63,7 @@ void Token::_validate_token(const TokenType& type, const optional_token_value& v
         case TokenType::T_IDENTIFIER:
         case TokenType::T_COMMENT:
         case TokenType::T_LITERAL_STRING:
-            if (std::holds_alternative<std::string>(value)) return;
+            if (std::holds_alternative<std::string_view>(value)) return;
             break;
         default:
             if (std::holds_alternative<std::monostate>(value)) return;
@@ -0,0 +1,86 @@
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "mem_stats.hpp"
+
+// Global operator new/delete replacement counting allocations for --mem-stats. Each block carries a small header
+// with its size and subsystem, so frees are attributed to the subsystem that allocated them.
+
+namespace {
+struct AllocationHeader {
+    std::size_t size;
+    MemSubsystem subsystem;
+};
+constexpr std::size_t HEADER_SIZE{alignof(std::max_align_t)};
+static_assert(sizeof(AllocationHeader) <= HEADER_SIZE);
+
+const bool hook_registered{MemStats::hook_installed = true};
+
+void* allocate(std::size_t size) {
+    void* block{std::malloc(size + HEADER_SIZE)};
+    if (not block) throw std::bad_alloc();
+
+    MemSubsystem subsystem{MemStats::current_subsystem};
+    new (block) AllocationHeader{size, subsystem};
+    MemStats::record_allocation(subsystem, size);
+    return static_cast<std::byte*>(block) + HEADER_SIZE;
+}
+
+void deallocate(void* ptr) noexcept {
+    if (not ptr) return;
+    void* block{static_cast<std::byte*>(ptr) - HEADER_SIZE};
+    auto header{static_cast<AllocationHeader*>(block)};
+    MemStats::record_deallocation(header->subsystem, header->size);
+    std::free(block);
+}
+}  // namespace
+
+void* operator new(std::size_t size) {
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return allocate(size);
+}
+
+// nothrow forms are defined here too - blocks they return are freed by the replaced deletes, which expect a header
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocate(size);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocate(size);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* ptr) noexcept {
+    deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    deallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    deallocate(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    deallocate(ptr);
+}
@@ -5,13 +5,13 @@
 /* -----------------------------------------------------------------------------*
  *                               BASE - EXPRESSION                              *
  *------------------------------------------------------------------------------*/
-Expression::Expression(const Position& position, ExprKind kind) : Node{position}, kind{kind} {}
+Expression::Expression(source_offset offset, ExprKind kind) : Node{offset}, kind{kind} {}
 
 /* -----------------------------------------------------------------------------*
  *                               BINARY_EXPRESSION                              *
  *------------------------------------------------------------------------------*/
 BinaryExpression::BinaryExpression(ExprKind kind, up_expression left, up_expression right)
-    : Expression{left->position, kind}, left{std::move(left)}, right{std::move(right)} {}
+    : Expression{left->offset, kind}, left{std::move(left)}, right{std::move(right)}, quickened{0} {}
 
 void BinaryExpression::accept(Visitor& visitor) const {
     visitor.visit(*this);
@@ -42,8 +42,8 @@ std::unique_ptr<BinaryExpression> BinaryExpression::create(ExprKind kind, up_exp
 /* -----------------------------------------------------------------------------*
  *                               UNARY_EXPRESSION                               *
  *------------------------------------------------------------------------------*/
-UnaryExpression::UnaryExpression(const Position& position, ExprKind kind, up_expression expr)
-    : Expression{position, kind}, expr{std::move(expr)} {}
+UnaryExpression::UnaryExpression(source_offset offset, ExprKind kind, up_expression expr)
+    : Expression{offset, kind}, expr{std::move(expr)} {}
 
 void UnaryExpression::accept(Visitor& visitor) const {
     visitor.visit(*this);
@@ -54,26 +54,27 @@ const std::unordered_set<ExprKind> UnaryExpression::unary_kinds = {
     ExprKind::UNARY_MINUS,
 };
 
-std::unique_ptr<UnaryExpression> UnaryExpression::create(const Position& position, ExprKind kind, up_expression expr) {
+std::unique_ptr<UnaryExpression> UnaryExpression::create(source_offset offset, ExprKind kind, up_expression expr) {
     if (not unary_kinds.contains(kind))
         throw std::logic_error("invalid expr kind");  // TODO: replace with custom exception
-    return std::make_unique<UnaryExpression>(position, kind, std::move(expr));
+    return std::make_unique<UnaryExpression>(offset, kind, std::move(expr));
 }
 
 /* -----------------------------------------------------------------------------*
  *                          FUNCTION_CALL AND BIND_FRONT                        *
  *------------------------------------------------------------------------------*/
 FunctionCall::FunctionCall(up_expression callee, up_expression_vec argument_list)
-    : Expression{callee->position, ExprKind::FUNCTION_CALL},
+    : Expression{callee->offset, ExprKind::FUNCTION_CALL},
       callee{std::move(callee)},
-      argument_list{std::move(argument_list)} {}
+      argument_list{std::move(argument_list)},
+      call_cache{nullptr} {}
 
 void FunctionCall::accept(Visitor& visitor) const {
     visitor.visit(*this);
 }
 
-BindFront::BindFront(const Position& position, up_expression_vec argument_list, up_expression target)
-    : Expression{position, ExprKind::BIND_FRONT}, argument_list{std::move(argument_list)}, target{std::move(target)} {}
+BindFront::BindFront(source_offset offset, up_expression_vec argument_list, up_expression target)
+    : Expression{offset, ExprKind::BIND_FRONT}, argument_list{std::move(argument_list)}, target{std::move(target)} {}
 
 void BindFront::accept(Visitor& visitor) const {
     visitor.visit(*this);
@@ -82,7 +83,7 @@ void BindFront::accept(Visitor& visitor) const {
  *                          TYPE_CAST_EXPRESSION                          *
  *------------------------------------------------------------------------------*/
 TypeCastExpression::TypeCastExpression(up_expression expr, Type target_type)
-    : Expression{expr->position, ExprKind::TYPE_CAST}, expr{std::move(expr)}, target_type{target_type} {}
+    : Expression{expr->offset, ExprKind::TYPE_CAST}, expr{std::move(expr)}, target_type{target_type} {}
 
 void TypeCastExpression::accept(Visitor& visitor) const {
     visitor.visit(*this);
@@ -91,8 +92,8 @@ void TypeCastExpression::accept(Visitor& visitor) const {
 /* -----------------------------------------------------------------------------*
  *                                 IDENTIFIER                                   *
  *------------------------------------------------------------------------------*/
-Identifier::Identifier(const Position& position, std::string name)
-    : Expression{position, ExprKind::IDENTIFIER}, name{name} {}
+Identifier::Identifier(source_offset offset, std::string name)
+    : Expression{offset, ExprKind::IDENTIFIER}, name{name}, symbol{Symbols::intern(this->name)} {}
 
 void Identifier::accept(Visitor& visitor) const {
     visitor.visit(*this);
@@ -101,29 +102,29 @@ void Identifier::accept(Visitor& visitor) const {
 /* -----------------------------------------------------------------------------*
  *                                  LITERALS                                    *
  *------------------------------------------------------------------------------*/
-LiteralInt::LiteralInt(const Position& position, int value)
-    : Expression{position, ExprKind::LITERAL}, type{TypeKind::INT}, value{value} {}
+LiteralInt::LiteralInt(source_offset offset, int_value value)
+    : Expression{offset, ExprKind::LITERAL}, type{TypeKind::INT}, value{value} {}
 
 void LiteralInt::accept(Visitor& visitor) const {
     visitor.visit(*this);
 }
 
-LiteralFloat::LiteralFloat(const Position& position, double value)
-    : Expression{position, ExprKind::LITERAL}, type{TypeKind::FLOAT}, value{value} {}
+LiteralFloat::LiteralFloat(source_offset offset, double value)
+    : Expression{offset, ExprKind::LITERAL}, type{TypeKind::FLOAT}, value{value} {}
 
 void LiteralFloat::accept(Visitor& visitor) const {
     visitor.visit(*this);
 }
 
-LiteralString::LiteralString(const Position& position, std::string value)
-    : Expression{position, ExprKind::LITERAL}, type{TypeKind::STRING}, value{value} {}
+LiteralString::LiteralString(source_offset offset, std::string_view value)
+    : Expression{offset, ExprKind::LITERAL}, type{TypeKind::STRING}, value{value} {}
 
 void LiteralString::accept(Visitor& visitor) const {
     visitor.visit(*this);
 }
 
-LiteralBool::LiteralBool(const Position& position, bool value)
-    : Expression{position, ExprKind::LITERAL}, type{TypeKind::BOOL}, value{value} {}
+LiteralBool::LiteralBool(source_offset offset, bool value)
+    : Expression{offset, ExprKind::LITERAL}, type{TypeKind::BOOL}, value{value} {}
 
 void LiteralBool::accept(Visitor& visitor) const {
     visitor.visit(*this);
@@ -0,0 +1,339 @@
+#include "flat_ast.hpp"
+
+#include "statement.hpp"
+#include "typed_identifier.hpp"
+#include "visitor.hpp"
+
+namespace {
+/**
+ * @brief Visitor that appends visited nodes to @ref FlatAst. Index of the last added node is in _last.
+ */
+class FlatAstBuilder : public Visitor {
+   public:
+    explicit FlatAstBuilder(FlatAst& ast) : _ast{ast} {}
+
+    void visit(const Program& program) override {
+        _ast.offset = program.offset;
+        _ast.source = program.source;
+        std::vector<node_index> function_definitions{};
+        for (const auto& fun_def : program.function_definitions) {
+            function_definitions.push_back(_build(*fun_def));
+        }
+        _ast.function_definitions = _add_list(function_definitions);
+    }
+
+    void visit(const ContinueStatement& continue_stmnt) override {
+        _last = _add_node(FlatKind::CONTINUE, continue_stmnt.offset, 0);
+    }
+
+    void visit(const BreakStatement& break_stmnt) override {
+        _last = _add_node(FlatKind::BREAK, break_stmnt.offset, 0);
+    }
+
+    void visit(const ReturnStatement& return_stmnt) override {
+        node_index expr{return_stmnt.expression ? _build(*return_stmnt.expression) : NO_NODE};
+        _last = _add_record(_ast.returns, FlatKind::RETURN, return_stmnt.offset, FlatReturn{expr});
+    }
+
+    void visit(const VariableDeclaration& var_decl) override {
+        node_index typed_identifier{_build(*var_decl.typed_identifier)};
+        node_index expr{_build(*var_decl.assigned_expression)};
+        _last = _add_record(_ast.variable_declarations, FlatKind::VARIABLE_DECLARATION, var_decl.offset,
+                            FlatVariableDeclaration{typed_identifier, expr});
+    }
+
+    void visit(const CodeBlock& code_block) override {
+        NodeRange statements{_build_list(code_block.statements)};
+        _last = _add_record(_ast.code_blocks, FlatKind::CODE_BLOCK, code_block.offset, FlatCodeBlock{statements});
+    }
+
+    void visit(const IfStatement& if_stmnt) override {
+        node_index condition{_build(*if_stmnt.condition)};
+        node_index body{_build(*if_stmnt.body)};
+        NodeRange else_ifs{_build_list(if_stmnt.else_ifs)};
+        node_index else_body{if_stmnt.else_body ? _build(*if_stmnt.else_body) : NO_NODE};
+        _last = _add_record(_ast.ifs, FlatKind::IF, if_stmnt.offset, FlatIf{condition, body, else_ifs, else_body});
+    }
+
+    void visit(const ElseIf& else_if) override {
+        node_index condition{_build(*else_if.condition)};
+        node_index body{_build(*else_if.body)};
+        _last = _add_record(_ast.else_ifs, FlatKind::ELSE_IF, else_if.offset, FlatElseIf{condition, body});
+    }
+
+    void visit(const AssignStatement& asgn_stmnt) override {
+        node_index expr{_build(*asgn_stmnt.expr)};
+        _last = _add_record(_ast.assigns, FlatKind::ASSIGN, asgn_stmnt.offset,
+                            FlatAssign{_add_name(asgn_stmnt.identifier), expr});
+    }
+
+    void visit(const ExpressionStatement& expr_stmnt) override {
+        node_index expr{_build(*expr_stmnt.expr)};
+        _last = _add_record(_ast.expression_statements, FlatKind::EXPRESSION_STATEMENT, expr_stmnt.offset,
+                            FlatExpressionStatement{expr});
+    }
+
+    void visit(const FunctionDefinition& func_def) override {
+        node_index signature{_build(*func_def.signature)};
+        node_index body{_build(*func_def.body)};
+        if (_ast.sources.empty() or _ast.sources.back() != func_def.source) {
+            _ast.sources.push_back(func_def.source);
+        }
+        std::uint32_t source{static_cast<std::uint32_t>(_ast.sources.size() - 1)};
+        _last = _add_record(_ast.function_definition_records, FlatKind::FUNCTION_DEFINITION, func_def.offset,
+                            FlatFunctionDefinition{signature, body, source});
+    }
+
+    void visit(const FunctionSignature& func_sig) override {
+        NodeRange params{_build_list(func_sig.params)};
+        std::uint32_t type{_add_value(_ast.types, func_sig.type)};
+        _last = _add_record(_ast.function_signatures, FlatKind::FUNCTION_SIGNATURE, func_sig.offset,
+                            FlatFunctionSignature{_add_name(func_sig.identifier), type, params});
+    }
+
+    void visit(const ForLoop& for_loop) override {
+        node_index var_declaration{_build(*for_loop.var_declaration)};
+        node_index condition{_build(*for_loop.condition)};
+        node_index loop_update{_build(*for_loop.loop_update)};
+        node_index body{_build(*for_loop.body)};
+        _last = _add_record(_ast.for_loops, FlatKind::FOR_LOOP, for_loop.offset,
+                            FlatForLoop{var_declaration, condition, loop_update, body});
+    }
+
+    void visit(const BinaryExpression& binary_expr) override {
+        node_index left{_build(*binary_expr.left)};
+        node_index right{_build(*binary_expr.right)};
+        _last = _add_record(_ast.binaries, FlatKind::BINARY, binary_expr.offset,
+                            FlatBinary{binary_expr.kind, left, right});
+    }
+
+    void visit(const UnaryExpression& unary_expr) override {
+        node_index expr{_build(*unary_expr.expr)};
+        _last = _add_record(_ast.unaries, FlatKind::UNARY, unary_expr.offset, FlatUnary{unary_expr.kind, expr});
+    }
+
+    void visit(const FunctionCall& func_call_expr) override {
+        node_index callee{_build(*func_call_expr.callee)};
+        NodeRange arguments{_build_list(func_call_expr.argument_list)};
+        _last = _add_record(_ast.function_calls, FlatKind::FUNCTION_CALL, func_call_expr.offset,
+                            FlatFunctionCall{callee, arguments});
+    }
+
+    void visit(const BindFront& bind_front_expr) override {
+        NodeRange arguments{_build_list(bind_front_expr.argument_list)};
+        node_index target{_build(*bind_front_expr.target)};
+        _last = _add_record(_ast.bind_fronts, FlatKind::BIND_FRONT, bind_front_expr.offset,
+                            FlatBindFront{arguments, target});
+    }
+
+    void visit(const TypeCastExpression& type_cast_expr) override {
+        node_index expr{_build(*type_cast_expr.expr)};
+        std::uint32_t type{_add_value(_ast.types, type_cast_expr.target_type)};
+        _last = _add_record(_ast.type_casts, FlatKind::TYPE_CAST, type_cast_expr.offset, FlatTypeCast{expr, type});
+    }
+
+    void visit(const Identifier& identifier) override {
+        _last = _add_record(_ast.identifiers, FlatKind::IDENTIFIER, identifier.offset,
+                            FlatIdentifier{_add_name(identifier.name)});
+    }
+
+    void visit(const LiteralInt& literal_int) override {
+        _last = _add_record(_ast.ints, FlatKind::LITERAL_INT, literal_int.offset, literal_int.value);
+    }
+
+    void visit(const LiteralFloat& literal_float) override {
+        _last = _add_record(_ast.floats, FlatKind::LITERAL_FLOAT, literal_float.offset, literal_float.value);
+    }
+
+    void visit(const LiteralString& literal_string) override {
+        _last = _add_record(_ast.strings, FlatKind::LITERAL_STRING, literal_string.offset, literal_string.value);
+    }
+
+    void visit(const LiteralBool& literal_bool) override {
+        _last = _add_node(FlatKind::LITERAL_BOOL, literal_bool.offset, literal_bool.value ? 1 : 0);
+    }
+
+    void visit(const TypedIdentifier& typed_ident) override {
+        std::uint32_t variable_type{_add_value(_ast.variable_types, typed_ident.type)};
+        _last = _add_record(_ast.typed_identifiers, FlatKind::TYPED_IDENTIFIER, typed_ident.offset,
+                            FlatTypedIdentifier{_add_name(typed_ident.name), variable_type});
+    }
+
+   private:
+    FlatAst& _ast;
+    node_index _last{NO_NODE};
+
+    node_index _build(const Node& node) {
+        node.accept(*this);
+        return _last;
+    }
+
+    template <typename UpNodeVec>
+    NodeRange _build_list(const UpNodeVec& up_nodes) {
+        std::vector<node_index> indices{};
+        indices.reserve(up_nodes.size());
+        for (const auto& up_node : up_nodes) {
+            indices.push_back(_build(*up_node));
+        }
+        return _add_list(indices);
+    }
+
+    // children are collected first - building them appends their own lists in between
+    NodeRange _add_list(const std::vector<node_index>& indices) {
+        NodeRange range{static_cast<std::uint32_t>(_ast.lists.size()), static_cast<std::uint32_t>(indices.size())};
+        _ast.lists.insert(_ast.lists.end(), indices.begin(), indices.end());
+        return range;
+    }
+
+    node_index _add_node(FlatKind kind, source_offset offset, std::uint32_t data) {
+        _ast.nodes.push_back(FlatNode{offset, kind, data});
+        return static_cast<node_index>(_ast.nodes.size() - 1);
+    }
+
+    template <typename T>
+    static std::uint32_t _add_value(std::vector<T>& values, T value) {
+        values.push_back(std::move(value));
+        return static_cast<std::uint32_t>(values.size() - 1);
+    }
+
+    template <typename T>
+    node_index _add_record(std::vector<T>& records, FlatKind kind, source_offset offset, T record) {
+        return _add_node(kind, offset, _add_value(records, std::move(record)));
+    }
+
+    std::uint32_t _add_name(const std::string& name) {
+        return _add_value(_ast.names, name);
+    }
+};
+
+/**
+ * @brief Rebuilds pointer tree nodes from @ref FlatAst.
+ */
+class ProgramRebuilder {
+   public:
+    explicit ProgramRebuilder(const FlatAst& ast) : _ast{ast} {}
+
+    template <typename NodeT>
+    std::unique_ptr<NodeT> build(node_index index) const {
+        if (index == NO_NODE) {
+            return nullptr;
+        }
+        std::unique_ptr<Node> node{_ast.dispatch(index, [this](const FlatNode& flat_node, const auto& record) {
+            return _build_node(flat_node, record);
+        })};
+        return std::unique_ptr<NodeT>{static_cast<NodeT*>(node.release())};
+    }
+
+    template <typename NodeT>
+    std::vector<std::unique_ptr<NodeT>> build_list(NodeRange range) const {
+        std::vector<std::unique_ptr<NodeT>> up_nodes{};
+        up_nodes.reserve(range.count);
+        for (node_index index : _ast.children(range)) {
+            up_nodes.push_back(build<NodeT>(index));
+        }
+        return up_nodes;
+    }
+
+   private:
+    const FlatAst& _ast;
+
+    std::unique_ptr<Node> _build_node(const FlatNode& node, const FlatFunctionDefinition& record) const {
+        return std::make_unique<FunctionDefinition>(build<FunctionSignature>(record.signature),
+                                                    build<Statement>(record.body), _ast.sources[record.source]);
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, const FlatFunctionSignature& record) const {
+        return std::make_unique<FunctionSignature>(node.offset, _ast.names[record.name],
+                                                   build_list<TypedIdentifier>(record.params),
+                                                   _ast.types[record.type].function_type_info->return_type);
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, const FlatTypedIdentifier& record) const {
+        return std::make_unique<TypedIdentifier>(node.offset, _ast.names[record.name],
+                                                 _ast.variable_types[record.variable_type]);
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, FlatContinue) const {
+        return std::make_unique<ContinueStatement>(node.offset);
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, FlatBreak) const {
+        return std::make_unique<BreakStatement>(node.offset);
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, const FlatReturn& record) const {
+        return std::make_unique<ReturnStatement>(node.offset, build<Expression>(record.expr));
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, const FlatVariableDeclaration& record) const {
+        return std::make_unique<VariableDeclaration>(node.offset, build<TypedIdentifier>(record.typed_identifier),
+                                                     build<Expression>(record.expr));
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, const FlatCodeBlock& record) const {
+        return std::make_unique<CodeBlock>(node.offset, build_list<Statement>(record.statements));
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, const FlatIf& record) const {
+        return std::make_unique<IfStatement>(node.offset, build<Expression>(record.condition),
+                                             build<Statement>(record.body), build_list<ElseIf>(record.else_ifs),
+                                             build<Statement>(record.else_body));
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, const FlatElseIf& record) const {
+        return std::make_unique<ElseIf>(node.offset, build<Expression>(record.condition),
+                                        build<Statement>(record.body));
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, const FlatAssign& record) const {
+        return std::make_unique<AssignStatement>(node.offset, _ast.names[record.name], build<Expression>(record.expr));
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, const FlatExpressionStatement& record) const {
+        return std::make_unique<ExpressionStatement>(build<Expression>(record.expr));
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, const FlatForLoop& record) const {
+        return std::make_unique<ForLoop>(node.offset, build<Statement>(record.var_declaration),
+                                         build<Expression>(record.condition), build<Statement>(record.loop_update),
+                                         build<Statement>(record.body));
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, const FlatBinary& record) const {
+        return std::make_unique<BinaryExpression>(record.kind, build<Expression>(record.left),
+                                                  build<Expression>(record.right));
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, const FlatUnary& record) const {
+        return std::make_unique<UnaryExpression>(node.offset, record.kind, build<Expression>(record.expr));
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, const FlatFunctionCall& record) const {
+        return std::make_unique<FunctionCall>(build<Expression>(record.callee),
+                                              build_list<Expression>(record.arguments));
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, const FlatBindFront& record) const {
+        return std::make_unique<BindFront>(node.offset, build_list<Expression>(record.arguments),
+                                           build<Expression>(record.target));
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, const FlatTypeCast& record) const {
+        return std::make_unique<TypeCastExpression>(build<Expression>(record.expr), _ast.types[record.type]);
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, const FlatIdentifier& record) const {
+        return std::make_unique<Identifier>(node.offset, _ast.names[record.name]);
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, int_value value) const {
+        return std::make_unique<LiteralInt>(node.offset, value);
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, double value) const {
+        return std::make_unique<LiteralFloat>(node.offset, value);
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, std::string_view value) const {
+        return std::make_unique<LiteralString>(node.offset, value);
+    }
+    std::unique_ptr<Node> _build_node(const FlatNode& node, bool value) const {
+        return std::make_unique<LiteralBool>(node.offset, value);
+    }
+};
+}  // namespace
+
+FlatAst FlatAst::from_program(const Program& program) {
+    FlatAst ast{};
+    FlatAstBuilder builder{ast};
+    program.accept(builder);
+    return ast;
+}
+
+std::unique_ptr<Program> FlatAst::to_program() const {
+    ProgramRebuilder rebuilder{*this};
+    return std::make_unique<Program>(offset, rebuilder.build_list<FunctionDefinition>(function_definitions), source);
+}
+
+std::span<const node_index> FlatAst::children(NodeRange range) const {
+    return std::span<const node_index>{lists}.subspan(range.first, range.count);
+}
@@ -0,0 +1,243 @@
+#include "incremental_parser.hpp"
+
+#include <algorithm>
+
+#include "lexer.hpp"
+#include "parser.hpp"
+#include "statement.hpp"
+#include "typed_identifier.hpp"
+
+namespace {
+/**
+ * @brief Moves every node of reused definition by given number of bytes.
+ *
+ * Tree is owned by @ref IncrementalParser - nodes are not const objects, only visited as such.
+ */
+class OffsetShifter : public Visitor {
+   public:
+    explicit OffsetShifter(std::int64_t offset_delta) : _offset_delta{offset_delta} {}
+
+    void visit(const Program& program) override {}
+    void visit(const ContinueStatement& continue_stmnt) override {
+        _shift(continue_stmnt);
+    }
+    void visit(const BreakStatement& break_stmnt) override {
+        _shift(break_stmnt);
+    }
+    void visit(const ReturnStatement& return_stmnt) override {
+        _shift(return_stmnt);
+        _shift_child(return_stmnt.expression);
+    }
+    void visit(const VariableDeclaration& var_decl) override {
+        _shift(var_decl);
+        _shift_child(var_decl.typed_identifier);
+        _shift_child(var_decl.assigned_expression);
+    }
+    void visit(const CodeBlock& code_block) override {
+        _shift(code_block);
+        std::ranges::for_each(code_block.statements, [this](const auto& stmnt) { _shift_child(stmnt); });
+    }
+    void visit(const IfStatement& if_stmnt) override {
+        _shift(if_stmnt);
+        _shift_child(if_stmnt.condition);
+        _shift_child(if_stmnt.body);
+        std::ranges::for_each(if_stmnt.else_ifs, [this](const auto& else_if) { _shift_child(else_if); });
+        _shift_child(if_stmnt.else_body);
+    }
+    void visit(const ElseIf& else_if) override {
+        _shift(else_if);
+        _shift_child(else_if.condition);
+        _shift_child(else_if.body);
+    }
+    void visit(const AssignStatement& asgn_stmnt) override {
+        _shift(asgn_stmnt);
+        _shift_child(asgn_stmnt.expr);
+    }
+    void visit(const ExpressionStatement& expr_stmnt) override {
+        _shift(expr_stmnt);
+        _shift_child(expr_stmnt.expr);
+    }
+    void visit(const FunctionDefinition& func_def) override {
+        _shift(func_def);
+        _shift_child(func_def.signature);
+        _shift_child(func_def.body);
+    }
+    void visit(const FunctionSignature& func_sig) override {
+        _shift(func_sig);
+        std::ranges::for_each(func_sig.params, [this](const auto& param) { _shift_child(param); });
+    }
+    void visit(const ForLoop& for_loop) override {
+        _shift(for_loop);
+        _shift_child(for_loop.var_declaration);
+        _shift_child(for_loop.condition);
+        _shift_child(for_loop.loop_update);
+        _shift_child(for_loop.body);
+    }
+    void visit(const BinaryExpression& binary_expr) override {
+        _shift(binary_expr);
+        _shift_child(binary_expr.left);
+        _shift_child(binary_expr.right);
+    }
+    void visit(const UnaryExpression& unary_expr) override {
+        _shift(unary_expr);
+        _shift_child(unary_expr.expr);
+    }
+    void visit(const FunctionCall& func_call_expr) override {
+        _shift(func_call_expr);
+        _shift_child(func_call_expr.callee);
+        std::ranges::for_each(func_call_expr.argument_list, [this](const auto& arg) { _shift_child(arg); });
+    }
+    void visit(const BindFront& bind_front_expr) override {
+        _shift(bind_front_expr);
+        std::ranges::for_each(bind_front_expr.argument_list, [this](const auto& arg) { _shift_child(arg); });
+        _shift_child(bind_front_expr.target);
+    }
+    void visit(const TypeCastExpression& type_cast_expr) override {
+        _shift(type_cast_expr);
+        _shift_child(type_cast_expr.expr);
+    }
+    void visit(const Identifier& identifier) override {
+        _shift(identifier);
+    }
+    void visit(const LiteralInt& literal_int) override {
+        _shift(literal_int);
+    }
+    void visit(const LiteralFloat& literal_float) override {
+        _shift(literal_float);
+    }
+    void visit(const LiteralString& literal_string) override {
+        _shift(literal_string);
+    }
+    void visit(const LiteralBool& literal_bool) override {
+        _shift(literal_bool);
+    }
+    void visit(const TypedIdentifier& typed_ident) override {
+        _shift(typed_ident);
+    }
+
+   private:
+    std::int64_t _offset_delta;
+
+    void _shift(const Node& node) {
+        source_offset& offset{const_cast<Node&>(node).offset};
+        offset = static_cast<source_offset>(offset + _offset_delta);
+    }
+
+    template <typename UpNode>
+    void _shift_child(const UpNode& child) {
+        if (child) child->accept(*this);
+    }
+};
+}  // namespace
+
+TextEdit TextEdit::diff(std::string_view old_text, std::string_view new_text) {
+    std::size_t prefix{0};
+    std::size_t max_common{std::min(old_text.size(), new_text.size())};
+    while (prefix < max_common and old_text[prefix] == new_text[prefix]) ++prefix;
+
+    std::size_t suffix{0};
+    while (suffix < max_common - prefix and
+           old_text[old_text.size() - 1 - suffix] == new_text[new_text.size() - 1 - suffix]) {
+        ++suffix;
+    }
+
+    return TextEdit{static_cast<source_offset>(prefix), static_cast<source_offset>(old_text.size() - suffix),
+                    std::string{new_text.substr(prefix, new_text.size() - suffix - prefix)}};
+}
+
+IncrementalParser::IncrementalParser(std::string text)
+    : _buffer{std::make_shared<SourceBuffer>(std::move(text))}, _reparsed_count{0}, _needs_full_parse{true} {
+    _parse_all();
+}
+
+const Program& IncrementalParser::get_program() const noexcept {
+    return *_program;
+}
+
+const std::string& IncrementalParser::get_text() const noexcept {
+    return _buffer->text;
+}
+
+std::size_t IncrementalParser::get_reparsed_count() const noexcept {
+    return _reparsed_count;
+}
+
+void IncrementalParser::apply_edit(const TextEdit& edit) {
+    const std::string& old_text{_buffer->text};
+    std::string new_text{old_text.substr(0, edit.begin) + edit.replacement + old_text.substr(edit.end)};
+    _buffer = std::make_shared<SourceBuffer>(std::move(new_text));
+
+    if (_needs_full_parse or _function_starts.empty()) {
+        _parse_all();
+        return;
+    }
+
+    // definitions touched by the edit
+    std::size_t functions_count{_function_starts.size()};
+    std::size_t first{0};
+    while (first + 1 < functions_count and _function_starts[first + 1] < edit.begin) ++first;
+    std::size_t last{first};
+    while (last + 1 < functions_count and _span_begin(last + 1) <= edit.end) ++last;
+
+    std::int64_t offset_delta{static_cast<std::int64_t>(edit.replacement.size()) -
+                              static_cast<std::int64_t>(edit.end - edit.begin)};
+    source_offset range_begin{_span_begin(first)};
+    source_offset range_end{last + 1 < functions_count
+                                ? static_cast<source_offset>(_function_starts[last + 1] + offset_delta)
+                                : static_cast<source_offset>(_buffer->text.size())};
+
+    std::unique_ptr<Program> reparsed_program{};
+    try {
+        reparsed_program = _parse_range(range_begin, range_end);
+    } catch (...) {
+        _needs_full_parse = true;
+        throw;
+    }
+    up_fun_def_vec& reparsed{reparsed_program->function_definitions};
+
+    std::vector<source_offset> reparsed_starts{};
+    for (const auto& fun_def : reparsed) {
+        reparsed_starts.push_back(fun_def->offset);
+    }
+
+    OffsetShifter shifter{offset_delta};
+    for (std::size_t i = last + 1; i < functions_count; ++i) {
+        _function_starts[i] = static_cast<source_offset>(_function_starts[i] + offset_delta);
+        if (offset_delta != 0) _program->function_definitions[i]->accept(shifter);
+    }
+
+    auto& definitions = _program->function_definitions;
+    definitions.erase(definitions.begin() + first, definitions.begin() + last + 1);
+    definitions.insert(definitions.begin() + first, std::make_move_iterator(reparsed.begin()),
+                       std::make_move_iterator(reparsed.end()));
+    _function_starts.erase(_function_starts.begin() + first, _function_starts.begin() + last + 1);
+    _function_starts.insert(_function_starts.begin() + first, reparsed_starts.begin(), reparsed_starts.end());
+
+    if (first == 0) {
+        _program->offset = definitions.empty() ? reparsed_program->offset : definitions.front()->offset;
+    }
+    _program->source = _buffer;
+    _reparsed_count = reparsed.size();
+}
+
+void IncrementalParser::_parse_all() {
+    _needs_full_parse = true;
+    _program = _parse_range(0, static_cast<source_offset>(_buffer->text.size()));
+
+    _function_starts.clear();
+    for (const auto& fun_def : _program->function_definitions) {
+        _function_starts.push_back(fun_def->offset);
+    }
+    _reparsed_count = _program->function_definitions.size();
+    _needs_full_parse = false;
+}
+
+std::unique_ptr<Program> IncrementalParser::_parse_range(source_offset begin, source_offset end) const {
+    auto source_handler = std::make_unique<SourceHandler>(_buffer, begin, end);
+    Parser parser{std::make_unique<Lexer>(std::move(source_handler))};
+    return parser.parse_program();
+}
+
+source_offset IncrementalParser::_span_begin(std::size_t function) const {
+    return function == 0 ? 0 : _function_starts[function];
+}
@@ -1,3 +1,3 @@
 #include "node.hpp"
 
-Node::Node(const Position& position) : position{position} {}
\ No newline at end of file
+Node::Node(source_offset offset) : offset{offset} {}
\ No newline at end of file
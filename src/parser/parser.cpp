@@ -1,9 +1,14 @@
 #include "parser.hpp"
 
-Parser::Parser(std::unique_ptr<ILexer> lexer) : _lexer{std::move(lexer)}, _token{_lexer->get_next_token()} {};
+#include "mem_stats.hpp"
+
+Parser::Parser(std::unique_ptr<ILexer> lexer) : _lexer{std::move(lexer)}, _token{_lexer->get_next_token()} {
+    if (_token.get_type() == TokenType::T_COMMENT) _get_next_token();
+};
 
 std::unique_ptr<Program> Parser::parse_program() {
-    Position position{_token.get_position()};
+    MemStats::SubsystemScope mem_scope{MemSubsystem::PARSER};
+    source_offset offset{_token.get_offset()};
     up_fun_def_vec function_definitions{};
 
     while (auto function_definition = _try_parse_function_definition()) {
@@ -12,7 +17,7 @@ std::unique_ptr<Program> Parser::parse_program() {
 
     _token_must_be<ExpectedFuncOrEOFException>(TokenType::T_EOF);
 
-    return std::make_unique<Program>(position, std::move(function_definitions));
+    return std::make_unique<Program>(offset, std::move(function_definitions), _lexer->get_source());
 }
 
 /* -----------------------------------------------------------------------------*
@@ -26,16 +31,16 @@ up_fun_def Parser::_try_parse_function_definition() {
     }
     up_statement body{_try_parse_code_block()};
     if (not body) {
-        throw ExpectedFunctionBodyException(signature->identifier, _token.get_position());
+        throw ExpectedFunctionBodyException(signature->identifier, _token_position());
     }
-    return std::make_unique<FunctionDefinition>(std::move(signature), std::move(body));
+    return std::make_unique<FunctionDefinition>(std::move(signature), std::move(body), _lexer->get_source());
 }
 
 up_func_sig Parser::_try_parse_function_signature() {
     if (not _token_type_is(TokenType::T_DEF)) {
         return nullptr;
     }
-    Position position{_get_position_and_digest_token()};
+    source_offset offset{_get_offset_and_digest_token()};
 
     _token_must_be<ExpectedFuncIdentException>(TokenType::T_IDENTIFIER);
     std::string identifier{_token.get_value_as<std::string>()};
@@ -43,14 +48,14 @@ up_func_sig Parser::_try_parse_function_signature() {
 
     std::optional<up_typed_ident_vec> params{_try_parse_function_params()};
     if (not params.has_value()) {
-        throw ExpectedArgListException(_token.get_position());
+        throw ExpectedArgListException(_token_position());
     }
 
     _advance_on_required_token<ExpectedArrowException>(TokenType::T_ARROW);
 
     std::optional<Type> return_type{_parse_return_type()};
 
-    return std::make_unique<FunctionSignature>(position, identifier, std::move(params.value()), return_type);
+    return std::make_unique<FunctionSignature>(offset, identifier, std::move(params.value()), return_type);
 }
 
 std::optional<Type> Parser::_parse_return_type() {
@@ -63,7 +68,7 @@ std::optional<Type> Parser::_parse_return_type() {
         return type;
     }
 
-    throw ExpectedTypeSpecException(_token.get_position());
+    throw ExpectedTypeSpecException(_token_position());
 }
 /* -----------------------------------------------------------------------------*
  *                             PARSING STATEMENTS                               *
@@ -95,11 +100,11 @@ up_statement Parser::_try_parse_continue_statement() {
         return nullptr;
     }
 
-    Position position{_get_position_and_digest_token()};
+    source_offset offset{_get_offset_and_digest_token()};
 
     _advance_on_required_token<ExpectedSemicolException>(TokenType::T_SEMICOLON);
 
-    return std::make_unique<ContinueStatement>(position);
+    return std::make_unique<ContinueStatement>(offset);
 }
 // break;
 up_statement Parser::_try_parse_break_statement() {
@@ -107,11 +112,11 @@ up_statement Parser::_try_parse_break_statement() {
         return nullptr;
     }
 
-    Position position{_get_position_and_digest_token()};
+    source_offset offset{_get_offset_and_digest_token()};
 
     _advance_on_required_token<ExpectedSemicolException>(TokenType::T_SEMICOLON);
 
-    return std::make_unique<BreakStatement>(position);
+    return std::make_unique<BreakStatement>(offset);
 }
 // return [ expression ]; examples: return 4 + 8, return is_sth or foo(a, b, b+5) ;
 up_statement Parser::_try_parse_return_statement() {
@@ -119,12 +124,12 @@ up_statement Parser::_try_parse_return_statement() {
         return nullptr;
     }
 
-    Position position{_get_position_and_digest_token()};
+    source_offset offset{_get_offset_and_digest_token()};
     up_expression expression = _try_parse_expression();
 
     _advance_on_required_token<ExpectedSemicolException>(TokenType::T_SEMICOLON);
 
-    return std::make_unique<ReturnStatement>(position, std::move(expression));
+    return std::make_unique<ReturnStatement>(offset, std::move(expression));
 }
 // let [ mut ] identifier: type = expression;
 // examples: let mut i: int = 4;, let foo: function<int,int:bool> = foo2();
@@ -132,17 +137,17 @@ up_statement Parser::_try_parse_variable_declaration() {
     if (not _token_type_is(TokenType::T_LET)) {
         return nullptr;
     }
-    Position position{_get_position_and_digest_token()};
+    source_offset offset{_get_offset_and_digest_token()};
 
     up_typed_identifier typed_identifier = _try_parse_typed_identifier();
-    if (not typed_identifier) throw ExpectedTypedIdentifierException(_token.get_position());
+    if (not typed_identifier) throw ExpectedTypedIdentifierException(_token_position());
 
     up_expression assigned_expression{_try_parse_assigned_expression()};
-    if (not assigned_expression) throw ExpectedAssignmentException(_token.get_position());
+    if (not assigned_expression) throw ExpectedAssignmentException(_token_position());
 
     _advance_on_required_token<ExpectedSemicolException>(TokenType::T_SEMICOLON);
 
-    return std::make_unique<VariableDeclaration>(position, std::move(typed_identifier), std::move(assigned_expression));
+    return std::make_unique<VariableDeclaration>(offset, std::move(typed_identifier), std::move(assigned_expression));
 }
 // { statements }
 
@@ -151,7 +156,7 @@ up_statement Parser::_try_parse_code_block() {
         return nullptr;
     }
 
-    Position position{_get_position_and_digest_token()};
+    source_offset offset{_get_offset_and_digest_token()};
 
     up_statement_vec statements{};
     while (up_statement statement = _try_parse_statement()) {
@@ -160,28 +165,28 @@ up_statement Parser::_try_parse_code_block() {
 
     _advance_on_required_token<ExpectedRBraceException>(TokenType::T_R_BRACE);
 
-    return std::make_unique<CodeBlock>(position, std::move(statements));
+    return std::make_unique<CodeBlock>(offset, std::move(statements));
 }
 up_statement Parser::_try_parse_if_statement() {
     if (not _token_type_is(TokenType::T_IF)) {
         return nullptr;
     }
-    Position if_position{_get_position_and_digest_token()};
+    source_offset if_offset{_get_offset_and_digest_token()};
 
     up_expression condition{_try_parse_condition()};
 
     if (not condition) {
-        throw ExpectedIfConditionException(_token.get_position());
+        throw ExpectedIfConditionException(_token_position());
     }
 
     up_statement if_body{_try_parse_code_block()};
 
     if (not if_body) {
-        throw ExpectedConditionalStatementBodyException(_token.get_position());
+        throw ExpectedConditionalStatementBodyException(_token_position());
     }
 
     auto [else_ifs, else_block] = _try_parse_else_ifs_and_else_block();
-    return std::make_unique<IfStatement>(if_position, std::move(condition), std::move(if_body), std::move(else_ifs),
+    return std::make_unique<IfStatement>(if_offset, std::move(condition), std::move(if_body), std::move(else_ifs),
                                          std::move(else_block));
 }
 
@@ -189,12 +194,12 @@ std::pair<up_else_if_vec, up_statement> Parser::_try_parse_else_ifs_and_else_blo
     up_else_if_vec else_ifs{};
     up_statement else_block{};
     while (_token_type_is(TokenType::T_ELSE)) {
-        Position else_if_position{_get_position_and_digest_token()};
+        source_offset else_if_offset{_get_offset_and_digest_token()};
 
         if (not _token_type_is(TokenType::T_IF)) {
             else_block = _try_parse_code_block();
             if (not else_block) {
-                throw ExpectedConditionalStatementBodyException(_token.get_position());
+                throw ExpectedConditionalStatementBodyException(_token_position());
             }
             break;
         }
@@ -203,16 +208,16 @@ std::pair<up_else_if_vec, up_statement> Parser::_try_parse_else_ifs_and_else_blo
 
         up_expression else_if_condition{_try_parse_condition()};
         if (not else_if_condition) {
-            throw ExpectedIfConditionException(_token.get_position());
+            throw ExpectedIfConditionException(_token_position());
         }
 
         up_statement else_if_body{_try_parse_code_block()};
         if (not else_if_body) {
-            throw ExpectedConditionalStatementBodyException(_token.get_position());
+            throw ExpectedConditionalStatementBodyException(_token_position());
         }
 
         else_ifs.push_back(
-            std::make_unique<ElseIf>(else_if_position, std::move(else_if_condition), std::move(else_if_body)));
+            std::make_unique<ElseIf>(else_if_offset, std::move(else_if_condition), std::move(else_if_body)));
     }
     return std::make_pair(std::move(else_ifs), std::move(else_block));
 }
@@ -221,44 +226,44 @@ up_statement Parser::_try_parse_for_loop() {
     if (not _token_type_is(TokenType::T_FOR)) {
         return nullptr;
     }
-    Position position{_get_position_and_digest_token()};
+    source_offset offset{_get_offset_and_digest_token()};
 
     _advance_on_required_token<ExpectedLParenException>(TokenType::T_L_PAREN);
 
     up_statement var_decl{_try_parse_loop_var_declaration()};
     if (not var_decl) {
-        throw ExpectedLoopVarDeclException(_token.get_position());
+        throw ExpectedLoopVarDeclException(_token_position());
     }
 
     _advance_on_required_token<ExpectedSemicolException>(TokenType::T_SEMICOLON);
 
     up_expression condition{_try_parse_expression()};
     if (not condition) {
-        throw ExpectedLoopConditionException(_token.get_position());
+        throw ExpectedLoopConditionException(_token_position());
     }
 
     _advance_on_required_token<ExpectedSemicolException>(TokenType::T_SEMICOLON);
 
     if (not _token_type_is(TokenType::T_IDENTIFIER)) {
-        throw ExpectedLoopVarUpdateException(_token.get_position());
+        throw ExpectedLoopVarUpdateException(_token_position());
     }
     std::string identifier{_token.get_value_as<std::string>()};
-    Position asgn_position{_get_position_and_digest_token()};
+    source_offset asgn_offset{_get_offset_and_digest_token()};
 
     up_expression assigned_expr{_try_parse_assigned_expression()};
     if (not assigned_expr) {
-        throw ExpectedAssignmentException(_token.get_position());
+        throw ExpectedAssignmentException(_token_position());
     }
-    up_statement loop_update{std::make_unique<AssignStatement>(asgn_position, identifier, std::move(assigned_expr))};
+    up_statement loop_update{std::make_unique<AssignStatement>(asgn_offset, identifier, std::move(assigned_expr))};
 
     _advance_on_required_token<ExpectedRParenException>(TokenType::T_R_PAREN);
 
     up_statement body{_try_parse_code_block()};
     if (not body) {
-        throw ExpectedLoopBodyException(_token.get_position());
+        throw ExpectedLoopBodyException(_token_position());
     }
 
-    return std::make_unique<ForLoop>(position, std::move(var_decl), std::move(condition), std::move(loop_update),
+    return std::make_unique<ForLoop>(offset, std::move(var_decl), std::move(condition), std::move(loop_update),
                                      std::move(body));
 }
 
@@ -279,7 +284,7 @@ up_statement Parser::_try_parse_assignment_or_expression_statement() {
     }
 
     if (expr->kind != ExprKind::IDENTIFIER) {
-        throw InvalidAssignTargetException(_token.get_position());
+        throw InvalidAssignTargetException(_token_position());
     }
 
     // tu już jestesmy pewni, że token jest T_ASSIGN, wiec jesli wystapi blad to bedzie
@@ -288,21 +293,21 @@ up_statement Parser::_try_parse_assignment_or_expression_statement() {
 
     _advance_on_required_token<ExpectedSemicolException>(TokenType::T_SEMICOLON);
 
-    return std::make_unique<AssignStatement>(expr->position, identifier, std::move(assigned_expr));
+    return std::make_unique<AssignStatement>(expr->offset, identifier, std::move(assigned_expr));
 }
 
 up_statement Parser::_try_parse_loop_var_declaration() {
-    Position position{_token.get_position()};
+    source_offset offset{_token.get_offset()};
 
     up_typed_identifier typed_identifier = _try_parse_typed_identifier();
 
-    if (not typed_identifier) throw ExpectedTypedIdentifierException(_token.get_position());
+    if (not typed_identifier) throw ExpectedTypedIdentifierException(_token_position());
     typed_identifier->type.is_mutable = true;
 
     up_expression assigned_expr{_try_parse_assigned_expression()};
-    if (not assigned_expr) throw ExpectedAssignmentException(_token.get_position());
+    if (not assigned_expr) throw ExpectedAssignmentException(_token_position());
 
-    return std::make_unique<VariableDeclaration>(position, std::move(typed_identifier), std::move(assigned_expr));
+    return std::make_unique<VariableDeclaration>(offset, std::move(typed_identifier), std::move(assigned_expr));
 }
 
 /* -----------------------------------------------------------------------------*
@@ -322,87 +327,69 @@ up_expression Parser::_try_parse_condition() {
 }
 
 up_expression Parser::_try_parse_expression() {
-    return _try_parse_logical_or();
-}
-up_expression Parser::_try_parse_logical_or() {
-    return _try_parse_chained_binary_expression(
-        [this]() { return _try_parse_logical_and(); }, Parser::_or_token_types,
-        [this]() { throw ExpectedExprAfterOrException(this->_token.get_position()); });
-}
-
-up_expression Parser::_try_parse_logical_and() {
-    return _try_parse_chained_binary_expression(
-        [this]() { return _try_parse_equality_expression(); }, Parser::_and_token_types,
-        [this]() { throw ExpectedExprAfterAndException(this->_token.get_position()); });
+    return _try_parse_operator_expression(P_NONE);
 }
 
-// expr == expr , !=
-up_expression Parser::_try_parse_equality_expression() {
-    return _try_parse_single_binary_expression(
-        [this]() { return _try_parse_comparison_expression(); }, Parser::_equality_token_types,
-        [this]() { throw ExpectedExprAfterEqualityException(this->_token.get_position()); });
-}
+// precedence climbing over the _operators table. Right operands are parsed with precedence one
+// higher than their operator, so every operator is left associative. Limit keeps the shapes of
+// the grammar: after combining an operator only looser ones (or the same chainable one) may follow,
+// so e.g. a == b == c or x as int as float stop the expression instead of nesting.
+up_expression Parser::_try_parse_operator_expression(int min_precedence) {
+    up_expression left{min_precedence <= P_UNARY ? _try_parse_unary_expression()
+                                                 : _try_parse_bind_front_or_function_call()};
+    if (not left) {
+        return nullptr;
+    }
 
-// expr > expr., >=, <=, <
-up_expression Parser::_try_parse_comparison_expression() {
-    return _try_parse_single_binary_expression(
-        [this]() { return _try_parse_additive_expression(); }, Parser::_comparison_token_types,
-        [this]() { throw ExpectedExprAfterComparisonException(this->_token.get_position()); });
-}
+    int limit{P_PRIMARY};
+    while (true) {
+        const OperatorInfo& oper{_operators[static_cast<std::size_t>(_token.get_type())]};
+        if (oper.precedence == P_NONE or oper.precedence < min_precedence or oper.precedence > limit or
+            (oper.precedence == limit and not oper.is_chainable)) {
+            break;
+        }
 
-// expr + expr, -
-up_expression Parser::_try_parse_additive_expression() {
-    return _try_parse_chained_binary_expression(
-        [this]() { return _try_parse_multiplicative_expression(); }, Parser::_additive_token_types,
-        [this]() { throw ExpectedExprAfterAdditiveException(this->_token.get_position()); });
-}
+        if (oper.precedence == P_TYPE_CAST) {
+            left = _parse_type_cast(std::move(left));
+        } else {
+            _get_next_token();
+            up_expression right{_try_parse_operator_expression(oper.precedence + 1)};
+            if (not right) {
+                oper.on_missing_operand(_token_position());
+            }
+            left = BinaryExpression::create(oper.kind, std::move(left), std::move(right));
+        }
+        limit = oper.precedence;
+    }
 
-// *, /
-up_expression Parser::_try_parse_multiplicative_expression() {
-    return _try_parse_chained_binary_expression(
-        [this]() { return _try_parse_type_cast(); }, Parser::_multipicative_token_types,
-        [this]() { throw ExpectedExprAfterMultiplicativeException(this->_token.get_position()); });
+    return left;
 }
 
 // expr as type
-up_expression Parser::_try_parse_type_cast() {
-    up_expression expr{_try_parse_unary_expression()};
-    if (not expr) {
-        return nullptr;
-    }
-
-    if (_token_type_is(TokenType::T_AS)) {
-        _get_next_token();
-        std::optional<Type> type{_try_parse_type()};
-        if (not type.has_value()) {
-            throw ExpectedTypeForTypeCastException(_token.get_position());  // TODO
-        }
-        expr = std::make_unique<TypeCastExpression>(std::move(expr), type.value());
+up_expression Parser::_parse_type_cast(up_expression expr) {
+    _get_next_token();
+    std::optional<Type> type{_try_parse_type()};
+    if (not type.has_value()) {
+        throw ExpectedTypeForTypeCastException(_token_position());  // TODO
     }
-    return expr;
+    return std::make_unique<TypeCastExpression>(std::move(expr), type.value());
 }
 
 // -expr | not expr
 up_expression Parser::_try_parse_unary_expression() {
     if (not(_token_type_is(TokenType::T_NOT) or _token_type_is(TokenType::T_MINUS))) {
-        return _try_parse_function_composition();  // to nie unary - delegujemy dalej
+        return _try_parse_bind_front_or_function_call();  // to nie unary - delegujemy dalej
     }
 
     ExprKind kind = _token_type_is(TokenType::T_NOT) ? ExprKind::LOGICAL_NOT : ExprKind::UNARY_MINUS;
-    Position position{_get_position_and_digest_token()};
+    source_offset offset{_get_offset_and_digest_token()};
 
-    up_expression expr = _try_parse_function_composition();
+    up_expression expr = _try_parse_operator_expression(P_FUNC_COMPOSITION);
     if (not expr) {
-        throw ExpectedExprAfterUnaryException(_token.get_position());  // TODO
+        throw ExpectedExprAfterUnaryException(_token_position());  // TODO
     }
 
-    return std::make_unique<UnaryExpression>(position, kind, std::move(expr));
-}
-
-up_expression Parser::_try_parse_function_composition() {
-    return _try_parse_chained_binary_expression(
-        [this]() { return _try_parse_bind_front_or_function_call(); }, Parser::_func_comp_token_types,
-        [this]() { throw ExpectedExprAfterFuncCompException(this->_token.get_position()); });
+    return std::make_unique<UnaryExpression>(offset, kind, std::move(expr));
 }
 
 // EBNF bind_front = function_call | ( arg_list, bindf, function_call);
@@ -419,7 +406,7 @@ up_expression Parser::_try_parse_function_composition() {
 //          (4 + 8)
 //          (is_foo and x == y)
 up_expression Parser::_try_parse_bind_front_or_function_call() {
-    Position position{_token.get_position()};  // po try_parse_argument_list już przejedzony obecny token
+    source_offset offset{_token.get_offset()};  // po try_parse_argument_list już przejedzony obecny token
 
     std::optional<up_expression_vec> opt_argument_list = _try_parse_argument_list();
     if (not opt_argument_list.has_value()) {
@@ -429,7 +416,7 @@ up_expression Parser::_try_parse_bind_front_or_function_call() {
 
     if (not _token_type_is(TokenType::T_BIND_FRONT)) {
         if (argument_list.size() != 1) {
-            throw ExpectedBindFrontOperatorException(_token.get_position());
+            throw ExpectedBindFrontOperatorException(_token_position());
         }
         return _try_parse_function_call(std::move(argument_list[0]));
     }
@@ -437,10 +424,10 @@ up_expression Parser::_try_parse_bind_front_or_function_call() {
     _get_next_token();
     up_expression target{_try_parse_function_call()};
     if (not target) {
-        throw ExpectedBindFrontTargetException(_token.get_position());
+        throw ExpectedBindFrontTargetException(_token_position());
     }
 
-    return std::make_unique<BindFront>(position, std::move(argument_list), std::move(target));
+    return std::make_unique<BindFront>(offset, std::move(argument_list), std::move(target));
 }
 
 up_expression Parser::_try_parse_function_call() {
@@ -471,20 +458,20 @@ up_expression Parser::_try_parse_primary() {
 }
 
 up_expression Parser::_try_parse_literal() {
-    Position position{_token.get_position()};
+    source_offset offset{_token.get_offset()};
     up_expression literal;
     switch (_token.get_type()) {
         case TokenType::T_LITERAL_INT:
-            literal = std::make_unique<LiteralInt>(position, _token.get_value_as<int>());
+            literal = std::make_unique<LiteralInt>(offset, _token.get_value_as<int_value>());
             break;
         case TokenType::T_LITERAL_FLOAT:
-            literal = std::make_unique<LiteralFloat>(position, _token.get_value_as<double>());
+            literal = std::make_unique<LiteralFloat>(offset, _token.get_value_as<double>());
             break;
         case TokenType::T_LITERAL_STRING:
-            literal = std::make_unique<LiteralString>(position, _token.get_value_as<std::string>());
+            literal = std::make_unique<LiteralString>(offset, _token.get_value_as<std::string_view>());
             break;
         case TokenType::T_LITERAL_BOOL:
-            literal = std::make_unique<LiteralBool>(position, _token.get_value_as<bool>());
+            literal = std::make_unique<LiteralBool>(offset, _token.get_value_as<bool>());
             break;
         default:
             return nullptr;
@@ -497,7 +484,7 @@ up_expression Parser::_try_parse_identifier() {
     if (not _token_type_is(TokenType::T_IDENTIFIER)) {
         return nullptr;
     }
-    up_expression idenitifier = std::make_unique<Identifier>(_token.get_position(), _token.get_value_as<std::string>());
+    up_expression idenitifier = std::make_unique<Identifier>(_token.get_offset(), _token.get_value_as<std::string>());
     _get_next_token();
     return idenitifier;
 }
@@ -510,7 +497,7 @@ up_expression Parser::_try_parse_assigned_expression() {
     _get_next_token();
     up_expression assigned_expr{_try_parse_expression()};
     if (not assigned_expr) {
-        throw ExpectedExprException(_token.get_position());
+        throw ExpectedExprException(_token_position());
     }
     return assigned_expr;
 }
@@ -519,11 +506,11 @@ up_expression Parser::_try_parse_paren_expr() {
     if (not _token_type_is(TokenType::T_L_PAREN)) {
         return nullptr;
     }
-    Position position(_get_position_and_digest_token());
+    source_offset offset(_get_offset_and_digest_token());
 
     up_expression expr = _try_parse_expression();
     if (not expr) {
-        throw ExpectedExprException(position);
+        throw ExpectedExprException(resolve_position(_lexer->get_source().get(), offset));
     }
 
     _advance_on_required_token<ExpectedRParenException>(TokenType::T_R_PAREN);
@@ -533,50 +520,6 @@ up_expression Parser::_try_parse_paren_expr() {
 /* -----------------------------------------------------------------------------*
  *                             PARSE_BINARY_EXPR                                *
  *------------------------------------------------------------------------------*/
-up_expression Parser::_try_parse_chained_binary_expression(auto try_parse_subexpr,
-                                                           const std::unordered_set<TokenType>& token_types,
-                                                           auto on_error) {
-    up_expression left{try_parse_subexpr()};
-    if (not left) {
-        return nullptr;
-    }
-
-    while (token_types.contains(_token.get_type())) {
-        ExprKind kind{Parser::_token_type_to_expr_kind.at(_token.get_type())};
-
-        _get_next_token();
-        up_expression right{try_parse_subexpr()};
-        if (not right) {
-            on_error();
-        }
-        left = BinaryExpression::create(kind, std::move(left), std::move(right));
-    }
-
-    return left;
-}
-
-up_expression Parser::_try_parse_single_binary_expression(auto try_parse_subexpr,
-                                                          const std::unordered_set<TokenType>& token_types,
-                                                          auto on_error) {
-    up_expression left{try_parse_subexpr()};
-    if (not left) {
-        return nullptr;
-    }
-
-    if (token_types.contains(_token.get_type())) {
-        ExprKind kind{Parser::_token_type_to_expr_kind.at(_token.get_type())};
-
-        _get_next_token();
-        up_expression right{try_parse_subexpr()};
-        if (not right) {
-            on_error();
-        }
-        left = BinaryExpression::create(kind, std::move(left), std::move(right));
-    }
-
-    return left;
-}
-
 /* -----------------------------------------------------------------------------*
  *                            PARSE_ARGUMENT_LIST                               *
  *------------------------------------------------------------------------------*/
@@ -599,7 +542,7 @@ std::optional<up_expression_vec> Parser::_try_parse_argument_list() {
         _get_next_token();
         argument = _try_parse_expression();
         if (not argument) {
-            throw ExpectedExprException(_token.get_position());
+            throw ExpectedExprException(_token_position());
         }
         arguments.push_back(std::move(argument));
     }
@@ -616,7 +559,7 @@ std::optional<up_expression_vec> Parser::_try_parse_argument_list() {
 // examples: mut fraction: float, a:int, fun_foo: function<mut float, int : none>
 up_typed_identifier Parser::_try_parse_typed_identifier() {
     bool is_mutable{false};
-    Position position{_token.get_position()};
+    source_offset offset{_token.get_offset()};
 
     if (_token_type_is(TokenType::T_MUT)) {
         is_mutable = true;
@@ -633,10 +576,10 @@ up_typed_identifier Parser::_try_parse_typed_identifier() {
 
     std::optional<Type> type{_try_parse_type()};
     if (not type.has_value()) {
-        throw ExpectedTypeException(_token.get_position());
+        throw ExpectedTypeException(_token_position());
     }  // TODO: replace
 
-    return std::make_unique<TypedIdentifier>(position, identifier, VariableType{type.value(), is_mutable});
+    return std::make_unique<TypedIdentifier>(offset, identifier, VariableType{type.value(), is_mutable});
 }
 
 std::optional<up_typed_ident_vec> Parser::_try_parse_function_params() {
@@ -653,7 +596,7 @@ std::optional<up_typed_ident_vec> Parser::_try_parse_function_params() {
             _get_next_token();
             up_typed_identifier param{_try_parse_typed_identifier()};
             if (not param) {
-                throw ExpectedTypedIdentifierException(_token.get_position());
+                throw ExpectedTypedIdentifierException(_token_position());
             }
             params.push_back(std::move(param));
         }
@@ -702,7 +645,7 @@ FunctionTypeInfo Parser::_parse_function_type_info() {
         param = _try_parse_function_param_type();
 
         if (not param.has_value()) {
-            throw InvalidFunctionParamTypeException(_token.get_position());
+            throw InvalidFunctionParamTypeException(_token_position());
         }
         params.push_back(*param);
 
@@ -711,7 +654,7 @@ FunctionTypeInfo Parser::_parse_function_type_info() {
             param = _try_parse_function_param_type();
 
             if (not param.has_value()) {
-                throw InvalidFunctionParamTypeException(_token.get_position());
+                throw InvalidFunctionParamTypeException(_token_position());
             }
 
             params.push_back(std::move(*param));
@@ -736,7 +679,7 @@ std::optional<VariableType> Parser::_try_parse_function_param_type() {
 
     if (not type.has_value()) {
         if (is_mutable) {  // przejedliśmy mut a nie dostaliśmy typu -> błąd
-            throw ExpectedTypeException(_token.get_position());
+            throw ExpectedTypeException(_token_position());
         }
         return std::nullopt;  // nie było mut - po prostu nie sparsowaliśmy typu
     }
@@ -756,53 +699,56 @@ void Parser::_get_next_token() {
     _token = token;
 }
 
-Position Parser::_get_position_and_digest_token() {
-    Position position{_token.get_position()};
+source_offset Parser::_get_offset_and_digest_token() {
+    source_offset offset{_token.get_offset()};
     _get_next_token();
-    return position;
+    return offset;
+}
+
+Position Parser::_token_position() const {
+    return resolve_position(_lexer->get_source().get(), _token.get_offset());
 }
 
 bool Parser::_token_type_is(TokenType token_type) const {
     return _token.get_type() == token_type;
 }
 
-const std::unordered_set<TokenType> Parser::_or_token_types = {TokenType::T_OR};
+namespace {
+template <typename Exception>
+[[noreturn]] void throw_missing_operand(const Position& position) {
+    throw Exception(position);
+}
+}  // namespace
 
-const std::unordered_set<TokenType> Parser::_and_token_types = {TokenType::T_AND};
+const std::array<Parser::OperatorInfo, TOKEN_TYPES_COUNT> Parser::_operators = [] {
+    std::array<OperatorInfo, TOKEN_TYPES_COUNT> operators{};
+    auto add = [&operators](TokenType type, OperatorInfo info) { operators[static_cast<std::size_t>(type)] = info; };
 
-const std::unordered_set<TokenType> Parser::_equality_token_types = {
-    TokenType::T_EQUAL,
-    TokenType::T_NOT_EQUAL,
-};
+    add(TokenType::T_OR, {P_OR, true, ExprKind::LOGICAL_OR, throw_missing_operand<ExpectedExprAfterOrException>});
+    add(TokenType::T_AND, {P_AND, true, ExprKind::LOGICAL_AND, throw_missing_operand<ExpectedExprAfterAndException>});
 
-const std::unordered_set<TokenType> Parser::_comparison_token_types = {
-    TokenType::T_LESS,
-    TokenType::T_LESS_EQUAL,
-    TokenType::T_GREATER,
-    TokenType::T_GREATER_EQUAL,
-};
-const std::unordered_set<TokenType> Parser::_additive_token_types = {
-    TokenType::T_PLUS,
-    TokenType::T_MINUS,
-};
-const std::unordered_set<TokenType> Parser::_multipicative_token_types = {
-    TokenType::T_MULTIPLY,
-    TokenType::T_DIVIDE,
-};
-const std::unordered_set<TokenType> Parser::_func_comp_token_types = {TokenType::T_FUNC_COMPOSITION};
-
-const std::unordered_map<TokenType, ExprKind> Parser::_token_type_to_expr_kind = {
-    {TokenType::T_OR, ExprKind::LOGICAL_OR},
-    {TokenType::T_AND, ExprKind::LOGICAL_AND},
-    {TokenType::T_EQUAL, ExprKind::EQUAL},
-    {TokenType::T_NOT_EQUAL, ExprKind::NOT_EQUAL},
-    {TokenType::T_LESS, ExprKind::LESS},
-    {TokenType::T_LESS_EQUAL, ExprKind::LESS_EQUAL},
-    {TokenType::T_GREATER, ExprKind::GREATER},
-    {TokenType::T_GREATER_EQUAL, ExprKind::GREATER_EQUAL},
-    {TokenType::T_PLUS, ExprKind::ADDITION},
-    {TokenType::T_MINUS, ExprKind::SUBTRACTION},
-    {TokenType::T_MULTIPLY, ExprKind::MULTIPICATION},
-    {TokenType::T_DIVIDE, ExprKind::DIVISION},
-    {TokenType::T_FUNC_COMPOSITION, ExprKind::FUNCTION_COMPOSITION},
-};
\ No newline at end of file
+    auto on_missing_equality = throw_missing_operand<ExpectedExprAfterEqualityException>;
+    add(TokenType::T_EQUAL, {P_EQUALITY, false, ExprKind::EQUAL, on_missing_equality});
+    add(TokenType::T_NOT_EQUAL, {P_EQUALITY, false, ExprKind::NOT_EQUAL, on_missing_equality});
+
+    auto on_missing_comparison = throw_missing_operand<ExpectedExprAfterComparisonException>;
+    add(TokenType::T_LESS, {P_COMPARISON, false, ExprKind::LESS, on_missing_comparison});
+    add(TokenType::T_LESS_EQUAL, {P_COMPARISON, false, ExprKind::LESS_EQUAL, on_missing_comparison});
+    add(TokenType::T_GREATER, {P_COMPARISON, false, ExprKind::GREATER, on_missing_comparison});
+    add(TokenType::T_GREATER_EQUAL, {P_COMPARISON, false, ExprKind::GREATER_EQUAL, on_missing_comparison});
+
+    auto on_missing_additive = throw_missing_operand<ExpectedExprAfterAdditiveException>;
+    add(TokenType::T_PLUS, {P_ADDITIVE, true, ExprKind::ADDITION, on_missing_additive});
+    add(TokenType::T_MINUS, {P_ADDITIVE, true, ExprKind::SUBTRACTION, on_missing_additive});
+
+    auto on_missing_multiplicative = throw_missing_operand<ExpectedExprAfterMultiplicativeException>;
+    add(TokenType::T_MULTIPLY, {P_MULTIPLICATIVE, true, ExprKind::MULTIPICATION, on_missing_multiplicative});
+    add(TokenType::T_DIVIDE, {P_MULTIPLICATIVE, true, ExprKind::DIVISION, on_missing_multiplicative});
+
+    // type is parsed by _parse_type_cast, which reports missing type itself
+    add(TokenType::T_AS, {P_TYPE_CAST, false, ExprKind::TYPE_CAST, nullptr});
+
+    add(TokenType::T_FUNC_COMPOSITION, {P_FUNC_COMPOSITION, true, ExprKind::FUNCTION_COMPOSITION,
+                                        throw_missing_operand<ExpectedExprAfterFuncCompException>});
+    return operators;
+}();
@@ -6,6 +6,7 @@
 
 #include "expression.hpp"
 #include "program.hpp"
+#include "source_handler.hpp"
 #include "typed_identifier.hpp"
 
 void Printer::_print_indent() const {
@@ -16,18 +17,21 @@ void Printer::_print_expression_header(const Expression& expr, std::string type_
                                        std::string additional_info) const {
     _print_indent();
     std::cout << "[\033[1;34m" << expr_kind_to_str(expr.kind) << type_spec << "\033[0m]"
-              << " <" << &expr << "> at:" << expr.position.get_position_str() << "" << additional_info << std::endl;
+              << " <" << &expr << "> at:" << resolve_position(_source, expr.offset).get_position_str()
+              << "" << additional_info << std::endl;
 }
 
 void Printer::_print_header(std::string type_str, const Node& node, std::string additional_info) const {
     std::cout << "[\033[1;32m" << type_str << "\033[0m"
-              << "] <" << &node << "> at:" << node.position.get_position_str() << "" << additional_info << std::endl;
+              << "] <" << &node << "> at:" << resolve_position(_source, node.offset).get_position_str()
+              << "" << additional_info << std::endl;
 }
 /* -----------------------------------------------------------------------------*
  *                               PRINTING STATEMENTS                            *
  *------------------------------------------------------------------------------*/
 
 void Printer::visit(const Program& program) {
+    _source = program.source.get();
     _print_header("Program", program);
     _IndentGuard guard(_indent_level);
     std::for_each(program.function_definitions.begin(), program.function_definitions.end(),
@@ -1,7 +1,7 @@
 #include "program.hpp"
 
-Program::Program(const Position& position, up_fun_def_vec function_definitions)
-    : Node{position}, function_definitions{std::move(function_definitions)} {};
+Program::Program(source_offset offset, up_fun_def_vec function_definitions, sp_source_buffer source)
+    : Node{offset}, function_definitions{std::move(function_definitions)}, source{std::move(source)} {};
 
 void Program::accept(Visitor& visitor) const {
     visitor.visit(*this);
@@ -1,5 +1,7 @@
 #include "statement.hpp"
 
+#include <algorithm>
+
 void ContinueStatement::accept(Visitor& visitor) const {
     visitor.visit(*this);
 }
@@ -8,31 +10,35 @@ void BreakStatement::accept(Visitor& visitor) const {
     visitor.visit(*this);
 }
 
-ReturnStatement::ReturnStatement(const Position& position, up_expression expression)
-    : Statement{position}, expression{std::move(expression)} {}
+ReturnStatement::ReturnStatement(source_offset offset, up_expression expression)
+    : Statement{offset}, expression{std::move(expression)} {}
 
 void ReturnStatement::accept(Visitor& visitor) const {
     visitor.visit(*this);
 }
 
-VariableDeclaration::VariableDeclaration(const Position& position, up_typed_identifier typed_identifier,
+VariableDeclaration::VariableDeclaration(source_offset offset, up_typed_identifier typed_identifier,
                                          up_expression expression)
-    : Statement{position}, typed_identifier{std::move(typed_identifier)}, assigned_expression{std::move(expression)} {}
+    : Statement{offset}, typed_identifier{std::move(typed_identifier)}, assigned_expression{std::move(expression)} {}
 
 void VariableDeclaration::accept(Visitor& visitor) const {
     visitor.visit(*this);
 }
 
-CodeBlock::CodeBlock(const Position& position, up_statement_vec statements)
-    : Statement{position}, statements{std::move(statements)} {}
+CodeBlock::CodeBlock(source_offset offset, up_statement_vec statements)
+    : Statement{offset},
+      statements{std::move(statements)},
+      declaration_count{static_cast<std::size_t>(std::ranges::count_if(this->statements, [](const auto& statement) {
+          return dynamic_cast<const VariableDeclaration*>(statement.get()) != nullptr;
+      }))} {}
 
 void CodeBlock::accept(Visitor& visitor) const {
     visitor.visit(*this);
 }
 
-IfStatement::IfStatement(const Position& position, up_expression condition, up_statement body, up_else_if_vec else_ifs,
+IfStatement::IfStatement(source_offset offset, up_expression condition, up_statement body, up_else_if_vec else_ifs,
                          up_statement else_body)
-    : Statement{position},
+    : Statement{offset},
       condition{std::move(condition)},
       body{std::move(body)},
       else_ifs{std::move(else_ifs)},
@@ -42,36 +48,39 @@ void IfStatement::accept(Visitor& visitor) const {
     visitor.visit(*this);
 }
 
-ElseIf::ElseIf(const Position& position, up_expression condition, up_statement body)
-    : Statement{position}, condition{std::move(condition)}, body{std::move(body)} {}
+ElseIf::ElseIf(source_offset offset, up_expression condition, up_statement body)
+    : Statement{offset}, condition{std::move(condition)}, body{std::move(body)} {}
 
 void ElseIf::accept(Visitor& visitor) const {
     visitor.visit(*this);
 }
 
-AssignStatement::AssignStatement(const Position& position, std::string identifier, up_expression expr)
-    : Statement{position}, identifier{identifier}, expr{std::move(expr)} {}
+AssignStatement::AssignStatement(source_offset offset, std::string identifier, up_expression expr)
+    : Statement{offset}, identifier{identifier}, symbol{Symbols::intern(this->identifier)}, expr{std::move(expr)} {}
 
 void AssignStatement::accept(Visitor& visitor) const {
     visitor.visit(*this);
 }
 
-ExpressionStatement::ExpressionStatement(up_expression expr) : Statement{expr->position}, expr{std::move(expr)} {}
+ExpressionStatement::ExpressionStatement(up_expression expr) : Statement{expr->offset}, expr{std::move(expr)} {}
 
 void ExpressionStatement::accept(Visitor& visitor) const {
     visitor.visit(*this);
 }
 
-FunctionDefinition::FunctionDefinition(up_func_sig signature, up_statement body)
-    : Statement{signature->position}, signature{std::move(signature)}, body{std::move(body)} {}
+FunctionDefinition::FunctionDefinition(up_func_sig signature, up_statement body, sp_source_buffer source)
+    : Statement{signature->offset},
+      signature{std::move(signature)},
+      body{std::move(body)},
+      source{std::move(source)} {}
 
 void FunctionDefinition::accept(Visitor& visitor) const {
     visitor.visit(*this);
 }
 
-FunctionSignature::FunctionSignature(const Position& position, std::string identifier, up_typed_ident_vec params,
+FunctionSignature::FunctionSignature(source_offset offset, std::string identifier, up_typed_ident_vec params,
                                      std::optional<Type> return_type)
-    : Node{position}, identifier{identifier}, params{std::move(params)} {
+    : Node{offset}, identifier{identifier}, params{std::move(params)} {
     _deduce_function_type(return_type);
 }
 
@@ -88,9 +97,9 @@ void FunctionSignature::accept(Visitor& visitor) const {
     visitor.visit(*this);
 }
 
-ForLoop::ForLoop(const Position& position, up_statement var_declaration, up_expression condition,
+ForLoop::ForLoop(source_offset offset, up_statement var_declaration, up_expression condition,
                  up_statement loop_update, up_statement body)
-    : Statement{position},
+    : Statement{offset},
       var_declaration{std::move(var_declaration)},
       condition{std::move(condition)},
       loop_update{std::move(loop_update)},
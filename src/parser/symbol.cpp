@@ -0,0 +1,35 @@
+#include "symbol.hpp"
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+struct SymbolTable {
+    std::mutex mutex;
+    // deque - names never move, so the map can key on views of them
+    std::deque<std::string> names;
+    std::unordered_map<std::string_view, symbol_id> ids;
+};
+
+SymbolTable& table() {
+    static SymbolTable symbol_table{};
+    return symbol_table;
+}
+}  // namespace
+
+symbol_id Symbols::intern(std::string_view name) {
+    SymbolTable& symbols{table()};
+    std::lock_guard lock{symbols.mutex};
+    if (auto it = symbols.ids.find(name); it != symbols.ids.end()) return it->second;
+
+    auto symbol{static_cast<symbol_id>(symbols.names.size())};
+    symbols.ids.emplace(symbols.names.emplace_back(name), symbol);
+    return symbol;
+}
+
+const std::string& Symbols::name(symbol_id symbol) {
+    SymbolTable& symbols{table()};
+    std::lock_guard lock{symbols.mutex};
+    return symbols.names.at(symbol);
+}
@@ -13,7 +13,7 @@ Type::Type(TypeKind type_kind) {
 }
 
 Type::Type(FunctionTypeInfo fun_type_info)
-    : kind{TypeKind::FUNCTION}, function_type_info{std::make_shared<FunctionTypeInfo>(std::move(fun_type_info))} {}
+    : kind{TypeKind::FUNCTION}, function_type_info{make_rc<FunctionTypeInfo>(std::move(fun_type_info))} {}
 
 std::string Type::to_str() const {
     std::string type_str{type_kind_to_string(kind)};
@@ -45,6 +45,9 @@ std::ostream& operator<<(std::ostream& os, const Type& type) {
  *                             FUNCTION_TYPE_INFO                               *
  *------------------------------------------------------------------------------*/
 
+FunctionTypeInfo::FunctionTypeInfo(std::vector<VariableType> param_types, std::optional<Type> return_type)
+    : param_types{std::move(param_types)}, return_type{std::move(return_type)} {}
+
 std::string FunctionTypeInfo::to_str() const {
     std::string fun_type_info_str{"<"};
     if (param_types.empty()) {
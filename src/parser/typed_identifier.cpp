@@ -1,7 +1,7 @@
 #include "typed_identifier.hpp"
 
-TypedIdentifier::TypedIdentifier(const Position& position, std::string name, VariableType type)
-    : Node{position}, name{name}, type{type} {}
+TypedIdentifier::TypedIdentifier(source_offset offset, std::string name, VariableType type)
+    : Node{offset}, name{name}, symbol{Symbols::intern(this->name)}, type{type} {}
 
 void TypedIdentifier::accept(Visitor& visitor) const {
     visitor.visit(*this);
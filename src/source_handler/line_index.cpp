@@ -0,0 +1,62 @@
+#include "line_index.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+LineIndex::LineIndex(std::string_view text) : _text{text}, _line_starts{0}, _scanned{0}, _last_line{0} {}
+
+Position LineIndex::position_of(source_offset offset) const {
+    _scan_up_to(offset);
+    _last_line = _find_line(offset);
+
+    return Position{static_cast<int>(_last_line + 1), static_cast<int>(offset - _line_starts[_last_line] + 1)};
+}
+
+source_offset LineIndex::offset_of(const Position& position) const {
+    std::size_t line{static_cast<std::size_t>(position.get_line() - 1)};
+    _scan_lines(line + 1);
+    if (line >= _line_starts.size()) {
+        return static_cast<source_offset>(_text.size());
+    }
+    return _line_starts[line] + static_cast<source_offset>(position.get_column() - 1);
+}
+
+void LineIndex::_scan_lines(std::size_t count) const {
+    while (_line_starts.size() < count and _scanned < _text.size()) {
+        const void* found{std::memchr(_text.data() + _scanned, '\n', _text.size() - _scanned)};
+        if (not found) {
+            _scanned = static_cast<source_offset>(_text.size());
+            break;
+        }
+        _scanned = static_cast<source_offset>(static_cast<const char*>(found) - _text.data()) + 1;
+        _line_starts.push_back(_scanned);
+    }
+}
+
+void LineIndex::_scan_up_to(source_offset offset) const {
+    source_offset end{static_cast<source_offset>(std::min<std::size_t>(offset, _text.size()))};
+    while (_scanned < end) {
+        const void* found{std::memchr(_text.data() + _scanned, '\n', end - _scanned)};
+        if (not found) {
+            _scanned = end;
+            break;
+        }
+        _scanned = static_cast<source_offset>(static_cast<const char*>(found) - _text.data()) + 1;
+        _line_starts.push_back(_scanned);
+    }
+}
+
+std::size_t LineIndex::_find_line(source_offset offset) const {
+    auto line_contains = [this, offset](std::size_t line) {
+        return _line_starts[line] <= offset and (line + 1 == _line_starts.size() or offset < _line_starts[line + 1]);
+    };
+
+    if (line_contains(_last_line)) {
+        return _last_line;
+    }
+    if (_last_line + 1 < _line_starts.size() and line_contains(_last_line + 1)) {
+        return _last_line + 1;
+    }
+    auto it = std::upper_bound(_line_starts.begin(), _line_starts.end(), offset);
+    return static_cast<std::size_t>(it - _line_starts.begin()) - 1;
+}
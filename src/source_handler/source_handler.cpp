@@ -1,33 +1,72 @@
 #include "source_handler.hpp"
 
-SourceHandler::SourceHandler(std::unique_ptr<std::istream> source) : _position{}, _source{std::move(source)} {}
+#include <iterator>
+#include <limits>
 
-std::pair<char, Position> SourceHandler::get_char_and_position() {
-    char current_char = _get_char();
-    Position current_position = _position;
-    _adjust_position(current_char);
+#include "exceptions.hpp"
+
+SourceBuffer::SourceBuffer(std::string text) : text{std::move(text)}, decoded_literals{}, lines{this->text} {}
+
+Position resolve_position(const SourceBuffer* source, source_offset offset) {
+    if (not source) return Position{1, static_cast<int>(offset) + 1};
+    return source->lines.position_of(offset);
+}
+
+namespace {
+std::string read_whole(std::istream& source) {
+    std::string text{std::istreambuf_iterator<char>{source}, std::istreambuf_iterator<char>{}};
+    if (text.size() >= std::numeric_limits<source_offset>::max()) {
+        throw SourceTooLargeException();
+    }
+    return text;
+}
+}  // namespace
 
-    return {current_char, current_position};
+SourceHandler::SourceHandler(std::unique_ptr<std::istream> source)
+    : _buffer{std::make_shared<SourceBuffer>(read_whole(*source))}, _offset{0}, _char_offset{0} {
+    _end = static_cast<source_offset>(_buffer->text.size());
 }
 
-char SourceHandler::_get_char() {
-    char c;
+SourceHandler::SourceHandler(std::shared_ptr<SourceBuffer> buffer, source_offset begin, source_offset end)
+    : _buffer{std::move(buffer)}, _offset{begin}, _char_offset{begin}, _end{end} {}
+
+char SourceHandler::get_char() {
+    const std::string& text{_buffer->text};
+    _char_offset = _offset;
 
-    if (not _source->get(c)) {
+    if (_offset >= _end) {
         return EOF_CHAR;
     }
 
-    if (c == CR_CHAR and _source->peek() == LF_CHAR) {
-        _source->get(c);
+    char c{text[_offset++]};
+    if (c == CR_CHAR and _offset < _end and text[_offset] == LF_CHAR) {
+        c = text[_offset++];
     }
 
     return c;
 }
 
-void SourceHandler::_adjust_position(char c) {
-    if (c == LF_CHAR) {
-        _position = _position.next_line();
-    } else if (c != EOF_CHAR) {
-        _position = _position.next_column();
-    }
+std::pair<char, Position> SourceHandler::get_char_and_position() {
+    char current_char = get_char();
+    return {current_char, get_position(_char_offset)};
+}
+
+source_offset SourceHandler::get_char_offset() const noexcept {
+    return _char_offset;
+}
+
+Position SourceHandler::get_position(source_offset offset) const {
+    return _buffer->lines.position_of(offset);
+}
+
+std::string_view SourceHandler::slice(source_offset begin, source_offset end) const {
+    return std::string_view{_buffer->text}.substr(begin, end - begin);
+}
+
+std::string_view SourceHandler::store_decoded(std::string decoded) {
+    return _buffer->decoded_literals.emplace_back(std::move(decoded));
+}
+
+sp_source_buffer SourceHandler::get_buffer() const noexcept {
+    return _buffer;
 }
@@ -0,0 +1,187 @@
+#include <boost/test/unit_test.hpp>
+#include <cstdlib>
+#include <new>
+
+#include "interpreter.hpp"
+#include "mem_stats.hpp"
+#include "program.hpp"
+
+std::unique_ptr<Program> get_program(std::string mock_file);
+
+/* -----------------------------------------------------------------------------*
+ *                           ALLOCATION COUNTING HARNESS                        *
+ *------------------------------------------------------------------------------*/
+
+// every non-aligned form is replaced - all blocks released by the replaced deletes come from malloc
+namespace {
+std::size_t allocations_count{0};
+std::array<std::size_t, static_cast<std::size_t>(MemSubsystem::COUNT)> subsystem_allocations{};
+
+void* counted_malloc(std::size_t size) noexcept {
+    ++allocations_count;
+    ++subsystem_allocations[static_cast<std::size_t>(MemStats::current_subsystem)];
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* counted_malloc_or_throw(std::size_t size) {
+    if (void* ptr = counted_malloc(size)) return ptr;
+    throw std::bad_alloc();
+}
+}  // namespace
+
+void* operator new(std::size_t size) {
+    return counted_malloc_or_throw(size);
+}
+
+void* operator new[](std::size_t size) {
+    return counted_malloc_or_throw(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return counted_malloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return counted_malloc(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+BOOST_AUTO_TEST_SUITE(allocation_tests)
+
+std::size_t count_run_allocations(const std::string& source) {
+    auto program{get_program(source)};
+    Interpreter interpreter{};
+    std::size_t before{allocations_count};
+    program->accept(interpreter);
+    return allocations_count - before;
+}
+
+std::array<std::size_t, subsystem_allocations.size()> count_subsystem_allocations(const std::string& source) {
+    auto program{get_program(source)};
+    Interpreter interpreter{};
+    auto before{subsystem_allocations};
+    program->accept(interpreter);
+    auto counts{subsystem_allocations};
+    for (std::size_t i = 0; i < counts.size(); ++i) counts[i] -= before[i];
+    return counts;
+}
+
+std::string int_loop_source(int iterations) {
+    return R"(
+def main() -> int {
+    let mut sum: int = 0;
+    for (i: int = 0; i < )" +
+           std::to_string(iterations) + R"(; i = i + 1) {
+        if (i == 3) {
+            continue;
+        } else if (not (i < 5)) {
+            sum = sum - i;
+        } else {
+            sum = sum + i * 2 - -1;
+        }
+    }
+    return sum;
+}
+)";
+}
+
+std::string scalar_loop_source(int iterations) {
+    return R"(
+def main() -> int {
+    let mut total: float = 0.0;
+    let mut flag: bool = false;
+    for (i: int = 0; i < )" +
+           std::to_string(iterations) + R"(; i = i + 1) {
+        flag = not flag and i != 7;
+        if (flag or total > 100.0) {
+            total = total / 2.0 + 1.5;
+        }
+        if (i > 500) {
+            break;
+        }
+    }
+    return 0;
+}
+)";
+}
+
+std::string declaring_loop_source(int iterations) {
+    return R"(
+def main() -> int {
+    let mut sum: int = 0;
+    for (i: int = 0; i < )" +
+           std::to_string(iterations) + R"(; i = i + 1) {
+        let doubled: int = i * 2;
+        for (j: int = 0; j < 2; j = j + 1) {
+            let mut step: int = doubled + j;
+            step = step - 1;
+            sum = sum + step;
+        }
+    }
+    return sum;
+}
+)";
+}
+
+// setup of the run allocates (frames, globals) - the loop body itself must not, whatever the iteration count
+BOOST_AUTO_TEST_CASE(int_loop_does_not_allocate_test) {
+    BOOST_CHECK_EQUAL(count_run_allocations(int_loop_source(10)), count_run_allocations(int_loop_source(1000)));
+}
+
+BOOST_AUTO_TEST_CASE(scalar_loop_does_not_allocate_test) {
+    BOOST_CHECK_EQUAL(count_run_allocations(scalar_loop_source(10)), count_run_allocations(scalar_loop_source(1000)));
+}
+
+BOOST_AUTO_TEST_CASE(declaring_loop_reuses_pooled_variables_test) {
+    BOOST_CHECK_EQUAL(count_run_allocations(declaring_loop_source(10)),
+                      count_run_allocations(declaring_loop_source(1000)));
+}
+
+BOOST_AUTO_TEST_CASE(call_frames_recycled_on_exit_test) {
+    auto source = [](int calls) {
+        return "def square(n: int) -> int {\n let mut result: int = n * n;\n return result;\n}\n"
+               "def main() -> int {\n let mut sum: int = 0;\n for (i: int = 0; i < " +
+               std::to_string(calls) + "; i = i + 1) {\n sum = sum + square(i);\n }\n return 0;\n}\n";
+    };
+    auto few{count_subsystem_allocations(source(10))};
+    auto many{count_subsystem_allocations(source(1000))};
+
+    // frames, scopes and parameters of finished calls are reused from the pool
+    auto environment{static_cast<std::size_t>(MemSubsystem::ENVIRONMENT)};
+    BOOST_CHECK_EQUAL(few[environment], many[environment]);
+}
+
+BOOST_AUTO_TEST_CASE(calls_do_not_allocate_test) {
+    auto source = [](int calls) {
+        return "def add(a: int, b: int) -> int {\n return a + b;\n}\n"
+               "def main() -> int {\n let add_one: function<int:int> = (1) >> add;\n let mut sum: int = 0;\n"
+               " for (i: int = 0; i < " +
+               std::to_string(calls) + "; i = i + 1) {\n sum = add(sum, add_one(i));\n }\n return 0;\n}\n";
+    };
+    BOOST_CHECK_EQUAL(count_run_allocations(source(10)), count_run_allocations(source(1000)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,115 @@
+#include <boost/test/unit_test.hpp>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "checked_arithmetic.hpp"
+
+namespace {
+using wide = __int128;
+
+template <typename T>
+std::vector<T> interesting_values() {
+    constexpr T max{std::numeric_limits<T>::max()};
+    constexpr T min{std::numeric_limits<T>::min()};
+    return {0, 1, -1, 2, -2, max, max - 1, min, min + 1, max / 2, min / 2, max / 2 + 1, min / 2 - 1};
+}
+
+template <typename T>
+Checked<T> reference(char operation, T left, T right) {
+    wide lhs{left};
+    wide rhs{right};
+    wide result{};
+    switch (operation) {
+        case '+':
+            result = lhs + rhs;
+            break;
+        case '-':
+            result = lhs - rhs;
+            break;
+        case '*':
+            result = lhs * rhs;
+            break;
+        case '/':
+            if (rhs == 0) return {T{}, ArithmeticStatus::DIV_BY_ZERO};
+            result = lhs / rhs;
+            break;
+    }
+    if (result > std::numeric_limits<T>::max() or result < std::numeric_limits<T>::min()) {
+        return {T{}, ArithmeticStatus::INT_OVERFLOW};
+    }
+    return {static_cast<T>(result), ArithmeticStatus::OK};
+}
+
+template <typename T>
+Checked<T> checked(char operation, T left, T right) {
+    switch (operation) {
+        case '+':
+            return CheckedArithmetic::add(left, right);
+        case '-':
+            return CheckedArithmetic::subtract(left, right);
+        case '*':
+            return CheckedArithmetic::multiply(left, right);
+        default:
+            return CheckedArithmetic::divide(left, right);
+    }
+}
+
+template <typename T>
+void check_against_reference(T left, T right) {
+    for (char operation : {'+', '-', '*', '/'}) {
+        Checked<T> expected{reference(operation, left, right)};
+        Checked<T> result{checked(operation, left, right)};
+        BOOST_TEST_CONTEXT(left << ' ' << operation << ' ' << right) {
+            BOOST_REQUIRE(result.status == expected.status);
+            if (expected.ok()) BOOST_REQUIRE_EQUAL(result.value, expected.value);
+        }
+    }
+}
+
+template <typename T>
+void run_properties() {
+    std::vector<T> values{interesting_values<T>()};
+    for (T left : values) {
+        for (T right : values) check_against_reference(left, right);
+    }
+
+    std::mt19937_64 generator{2024};
+    std::uniform_int_distribution<T> full_range{};
+    std::uniform_int_distribution<T> small_range{-70000, 70000};
+    std::uniform_int_distribution<std::size_t> pick_special{0, values.size() - 1};
+    for (int i = 0; i < 20000; ++i) {
+        check_against_reference(full_range(generator), full_range(generator));
+        check_against_reference(small_range(generator), small_range(generator));
+        check_against_reference(values[pick_special(generator)], full_range(generator));
+    }
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(checked_arithmetic_tests)
+
+BOOST_AUTO_TEST_CASE(int_kernels_match_wide_arithmetic_test) {
+    run_properties<int>();
+}
+
+BOOST_AUTO_TEST_CASE(int64_kernels_match_wide_arithmetic_test) {
+    run_properties<std::int64_t>();
+}
+
+BOOST_AUTO_TEST_CASE(negate_matches_wide_arithmetic_test) {
+    for (std::int64_t val : interesting_values<std::int64_t>()) {
+        Checked<std::int64_t> expected{reference<std::int64_t>('-', 0, val)};
+        Checked<std::int64_t> result{CheckedArithmetic::negate(val)};
+        BOOST_TEST_CONTEXT("-" << val) {
+            BOOST_REQUIRE(result.status == expected.status);
+            if (expected.ok()) BOOST_REQUIRE_EQUAL(result.value, expected.value);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(float_division_test) {
+    BOOST_CHECK(CheckedArithmetic::divide(1.0, 0.0).status == ArithmeticStatus::DIV_BY_ZERO);
+    BOOST_CHECK_EQUAL(CheckedArithmetic::divide(1.0, 4.0).value, 0.25);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
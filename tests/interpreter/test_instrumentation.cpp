@@ -0,0 +1,231 @@
+#include <boost/test/unit_test.hpp>
+#include <sstream>
+
+#include "hot_spots.hpp"
+#include "instrumented_interpreter.hpp"
+#include "lexer.hpp"
+#include "parser.hpp"
+#include "sampling_profiler.hpp"
+#include "trace_events.hpp"
+
+BOOST_AUTO_TEST_SUITE(instrumentation_tests)
+
+namespace {
+std::unique_ptr<Program> parse(std::string source_code) {
+    std::unique_ptr<std::istream> source = std::make_unique<std::stringstream>(source_code);
+    auto handler = std::make_unique<SourceHandler>(std::move(source));
+    Parser parser{std::make_unique<Lexer>(std::move(handler))};
+    return parser.parse_program();
+}
+
+const std::string loop_source{R"(def add(a: int, b: int) -> int {
+    return a + b;
+}
+def main() -> int {
+    let mut sum: int = 0;
+    for (i: int = 0; i < 5; i = i + 1) {
+        sum = add(sum, i);
+    }
+    return 0;
+}
+)"};
+
+// first loop is a counted one, assignment to the counter keeps the second on the general path
+const std::string counted_and_general_loop_source{R"(def main() -> int {
+    for (i: int = 0; i < 5; i = i + 1) {
+        let k: int = i;
+    }
+    for (j: int = 0; j < 5; j = j + 1) {
+        j = j;
+    }
+    return 0;
+}
+)"};
+
+// silences output of the interpreted program
+struct CoutSilencer {
+    std::stringstream buffer{};
+    std::streambuf* old{std::cout.rdbuf(buffer.rdbuf())};
+    ~CoutSilencer() {
+        std::cout.rdbuf(old);
+    }
+};
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(counting_policy_test) {
+    auto program{parse(loop_source)};
+    InstrumentedInterpreter<CountingPolicy> interpreter{};
+    program->accept(interpreter);
+
+    CountingPolicy& counts{interpreter.get_policy()};
+    BOOST_CHECK_EQUAL(counts.get_count(NodeKind::PROGRAM), 1);
+    BOOST_CHECK_EQUAL(counts.get_count(NodeKind::FUNCTION_DEFINITION), 2);
+    BOOST_CHECK_EQUAL(counts.get_count(NodeKind::FOR_LOOP), 1);
+    BOOST_CHECK_EQUAL(counts.get_count(NodeKind::FUNCTION_CALL), 5);
+    BOOST_CHECK_EQUAL(counts.get_count(NodeKind::RETURN_STATEMENT), 6);
+    BOOST_CHECK_EQUAL(counts.get_count(NodeKind::ELSE_IF), 0);
+}
+
+BOOST_AUTO_TEST_CASE(counting_policy_counted_loop_test) {
+    auto program{parse(counted_and_general_loop_source)};
+    InstrumentedInterpreter<CountingPolicy> interpreter{};
+    program->accept(interpreter);
+
+    // both loops: 6 conditions and 5 updates, the second one also 5 assignments in the body
+    CountingPolicy& counts{interpreter.get_policy()};
+    BOOST_CHECK_EQUAL(counts.get_count(NodeKind::FOR_LOOP), 2);
+    BOOST_CHECK_EQUAL(counts.get_count(NodeKind::ASSIGN_STATEMENT), 15);
+    BOOST_CHECK_EQUAL(counts.get_count(NodeKind::BINARY_EXPRESSION), 22);
+}
+
+BOOST_AUTO_TEST_CASE(tracing_policy_test) {
+    auto program{parse("def main() -> int {\n    return 1 + 2;\n}\n")};
+    std::stringstream trace{};
+    InstrumentedInterpreter<TracingPolicy> interpreter{TracingPolicy{trace}};
+    program->accept(interpreter);
+
+    std::string expected{
+        "Program [1:1]\n"
+        "  FunctionDefinition [1:1]\n"
+        "  CodeBlock [1:19]\n"
+        "    ReturnStatement [2:5]\n"
+        "      BinaryExpression [2:12]\n"
+        "        LiteralInt [2:12]\n"
+        "        LiteralInt [2:16]\n"};
+    BOOST_CHECK_EQUAL(trace.str(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(hooks_balanced_on_error_test) {
+    auto program{parse("def main() -> int {\n    let x: int = 1 / 0;\n    return x;\n}\n")};
+    std::stringstream trace{};
+    InstrumentedInterpreter<TracingPolicy> tracing{TracingPolicy{trace}};
+    BOOST_CHECK_THROW(program->accept(tracing), DivByZeroException);
+
+    InstrumentedInterpreter<TimingPolicy> timing{};
+    BOOST_CHECK_THROW(program->accept(timing), DivByZeroException);
+    std::stringstream report{};
+    timing.get_policy().report(report);
+    BOOST_CHECK(report.str().find("BinaryExpression") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(no_instrumentation_matches_interpreter_test) {
+    auto program{parse("def main() -> int {\n    print((2 * 21) as string);\n    return 0;\n}\n")};
+    std::string outputs[2];
+    {
+        CoutSilencer silencer{};
+        Interpreter interpreter{};
+        program->accept(interpreter);
+        outputs[0] = silencer.buffer.str();
+    }
+    {
+        CoutSilencer silencer{};
+        InstrumentedInterpreter<NoInstrumentation> interpreter{};
+        program->accept(interpreter);
+        outputs[1] = silencer.buffer.str();
+    }
+    BOOST_CHECK_EQUAL(outputs[0], "42\n");
+    BOOST_CHECK_EQUAL(outputs[0], outputs[1]);
+}
+
+BOOST_AUTO_TEST_CASE(hot_spot_report_test) {
+    auto program{parse(loop_source)};
+    InstrumentedInterpreter<HitCountingPolicy> interpreter{};
+    program->accept(interpreter);
+    HotSpotReport report{interpreter.get_policy()};
+    program->accept(report);
+
+    BOOST_CHECK_EQUAL(report.get_line_hits(1), 5);  // calls of add
+    BOOST_CHECK_EQUAL(report.get_line_hits(2), 5);
+    BOOST_CHECK_EQUAL(report.get_line_hits(5), 1);
+    BOOST_CHECK_EQUAL(report.get_line_hits(6), 6);  // loop condition
+    BOOST_CHECK_EQUAL(report.get_line_hits(7), 5);
+    BOOST_CHECK_EQUAL(report.get_line_hits(8), 0);
+
+    std::stringstream printed{};
+    report.print(printed, 3);
+    std::string expected_hot_spots{
+        "hot spots:\n"
+        "           5  ReturnStatement       [2:5]\n"
+        "           5  AssignStatement       [6:29]\n"
+        "           5  AssignStatement       [7:9]\n"};
+    BOOST_CHECK(printed.str().find(expected_hot_spots) != std::string::npos);
+    BOOST_CHECK(printed.str().find("           5     7 |         sum = add(sum, i);\n") != std::string::npos);
+    BOOST_CHECK(printed.str().find("for at [6:5]: entered 1 times, 5 iterations") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(hot_spots_same_for_counted_loop_test) {
+    auto program{parse(counted_and_general_loop_source)};
+    InstrumentedInterpreter<HitCountingPolicy> interpreter{};
+    program->accept(interpreter);
+    HotSpotReport report{interpreter.get_policy()};
+    program->accept(report);
+
+    BOOST_CHECK_EQUAL(report.get_line_hits(2), 6);
+    BOOST_CHECK_EQUAL(report.get_line_hits(2), report.get_line_hits(5));
+    BOOST_CHECK_EQUAL(report.get_line_hits(3), report.get_line_hits(6));
+
+    std::stringstream printed{};
+    report.print(printed);
+    BOOST_CHECK(printed.str().find("AssignStatement       [2:29]") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(trace_events_test) {
+    auto program{parse(R"(def inc(x: int) -> int {
+    return x + 1;
+}
+def main() -> int {
+    let inc_twice: function<int:int> = inc & inc;
+    let three: function<none:int> = (1) >> inc_twice;
+    for (i: int = 0; i < 2; i = i + 1) {
+        three();
+    }
+    return 0;
+}
+)")};
+    TraceEvents::events.clear();
+    TraceEvents::enabled = true;
+    Interpreter interpreter{};
+    program->accept(interpreter);
+    TraceEvents::enabled = false;
+
+    std::vector<std::string> names{};
+    for (const TraceEvent& event : TraceEvents::events) names.push_back(event.name);
+    // events are recorded when they end - nested ones first
+    std::vector<std::string> expected{"inc", "inc", "composed function", "bound function",
+                                      "inc", "inc", "composed function", "bound function",
+                                      "for", "main"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(names.begin(), names.end(), expected.begin(), expected.end());
+    BOOST_CHECK_EQUAL(TraceEvents::events[8].position, "[7:5]");
+    BOOST_CHECK(TraceEvents::events[9].duration_us >= TraceEvents::events[8].duration_us);
+    TraceEvents::events.clear();
+}
+
+BOOST_AUTO_TEST_CASE(shadow_stack_test) {
+    auto program{parse(R"(def divide(a: int) -> int {
+    return a / 0;
+}
+def outer() -> int {
+    return divide(1);
+}
+def main() -> int {
+    return outer();
+}
+)")};
+    const FunctionDefinition& divide{*program->function_definitions[0]};
+    const FunctionDefinition& outer{*program->function_definitions[1]};
+    {
+        SamplingProfiler::ShadowFrame outer_frame{outer};
+        SamplingProfiler::ShadowFrame divide_frame{divide};
+        BOOST_CHECK_EQUAL(SamplingProfiler::shadow_depth, 2);
+        BOOST_CHECK(SamplingProfiler::shadow_stack[0] == &outer);
+        BOOST_CHECK(SamplingProfiler::shadow_stack[1] == &divide);
+    }
+    BOOST_CHECK_EQUAL(SamplingProfiler::shadow_depth, 0);
+
+    // frames of functions left by an exception are popped too
+    Interpreter interpreter{};
+    BOOST_CHECK_THROW(program->accept(interpreter), DivByZeroException);
+    BOOST_CHECK_EQUAL(SamplingProfiler::shadow_depth, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
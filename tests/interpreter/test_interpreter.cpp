@@ -3,10 +3,16 @@
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include "bind_front_function.hpp"
+#include "builtint_functions.hpp"
+#include "counted_loop.hpp"
+#include "composed_function.hpp"
 #include "interpreter.hpp"
 #include "lexer.hpp"
+#include "oper_handler.hpp"
 #include "parser.hpp"
 #include "source_handler.hpp"
+#include "type_handler.hpp"
 
 std::unique_ptr<Program> get_program(std::string mock_file) {
     std::unique_ptr<std::istream> source = std::make_unique<std::stringstream>(mock_file);
@@ -281,6 +287,35 @@ def main() -> int {
     BOOST_CHECK(output == expected_output);
 }
 
+BOOST_AUTO_TEST_CASE(left_operand_read_before_right_test) {
+    std::string expected_output{"3\n2\n"};
+    std::string mock_file = R"(
+def inc(mut a: int) -> int {
+    a = a + 1;
+    return a;
+}
+
+def main() -> int {
+    let mut x: int = 1;
+    let y: int = x + inc(x);
+    print(y as string);
+    print(x as string);
+    return 0;
+}
+)";
+    Interpreter interpreter{};
+    auto program{get_program(mock_file)};
+    std::stringstream buffer;
+    std::streambuf* old = std::cout.rdbuf(buffer.rdbuf());
+
+    program->accept(interpreter);
+
+    std::string output = buffer.str();
+    std::cout.rdbuf(old);
+
+    BOOST_CHECK_EQUAL(output, expected_output);
+}
+
 BOOST_AUTO_TEST_CASE(addition_int_test) {
     std::string expected_output{"5\n0\n-7\n"};
     std::string mock_file = R"(
@@ -1432,6 +1467,305 @@ def main() -> int {
     BOOST_CHECK(output == expected_output);
 }
 
+BOOST_AUTO_TEST_CASE(int64_arithmetic_test) {
+    std::string expected_output{"4294967296\n9223372036854775807\n-9223372036854775808\n3000000000\n"};
+    std::string mock_file = R"(
+def main() -> int {
+    let big: int = 65536 * 65536;
+    print(big as string);
+    print((9223372036854775806 + 1) as string);
+    print((-9223372036854775807 - 1) as string);
+    print(("3000000000" as int) as string);
+    return 0;
+}
+)";
+    Interpreter interpreter{};
+    auto program{get_program(mock_file)};
+    std::stringstream buffer;
+    std::streambuf* old = std::cout.rdbuf(buffer.rdbuf());
+
+    program->accept(interpreter);
+
+    std::string output = buffer.str();
+    std::cout.rdbuf(old);
+
+    BOOST_CHECK(output == expected_output);
+}
+
+BOOST_AUTO_TEST_CASE(string_building_loop_test) {
+    std::string expected_output{"0123456789|012\n10\n"};
+    std::string mock_file = R"(
+def main() -> int {
+    let mut built: string = "";
+    let mut snapshot: string = "";
+    for (i: int = 0; i < 10; i = i + 1) {
+        built = built + i as string;
+        if (i == 2) {
+            snapshot = built;
+        }
+    }
+    print(built + "|" + snapshot);
+    print((built as int / 12345678) as string);
+    return 0;
+}
+)";
+    Interpreter interpreter{};
+    auto program{get_program(mock_file)};
+    std::stringstream buffer;
+    std::streambuf* old = std::cout.rdbuf(buffer.rdbuf());
+
+    program->accept(interpreter);
+
+    std::string output = buffer.str();
+    std::cout.rdbuf(old);
+
+    BOOST_CHECK(output == expected_output);
+}
+
+BOOST_AUTO_TEST_CASE(call_site_cache_test) {
+    std::string expected_output{"2\n3\n20\n3\n"};
+    std::string mock_file = R"(
+def double(x: int) -> int { return x * 2; }
+def triple(x: int) -> int { return x * 3; }
+def mul(a: int, b: int) -> int { return a * b; }
+def apply(f: function<int:int>, x: int) -> none {
+    print(f(x) as string);
+}
+def main() -> int {
+    apply(double, 1);
+    apply(triple, 1);
+    apply((10) >> mul, 2);
+    apply(triple, 1);
+    return 0;
+}
+)";
+    auto program{get_program(mock_file)};
+    std::string first_run_output{};
+    for (int run = 0; run < 2; ++run) {
+        Interpreter interpreter{};
+        std::stringstream buffer;
+        std::streambuf* old = std::cout.rdbuf(buffer.rdbuf());
+
+        program->accept(interpreter);
+
+        std::cout.rdbuf(old);
+        if (run == 0) first_run_output = buffer.str();
+        BOOST_CHECK(buffer.str() == first_run_output);
+    }
+    BOOST_CHECK(first_run_output == expected_output);
+}
+
+BOOST_AUTO_TEST_CASE(composition_pipeline_test) {
+    std::string expected_output{"8\n8\n18\n"};
+    std::string mock_file = R"(
+def inc(x: int) -> int {
+    return x + 1;
+}
+def twice(x: int) -> int {
+    let y: int = x * 2;
+    return y;
+}
+def main() -> int {
+    let f: function<int:int> = inc & twice;
+    let g: function<int:int> = f & inc & f;
+    let h: function<int:int> = (inc & inc) & (twice & (inc & twice));
+    for (i: int = 3; i < 4; i = i + 1) {
+        print(f(i) as string);
+        print(g(0) as string);
+        print(h(2) as string);
+    }
+    return 0;
+}
+)";
+    Interpreter interpreter{};
+    auto program{get_program(mock_file)};
+    std::stringstream buffer;
+    std::streambuf* old = std::cout.rdbuf(buffer.rdbuf());
+
+    program->accept(interpreter);
+
+    std::string output = buffer.str();
+    std::cout.rdbuf(old);
+
+    BOOST_CHECK(output == expected_output);
+}
+
+BOOST_AUTO_TEST_CASE(composition_flattened_test) {
+    Type int_to_int{FunctionTypeInfo{{VariableType{Type{TypeKind::INT}}}, Type{TypeKind::INT}}};
+    auto identity = [](Interpreter&, const arg_list& args) -> std::optional<value> {
+        return TypeHandler::get_value_as<int_value>(args[0]);
+    };
+    sp_callable f{make_rc<BuiltinFunction>(int_to_int, identity)};
+    sp_callable g{make_rc<BuiltinFunction>(int_to_int, identity)};
+
+    sp_callable f_g{OperHandler::compose_functions(f, g)};
+    sp_callable chain{OperHandler::compose_functions(OperHandler::compose_functions(f_g, f), f_g)};
+
+    auto composed = dynamic_cast<const ComposedFunction*>(chain.get());
+    BOOST_REQUIRE(composed);
+    std::vector<sp_callable> expected_stages{f, g, f, f, g};
+    BOOST_CHECK(composed->get_stages() == expected_stages);
+    BOOST_CHECK(chain->get_type() == int_to_int);
+}
+
+BOOST_AUTO_TEST_CASE(counted_loops_test) {
+    std::string expected_output{"0 2 4 |3 2 1 0 |0 1 3 |0 1 2 |0 2 |"};
+    std::string mock_file = R"(
+def skip(mut counter: int) -> none {
+    counter = counter + 1;
+}
+def main() -> int {
+    let mut out: string = "";
+    for (i: int = 0; i < 6; i = i + 2) {
+        out = out + i as string + " ";
+    }
+    out = out + "|";
+    for (i: int = 3; i >= 0; i = i - 1) {
+        out = out + i as string + " ";
+    }
+    out = out + "|";
+    let mut bound: int = 2;
+    for (i: int = 0; i <= bound; i = i + 1) {
+        out = out + i as string + " ";
+        if (i == 1) {
+            bound = 3;
+            i = i + 1;
+        }
+    }
+    out = out + "|";
+    for (i: int = 0; i < 100; i = i + 1) {
+        if (i == 3) {
+            break;
+        }
+        out = out + i as string + " ";
+    }
+    out = out + "|";
+    for (i: int = 0; i < 4; i = i + 1) {
+        out = out + i as string + " ";
+        skip(i);
+    }
+    out = out + "|";
+    print(out);
+    return 0;
+}
+)";
+    Interpreter interpreter{};
+    auto program{get_program(mock_file)};
+    std::stringstream buffer;
+    std::streambuf* old = std::cout.rdbuf(buffer.rdbuf());
+
+    program->accept(interpreter);
+
+    std::string output = buffer.str();
+    std::cout.rdbuf(old);
+
+    BOOST_CHECK_EQUAL(output, expected_output + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(counted_loop_shape_test) {
+    auto program{get_program(R"(
+def main() -> int {
+    let n: int = 3;
+    for (i: int = 0; i < n; i = i + 1) {}
+    for (i: int = 0; i < 3; i = i + 1) {
+        i = i + 1;
+    }
+    for (i: int = 0; i != 3; i = i + 1) {}
+    for (i: int = 10; i > 0; i = i - 2) {}
+    return 0;
+}
+)")};
+    auto& statements{dynamic_cast<const CodeBlock&>(*program->function_definitions[0]->body).statements};
+    auto shape = [&](std::size_t index) {
+        return CountedLoop::match(dynamic_cast<const ForLoop&>(*statements[index]));
+    };
+
+    BOOST_CHECK(shape(1).matches and shape(1).bound_variable);
+    BOOST_CHECK(not shape(2).matches);
+    BOOST_CHECK(not shape(3).matches);
+    BOOST_CHECK(shape(4).matches and shape(4).step_kind == ExprKind::SUBTRACTION and shape(4).step == 2);
+}
+
+BOOST_AUTO_TEST_CASE(blocks_without_declarations_test) {
+    std::string expected_output{"2\n1\n3\n"};
+    std::string mock_file = R"(
+def main() -> int {
+    let mut x: int = 0;
+    {
+        x = x + 1;
+        {
+            let x: int = 2;
+            print(x as string);
+        }
+        print(x as string);
+    }
+    for (i: int = 0; i < 2; i = i + 1) {
+        x = x + 1;
+    }
+    print(x as string);
+    return 0;
+}
+)";
+    Interpreter interpreter{};
+    auto program{get_program(mock_file)};
+    std::stringstream buffer;
+    std::streambuf* old = std::cout.rdbuf(buffer.rdbuf());
+
+    program->accept(interpreter);
+
+    std::string output = buffer.str();
+    std::cout.rdbuf(old);
+
+    BOOST_CHECK(output == expected_output);
+}
+
+BOOST_AUTO_TEST_CASE(bind_front_merge_test) {
+    std::string expected_output{"1 2 3\n1 2 3\n3 2 1\n"};
+    std::string mock_file = R"(
+def show(a: int, b: int, c: int) -> none {
+    print(a as string + " " + b as string + " " + c as string);
+}
+def main() -> int {
+    let one: function<int, int:none> = (1) >> show;
+    let one_two: function<int:none> = (2) >> one;
+    let all: function<none:none> = (3) >> one_two;
+    one_two(3);
+    all();
+    ((1) >> ((2) >> ((3) >> show)))();
+    return 0;
+}
+)";
+    Interpreter interpreter{};
+    auto program{get_program(mock_file)};
+    std::stringstream buffer;
+    std::streambuf* old = std::cout.rdbuf(buffer.rdbuf());
+
+    program->accept(interpreter);
+
+    std::string output = buffer.str();
+    std::cout.rdbuf(old);
+
+    BOOST_CHECK(output == expected_output);
+}
+
+BOOST_AUTO_TEST_CASE(bind_front_collapsed_test) {
+    Type int_int_to_int{FunctionTypeInfo{{VariableType{Type{TypeKind::INT}}, VariableType{Type{TypeKind::INT}}},
+                                         Type{TypeKind::INT}}};
+    auto subtract = [](Interpreter&, const arg_list& args) -> std::optional<value> {
+        return TypeHandler::get_value_as<int_value>(args[0]) - TypeHandler::get_value_as<int_value>(args[1]);
+    };
+    sp_callable target{make_rc<BuiltinFunction>(int_int_to_int, subtract)};
+
+    sp_callable first{OperHandler::bind_front_function(target, {value{int_value{10}}})};
+    sp_callable both{OperHandler::bind_front_function(first, {value{int_value{4}}})};
+
+    auto bound = dynamic_cast<const BindFrontFunction*>(both.get());
+    BOOST_REQUIRE(bound);
+    BOOST_CHECK(bound->get_target() == target);
+    BOOST_CHECK_EQUAL(bound->get_bound_args().size(), 2);
+    BOOST_CHECK((both->get_type() == Type{FunctionTypeInfo{{}, Type{TypeKind::INT}}}));
+}
+
 // EXCEPTION TESTS
 
 namespace bdata = boost::unit_test::data;
@@ -1501,6 +1835,7 @@ std::vector<std::string> cannot_cast_exception_cases = {
     R"(def main() -> int { let x: int = "" as int; return 0; })",
     R"(def main() -> int { let x: int = "12.3.4" as int; return 0; })",
     R"(def main() -> int { let x: int = "99999999999999999999" as int; return 0; })",
+    R"(def main() -> int { let x: int = (9000000000000000000.0 * 2.0) as int; return 0; })",
     R"(def main() -> int { let x: int = print as int; return 0; })",
     R"(def main() -> int { let x: float = "abc" as float; return 0; })",
     R"(def main() -> int { let x: float = "" as float; return 0; })",
@@ -2172,22 +2507,35 @@ BOOST_DATA_TEST_CASE(condition_must_be_bool_exception_test, bdata::make(conditio
 std::vector<std::string> int_overflow_exception_cases = {
     R"(
 def main() -> int {
-    let x: int = 2147483647;
+    let x: int = 9223372036854775807;
     let y: int = x + 1;
     return 0;
 }
     )",
     R"(
 def main() -> int {
-    let x: int = 1073741824;
-    let y: int = x * 4;
+    let x: int = 4611686018427387904;
+    let y: int = x * 2;
+    return 0;
+}
+    )",
+    R"(
+def main() -> int {
+    let x: int = -9223372036854775807;
+    let y: int = x - 2;
+    return 0;
+}
+    )",
+    R"(
+def main() -> int {
+    for (i: int = 9223372036854775806; i > 0; i = i + 1) {}
     return 0;
 }
     )",
     R"(
 def main() -> int {
-    let x: int = -2147483648;
-    let y: int = x - 1;
+    let m: int = -9223372036854775807 - 1;
+    let y: int = -m;
     return 0;
 }
     )",
@@ -2199,6 +2547,44 @@ BOOST_DATA_TEST_CASE(int_overflow_exception_test, bdata::make(int_overflow_excep
     BOOST_CHECK_THROW(program->accept(interpreter), IntOverflowException);
 }
 
+BOOST_AUTO_TEST_CASE(operator_error_position_test) {
+    auto error_message = [](const std::string& mock_file) -> std::string {
+        Interpreter interpreter{};
+        auto program = get_program(mock_file);
+        try {
+            program->accept(interpreter);
+        } catch (const InterpreterException& e) {
+            return e.what();
+        }
+        return "";
+    };
+    auto ends_with = [](const std::string& message, const std::string& suffix) {
+        return message.size() >= suffix.size() and message.ends_with(suffix) and
+               message.find(" at: ") == message.rfind(" at: ");
+    };
+
+    std::string in_callee{error_message(R"(def half(x: int) -> int {
+    return x / 0;
+}
+def main() -> int {
+    let y: int = 1 + half(4);
+    return 0;
+})")};
+    BOOST_CHECK_MESSAGE(ends_with(in_callee, " at: [2:12]"), in_callee);
+
+    std::string bind{error_message(R"(def main() -> int {
+    let f: function<none:none> = (1, 2) >> print;
+    return 0;
+})")};
+    BOOST_CHECK_MESSAGE(ends_with(bind, " at: [2:34]"), bind);
+
+    std::string call{error_message(R"(def main() -> int {
+    let x: int = 1 + print(3);
+    return 0;
+})")};
+    BOOST_CHECK_MESSAGE(ends_with(call, " at: [2:22]"), call);
+}
+
 std::vector<std::string> div_by_zero_exception_cases = {
     // Dzielenie int przez zero
     R"(
@@ -0,0 +1,78 @@
+#include <boost/test/data/monomorphic.hpp>
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/unit_test.hpp>
+#include <tuple>
+
+#include "oper_handler.hpp"
+#include "quickening.hpp"
+
+std::ostream& operator<<(std::ostream& os, const ExprKind& kind) {
+    return os << expr_kind_to_str(kind);
+}
+
+namespace bdata = boost::unit_test::data;
+
+namespace {
+value generic_result(ExprKind kind, const value& left, const value& right) {
+    switch (kind) {
+        case ExprKind::ADDITION:
+            return OperHandler::add(left, right);
+        case ExprKind::SUBTRACTION:
+            return OperHandler::subtract(left, right);
+        case ExprKind::MULTIPICATION:
+            return OperHandler::multiply(left, right);
+        case ExprKind::DIVISION:
+            return OperHandler::divide(left, right);
+        case ExprKind::EQUAL:
+            return OperHandler::check_eq(left, right);
+        case ExprKind::NOT_EQUAL:
+            return OperHandler::check_neq(left, right);
+        case ExprKind::LESS:
+            return OperHandler::check_lt(left, right);
+        case ExprKind::LESS_EQUAL:
+            return OperHandler::check_lteq(left, right);
+        case ExprKind::GREATER:
+            return OperHandler::check_gt(left, right);
+        case ExprKind::GREATER_EQUAL:
+            return OperHandler::check_gteq(left, right);
+        case ExprKind::LOGICAL_AND:
+            return OperHandler::logical_and(left, right);
+        case ExprKind::LOGICAL_OR:
+            return OperHandler::logical_or(left, right);
+        default:
+            throw std::logic_error("not a quickened kind");
+    }
+}
+}  // namespace
+
+const std::vector<ExprKind> quickened_kinds{
+    ExprKind::ADDITION, ExprKind::SUBTRACTION, ExprKind::MULTIPICATION, ExprKind::DIVISION,
+    ExprKind::EQUAL,    ExprKind::NOT_EQUAL,   ExprKind::LESS,          ExprKind::LESS_EQUAL,
+    ExprKind::GREATER,  ExprKind::GREATER_EQUAL, ExprKind::LOGICAL_AND, ExprKind::LOGICAL_OR,
+};
+
+const std::vector<std::tuple<value, value>> quickening_operands{
+    {7, 3}, {-4, 4}, {2.5, 0.5}, {1.0, 1.0}, {std::string{"ab"}, std::string{"b"}}, {true, false}, {false, false},
+};
+
+BOOST_DATA_TEST_CASE(quickened_matches_generic_test, bdata::make(quickened_kinds) * bdata::make(quickening_operands),
+                     kind, left, right) {
+    QuickenedOp op{Quickening::select(kind, left, right)};
+    if (op == QuickenedOp::GENERIC) {
+        BOOST_CHECK_THROW(generic_result(kind, left, right), CantPerformOperationException);
+        return;
+    }
+    auto result = Quickening::execute(op, left, right);
+    BOOST_REQUIRE(result.has_value());
+    BOOST_REQUIRE(result->ok());
+    BOOST_CHECK(result->value == generic_result(kind, left, right));
+}
+
+BOOST_AUTO_TEST_CASE(quickened_guard_test) {
+    QuickenedOp op{Quickening::select(ExprKind::ADDITION, 1, 2)};
+    BOOST_CHECK(op == QuickenedOp::INT_ADD);
+    BOOST_CHECK(not Quickening::execute(op, 1.0, 2.0).has_value());
+    BOOST_CHECK(Quickening::select(ExprKind::ADDITION, 1, 2.0) == QuickenedOp::GENERIC);
+    BOOST_CHECK(Quickening::execute(op, std::numeric_limits<int_value>::max(), int_value{1})->status == ArithmeticStatus::INT_OVERFLOW);
+    BOOST_CHECK(Quickening::execute(QuickenedOp::INT_DIV, 1, 0)->status == ArithmeticStatus::DIV_BY_ZERO);
+}
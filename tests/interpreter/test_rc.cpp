@@ -0,0 +1,83 @@
+#include <boost/test/unit_test.hpp>
+
+#include "callable.hpp"
+#include "rc.hpp"
+
+BOOST_AUTO_TEST_SUITE(rc_tests)
+
+namespace {
+struct Counted : RcCounted {
+    explicit Counted(int& destroyed) : destroyed{destroyed} {}
+    ~Counted() {
+        ++destroyed;
+    }
+    int& destroyed;
+};
+
+// resource counting outstanding blocks, backed by new/delete
+class TrackingResource : public std::pmr::memory_resource {
+   public:
+    int outstanding{0};
+
+   private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++outstanding;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override {
+        --outstanding;
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(copies_share_object_test) {
+    int destroyed{0};
+    {
+        Rc<Counted> first{make_rc<Counted>(destroyed)};
+        BOOST_CHECK_EQUAL(first.use_count(), 1);
+        {
+            Rc<Counted> second{first};
+            Rc<Counted> third{};
+            third = second;
+            BOOST_CHECK_EQUAL(first.use_count(), 3);
+            BOOST_CHECK(third == first);
+        }
+        Rc<Counted> moved{std::move(first)};
+        BOOST_CHECK(first == nullptr);
+        BOOST_CHECK_EQUAL(moved.use_count(), 1);
+        BOOST_CHECK_EQUAL(destroyed, 0);
+    }
+    BOOST_CHECK_EQUAL(destroyed, 1);
+}
+
+BOOST_AUTO_TEST_CASE(copied_object_starts_without_owners_test) {
+    int destroyed{0};
+    Rc<Counted> original{make_rc<Counted>(destroyed)};
+    Rc<Counted> copy{make_rc<Counted>(*original)};
+    BOOST_CHECK_EQUAL(original.use_count(), 1);
+    BOOST_CHECK_EQUAL(copy.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(pooled_object_returns_to_resource_test) {
+    TrackingResource resource{};
+    {
+        sp_variable var{allocate_rc<Variable>(&resource, VariableType{Type{TypeKind::INT}}, int_value{4})};
+        VariableHolder holder{var};
+        BOOST_CHECK_EQUAL(resource.outstanding, 1);
+        BOOST_CHECK_EQUAL(var.use_count(), 2);
+    }
+    BOOST_CHECK_EQUAL(resource.outstanding, 0);
+}
+
+BOOST_AUTO_TEST_CASE(function_type_info_shared_between_types_test) {
+    Type function_type{FunctionTypeInfo{{}, Type{TypeKind::INT}}};
+    Type copy{function_type};
+    BOOST_CHECK(copy.function_type_info == function_type.function_type_info);
+    BOOST_CHECK_EQUAL(function_type.function_type_info.use_count(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,6 +1,8 @@
 #include <boost/test/data/monomorphic.hpp>
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/unit_test.hpp>
+#include <string>
+#include <vector>
 
 #include "scope.hpp"
 #include "type_handler.hpp"
@@ -8,45 +10,66 @@
 
 BOOST_AUTO_TEST_CASE(add_and_get_variable_test) {
     Scope scope;
-    auto var_h = VariableHolder{std::make_shared<Variable>(VariableType{TypeHandler::deduce_type(4)}, 4)};
-    scope.add_variable("x", var_h);
+    auto var_h = VariableHolder{make_rc<Variable>(VariableType{TypeHandler::deduce_type(4)}, 4)};
+    scope.add_variable(Symbols::intern("x"), var_h);
 
-    auto result = scope.get_variable("x");
+    auto result = scope.get_variable(Symbols::intern("x"));
     BOOST_CHECK(result.has_value() and result.value().var == var_h.var);
 }
 
 BOOST_AUTO_TEST_CASE(variable_not_found_test) {
     Scope scope;
-    auto result = scope.get_variable("y");
+    auto result = scope.get_variable(Symbols::intern("y"));
     BOOST_CHECK(not result);
 }
 
 BOOST_AUTO_TEST_CASE(contains_variable_test) {
     Scope scope;
-    auto var = std::make_shared<Variable>(VariableType{TypeHandler::deduce_type(0.12)}, 0.12);
-    scope.add_variable("z", var);
+    auto var = make_rc<Variable>(VariableType{TypeHandler::deduce_type(0.12)}, 0.12);
+    scope.add_variable(Symbols::intern("z"), var);
 
-    BOOST_CHECK(scope.contains_variable("z"));
-    BOOST_CHECK(!scope.contains_variable("not_exists"));
+    BOOST_CHECK(scope.contains_variable(Symbols::intern("z")));
+    BOOST_CHECK(!scope.contains_variable(Symbols::intern("not_exists")));
 }
 
 BOOST_AUTO_TEST_CASE(modify_variable_test) {
     Scope scope;
-    auto var = std::make_shared<Variable>(VariableType{TypeHandler::deduce_type(4)}, 4);
-    scope.add_variable("x", var);
+    auto var = make_rc<Variable>(VariableType{TypeHandler::deduce_type(4)}, 4);
+    scope.add_variable(Symbols::intern("x"), var);
 
     var->var_value = 8;
-    auto result = scope.get_variable("x");
-    BOOST_CHECK(result and result.value().get_value_as<int>() == 8);
+    auto result = scope.get_variable(Symbols::intern("x"));
+    BOOST_CHECK(result and result.value().get_value_as<int_value>() == 8);
 }
 
 BOOST_AUTO_TEST_CASE(modify_variable_after_get_test) {
     Scope scope;
-    auto var = std::make_shared<Variable>(VariableType{TypeHandler::deduce_type("Hello")}, "Hello");
-    scope.add_variable("x", var);
+    auto var = make_rc<Variable>(VariableType{TypeHandler::deduce_type("Hello")}, "Hello");
+    scope.add_variable(Symbols::intern("x"), var);
 
-    auto result = scope.get_variable("x");
+    auto result = scope.get_variable(Symbols::intern("x"));
     BOOST_CHECK(result);
     result.value().var->var_value = "Goodbye";
-    BOOST_CHECK(TypeHandler::get_value_as<std::string>(var->var_value) == "Goodbye");
-}
\ No newline at end of file
+    BOOST_CHECK(TypeHandler::get_value_as<StringValue>(var->var_value) == "Goodbye");
+}
+BOOST_AUTO_TEST_CASE(spill_past_inline_capacity_test) {
+    Scope scope;
+    std::vector<sp_variable> vars{};
+    for (std::size_t i = 0; i < 2 * Scope::INLINE_CAPACITY; ++i) {
+        vars.push_back(make_rc<Variable>(VariableType{TypeHandler::deduce_type(4)}, int_value{static_cast<int>(i)}));
+        scope.add_variable(Symbols::intern("spilled_" + std::to_string(i)), vars.back());
+    }
+
+    for (std::size_t i = 0; i < vars.size(); ++i) {
+        auto result = scope.get_variable(Symbols::intern("spilled_" + std::to_string(i)));
+        BOOST_CHECK(result and result.value().var == vars[i]);
+    }
+    BOOST_CHECK(!scope.contains_variable(Symbols::intern("spilled_not_declared")));
+}
+
+BOOST_AUTO_TEST_CASE(interned_names_test) {
+    symbol_id first{Symbols::intern("interned")};
+    BOOST_CHECK_EQUAL(Symbols::intern(std::string{"inter"} + "ned"), first);
+    BOOST_CHECK(Symbols::intern("other") != first);
+    BOOST_CHECK_EQUAL(Symbols::name(first), "interned");
+}
@@ -0,0 +1,66 @@
+#include <boost/test/unit_test.hpp>
+#include <memory>
+#include <string>
+
+#include "small_vector.hpp"
+
+BOOST_AUTO_TEST_SUITE(small_vector_tests)
+
+using Strings = SmallVector<std::string, 2>;
+
+BOOST_AUTO_TEST_CASE(grows_past_inline_capacity_test) {
+    Strings strings{};
+    strings.push_back("a");
+    strings.emplace_back("b");
+    BOOST_CHECK(strings.is_inline());
+
+    strings.push_back("c");
+    BOOST_CHECK(not strings.is_inline());
+    BOOST_CHECK_EQUAL(strings.size(), 3);
+    BOOST_CHECK_EQUAL(strings[0] + strings[1] + strings[2], "abc");
+}
+
+BOOST_AUTO_TEST_CASE(push_back_of_own_element_while_growing_test) {
+    Strings strings{"first element, long enough to live on the heap", "second"};
+    strings.push_back(strings[0]);
+    BOOST_CHECK_EQUAL(strings.back(), strings.front());
+}
+
+BOOST_AUTO_TEST_CASE(move_inline_and_heap_test) {
+    Strings inline_strings{"x"};
+    Strings moved_inline{std::move(inline_strings)};
+    BOOST_CHECK(moved_inline == Strings{"x"});
+    BOOST_CHECK(inline_strings.empty());
+
+    Strings heap_strings{"x", "y", "z"};
+    const std::string* heap_data{heap_strings.data()};
+    Strings moved_heap{};
+    moved_heap = std::move(heap_strings);
+    BOOST_CHECK(moved_heap.data() == heap_data);
+    BOOST_CHECK(heap_strings.empty() and heap_strings.is_inline());
+}
+
+BOOST_AUTO_TEST_CASE(clear_keeps_capacity_test) {
+    SmallVector<std::shared_ptr<int>, 1> pointers{std::make_shared<int>(1), std::make_shared<int>(2)};
+    std::weak_ptr<int> first{pointers[0]};
+    std::size_t capacity{pointers.capacity()};
+
+    pointers.clear();
+    BOOST_CHECK(first.expired());
+    BOOST_CHECK_EQUAL(pointers.capacity(), capacity);
+    pointers.push_back(std::make_shared<int>(3));
+    BOOST_CHECK_EQUAL(*pointers[0], 3);
+}
+
+BOOST_AUTO_TEST_CASE(copy_test) {
+    Strings original{"a", "b", "c"};
+    Strings copy{original};
+    copy[0] = "changed";
+    BOOST_CHECK_EQUAL(original[0], "a");
+
+    Strings assigned{"q"};
+    assigned = original;
+    BOOST_CHECK(assigned == original);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
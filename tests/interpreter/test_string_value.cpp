@@ -0,0 +1,63 @@
+#include <boost/test/unit_test.hpp>
+
+#include "string_value.hpp"
+
+BOOST_AUTO_TEST_SUITE(string_value_tests)
+
+const std::string long_text(StringValue::INLINE_CAPACITY, 'a');
+
+BOOST_AUTO_TEST_CASE(append_in_place_keeps_older_values_test) {
+    StringValue base{long_text};
+    StringValue first{base + StringValue{"cd"}};
+    StringValue second{first + StringValue{"ef"}};
+
+    BOOST_CHECK_EQUAL(base.view(), long_text);
+    BOOST_CHECK_EQUAL(first.view(), long_text + "cd");
+    BOOST_CHECK_EQUAL(second.view(), long_text + "cdef");
+    // second was appended into the buffer shared with first
+    BOOST_CHECK(first.view().data() == second.view().data());
+
+    // first is no longer the whole buffer - appending to it must not overwrite second
+    StringValue branch{first + StringValue{"XY"}};
+    BOOST_CHECK_EQUAL(branch.view(), long_text + "cdXY");
+    BOOST_CHECK_EQUAL(second.view(), long_text + "cdef");
+    BOOST_CHECK(branch.view().data() != second.view().data());
+}
+
+BOOST_AUTO_TEST_CASE(short_strings_are_inline_test) {
+    StringValue short_text{"abc"};
+    StringValue copy{short_text};
+    BOOST_CHECK(short_text.is_inline());
+    BOOST_CHECK(copy.view().data() != short_text.view().data());
+    BOOST_CHECK(StringValue{long_text}.is_inline());
+
+    StringValue grown{StringValue{long_text} + StringValue{"b"}};
+    BOOST_CHECK(not grown.is_inline());
+    StringValue shared{grown};
+    BOOST_CHECK(shared.view().data() == grown.view().data());
+
+    StringValue moved{std::move(grown)};
+    BOOST_CHECK_EQUAL(moved.view(), long_text + "b");
+    shared = short_text;
+    BOOST_CHECK_EQUAL(shared.view(), "abc");
+}
+
+BOOST_AUTO_TEST_CASE(self_concatenation_test) {
+    StringValue text{"abc"};
+    for (int i = 0; i < 5; ++i) text = text + text;
+    BOOST_CHECK_EQUAL(text.size(), 3 * 32);
+    BOOST_CHECK_EQUAL(text.view().substr(text.size() - 6), "abcabc");
+}
+
+BOOST_AUTO_TEST_CASE(empty_and_comparison_test) {
+    StringValue empty{};
+    BOOST_CHECK(empty.empty());
+    BOOST_CHECK_EQUAL((empty + StringValue{"x"}).view(), "x");
+    BOOST_CHECK_EQUAL((StringValue{"x"} + empty).view(), "x");
+    BOOST_CHECK(StringValue{"abc"} == StringValue{std::string{"abc"}});
+    BOOST_CHECK(StringValue{"abc"} < StringValue{"abd"});
+    BOOST_CHECK(StringValue{"ab"} + StringValue{"c"} == StringValue{"abc"});
+    BOOST_CHECK(StringValue{long_text + "x"} == StringValue{long_text} + StringValue{"x"});
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,6 +1,7 @@
 #include <boost/test/data/monomorphic.hpp>
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/unit_test.hpp>
+#include <limits>
 #include <tuple>
 
 #include "type_handler.hpp"
@@ -98,7 +99,7 @@ BOOST_DATA_TEST_CASE(args_match_params_test, bdata::make(args_match_params_cases
 
 BOOST_AUTO_TEST_CASE(mut_var_match_type_test) {
     // mutable variable visible through holder
-    auto var_hold = VariableHolder{std::make_shared<Variable>(VariableType{TypeHandler::deduce_type(9), true}, 9)};
+    auto var_hold = VariableHolder{make_rc<Variable>(VariableType{TypeHandler::deduce_type(9), true}, 9)};
 
     // should be good for mutable param type
     BOOST_CHECK(TypeHandler::arg_matches_param(var_hold, VariableType{Type{TypeKind::INT}, true}));
@@ -109,7 +110,7 @@ BOOST_AUTO_TEST_CASE(mut_var_match_type_test) {
 BOOST_AUTO_TEST_CASE(var_match_type_test) {
     // immutable variable visible through holder
     auto var_hold =
-        VariableHolder{std::make_shared<Variable>(VariableType{TypeHandler::deduce_type("Hello"), false}, "Hello")};
+        VariableHolder{make_rc<Variable>(VariableType{TypeHandler::deduce_type("Hello"), false}, "Hello")};
 
     // should be good for immutable param type
     BOOST_CHECK(TypeHandler::arg_matches_param(var_hold, VariableType{Type{TypeKind::STRING}, false}));
@@ -120,32 +121,32 @@ BOOST_AUTO_TEST_CASE(var_match_type_test) {
 BOOST_AUTO_TEST_CASE(value_type_is_for_value) {
     value v_int = 123;
     opt_vhold_or_val val1 = v_int;
-    BOOST_CHECK(TypeHandler::value_type_is<int>(val1));
+    BOOST_CHECK(TypeHandler::value_type_is<int_value>(val1));
     BOOST_CHECK(!TypeHandler::value_type_is<double>(val1));
-    BOOST_CHECK_EQUAL(TypeHandler::get_value_as<int>(val1), 123);
+    BOOST_CHECK_EQUAL(TypeHandler::get_value_as<int_value>(val1), 123);
 
     value v_str = std::string("abc");
     opt_vhold_or_val val2 = v_str;
-    BOOST_CHECK(TypeHandler::value_type_is<std::string>(val2));
-    BOOST_CHECK(!TypeHandler::value_type_is<int>(val2));
-    BOOST_CHECK_EQUAL(TypeHandler::get_value_as<std::string>(val2), "abc");
+    BOOST_CHECK(TypeHandler::value_type_is<StringValue>(val2));
+    BOOST_CHECK(!TypeHandler::value_type_is<int_value>(val2));
+    BOOST_CHECK_EQUAL(TypeHandler::get_value_as<StringValue>(val2), "abc");
 }
 
 BOOST_AUTO_TEST_CASE(value_type_is_for_variableholder) {
-    auto var = std::make_shared<Variable>(VariableType{Type{TypeKind::FLOAT}}, 3.14);
+    auto var = make_rc<Variable>(VariableType{Type{TypeKind::FLOAT}}, 3.14);
     VariableHolder vh{var};
     opt_vhold_or_val val3 = vh;
     BOOST_CHECK(TypeHandler::value_type_is<double>(val3));
-    BOOST_CHECK(!TypeHandler::value_type_is<int>(val3));
+    BOOST_CHECK(!TypeHandler::value_type_is<int_value>(val3));
     BOOST_CHECK_CLOSE(TypeHandler::get_value_as<double>(val3), 3.14, 1e-9);
 }
 
 BOOST_AUTO_TEST_CASE(value_type_is_for_empty) {
     opt_vhold_or_val val4 = std::nullopt;
-    BOOST_CHECK(!TypeHandler::value_type_is<int>(val4));
+    BOOST_CHECK(!TypeHandler::value_type_is<int_value>(val4));
     BOOST_CHECK(!TypeHandler::value_type_is<bool>(val4));
     BOOST_CHECK(!TypeHandler::value_type_is<double>(val4));
-    BOOST_CHECK(!TypeHandler::value_type_is<std::string>(val4));
+    BOOST_CHECK(!TypeHandler::value_type_is<StringValue>(val4));
 }
 
 std::vector<std::tuple<std::optional<Type>, VariableType, bool>> ret_type_matches_param_type_cases{
@@ -169,6 +170,8 @@ BOOST_DATA_TEST_CASE(ret_type_matches_param_type_test, bdata::make(ret_type_matc
 std::vector<std::tuple<value, std::optional<value>>> as_int_cases{
     {value{42}, value{42}},
     {value{3.0}, value{3}},
+    {value{-9223372036854775808.0}, value{std::numeric_limits<int_value>::min()}},
+    {value{9223372036854775808.0}, std::nullopt},
     {value{true}, value{1}},
     {value{false}, value{0}},
     {value{std::string("123")}, value{123}},
@@ -17,10 +17,10 @@ BOOST_AUTO_TEST_CASE(constructor_test) {
     Token plus{lexer.get_next_token()};
     Token eof{lexer.get_next_token()};
     BOOST_CHECK(plus.get_type() == TokenType::T_PLUS);
-    BOOST_CHECK_EQUAL(plus.get_position(), Position());
+    BOOST_CHECK_EQUAL(plus.get_offset(), 0);
 
     BOOST_CHECK(eof.get_type() == TokenType::T_EOF);
-    BOOST_CHECK_EQUAL(eof.get_position(), Position(1, 2));
+    BOOST_CHECK_EQUAL(eof.get_offset(), 1);
 }
 
 BOOST_AUTO_TEST_CASE(bool_test) {
@@ -34,14 +34,14 @@ BOOST_AUTO_TEST_CASE(bool_test) {
 
     BOOST_CHECK(t_true.get_type() == TokenType::T_LITERAL_BOOL);
     BOOST_CHECK_EQUAL(t_true.get_value_as<bool>(), true);
-    BOOST_CHECK_EQUAL(t_true.get_position(), Position());
+    BOOST_CHECK_EQUAL(t_true.get_offset(), 0);
 
     BOOST_CHECK(t_false.get_type() == TokenType::T_LITERAL_BOOL);
     BOOST_CHECK_EQUAL(t_false.get_value_as<bool>(), false);
-    BOOST_CHECK_EQUAL(t_false.get_position(), Position(1, 6));
+    BOOST_CHECK_EQUAL(t_false.get_offset(), 5);
 
     BOOST_CHECK(eof.get_type() == TokenType::T_EOF);
-    BOOST_CHECK_EQUAL(eof.get_position(), Position(1, 11));
+    BOOST_CHECK_EQUAL(eof.get_offset(), 10);
 }
 
 std::vector<std::tuple<std::string, TokenType>> simple_test_cases{
@@ -104,7 +104,7 @@ BOOST_DATA_TEST_CASE(simple_tests, bdata::make(simple_test_cases), input, type)
     Token eof{lexer.get_next_token()};
 
     BOOST_CHECK_EQUAL(tk.get_type(), type);
-    BOOST_CHECK_EQUAL(tk.get_position(), Position{});
+    BOOST_CHECK_EQUAL(tk.get_offset(), 0);
     BOOST_CHECK(eof.get_type() == TokenType::T_EOF);
 }
 
@@ -124,14 +124,43 @@ BOOST_DATA_TEST_CASE(string_values_test, bdata::make(string_test_cases), input,
 
     BOOST_CHECK_EQUAL(str.get_type(), TokenType::T_LITERAL_STRING);
     BOOST_CHECK_EQUAL(str.get_value_as<std::string>(), expected_value);
-    BOOST_CHECK_EQUAL(str.get_position(), Position{});
+    BOOST_CHECK_EQUAL(str.get_offset(), 0);
 }
 
-std::vector<std::tuple<std::string, int>> int_test_cases{
+BOOST_AUTO_TEST_CASE(string_values_reference_source_test) {
+    std::unique_ptr<std::istream> source =
+        std::make_unique<std::stringstream>("name \"plain\" \"esc\\taped\" # comment\r\n");
+    auto handler = std::make_unique<SourceHandler>(std::move(source));
+    Lexer lexer{std::move(handler)};
+    sp_source_buffer buffer{lexer.get_source()};
+    auto points_into_text = [&buffer](std::string_view value) {
+        const char* begin = buffer->text.data();
+        return value.data() >= begin and value.data() + value.size() <= begin + buffer->text.size();
+    };
+
+    Token identifier{lexer.get_next_token()};
+    Token plain{lexer.get_next_token()};
+    Token escaped{lexer.get_next_token()};
+    Token comment{lexer.get_next_token()};
+
+    BOOST_CHECK_EQUAL(identifier.get_value_as<std::string_view>(), "name");
+    BOOST_CHECK(points_into_text(identifier.get_value_as<std::string_view>()));
+    BOOST_CHECK_EQUAL(plain.get_value_as<std::string_view>(), "plain");
+    BOOST_CHECK(points_into_text(plain.get_value_as<std::string_view>()));
+    BOOST_CHECK_EQUAL(escaped.get_value_as<std::string_view>(), "esc\taped");
+    BOOST_CHECK(not points_into_text(escaped.get_value_as<std::string_view>()));
+    BOOST_CHECK_EQUAL(buffer->decoded_literals.size(), 1);
+    BOOST_CHECK_EQUAL(comment.get_value_as<std::string_view>(), " comment");
+    BOOST_CHECK_EQUAL(lexer.get_next_token().get_type(), TokenType::T_EOF);
+}
+
+std::vector<std::tuple<std::string, int_value>> int_test_cases{
     {"0", 0},
     {"123", 123},
     {"456789", 456789},
     {"2147483647", 2147483647},
+    {"2147483648", 2147483648},
+    {"9223372036854775807", 9223372036854775807},
 };
 
 BOOST_DATA_TEST_CASE(int_tests, bdata::make(int_test_cases), input, expected_value) {
@@ -142,7 +171,7 @@ BOOST_DATA_TEST_CASE(int_tests, bdata::make(int_test_cases), input, expected_val
     Token tk = lexer.get_next_token();
 
     BOOST_CHECK_EQUAL(tk.get_type(), TokenType::T_LITERAL_INT);
-    BOOST_CHECK_EQUAL(tk.get_value_as<int>(), expected_value);
+    BOOST_CHECK_EQUAL(tk.get_value_as<int_value>(), expected_value);
 
     Token eof = lexer.get_next_token();
     BOOST_CHECK_EQUAL(eof.get_type(), TokenType::T_EOF);
@@ -189,77 +218,79 @@ print("For " + n as string + " sequence number is " + nth_fibonacci(n) as string
     std::unique_ptr<std::istream> source = std::make_unique<std::stringstream>(mock_file);
     auto handler = std::make_unique<SourceHandler>(std::move(source));
     Lexer lexer{std::move(handler)};
+    LineIndex lines{mock_file};
+    auto at = [&lines](int line, int column) { return lines.offset_of(Position(line, column)); };
     std::vector<Token> expected_tokens = {
-        Token{TokenType::T_DEF, Position(2, 1)},
-        Token{TokenType::T_IDENTIFIER, Position(2, 5), "nth_fibonacci"},
-        Token{TokenType::T_L_PAREN, Position(2, 18)},
-        Token{TokenType::T_IDENTIFIER, Position(2, 19), "n"},
-        Token{TokenType::T_COLON, Position(2, 20)},
-        Token{TokenType::T_INT, Position(2, 22)},
-        Token{TokenType::T_R_PAREN, Position(2, 25)},
-        Token{TokenType::T_ARROW, Position(2, 27)},
-        Token{TokenType::T_INT, Position(2, 30)},
-        Token{TokenType::T_L_BRACE, Position(2, 34)},
-        Token{TokenType::T_COMMENT, Position(2, 36), "some comment here"},
-        Token{TokenType::T_IF, Position(3, 5)},
-        Token{TokenType::T_L_PAREN, Position(3, 8)},
-        Token{TokenType::T_IDENTIFIER, Position(3, 9), "n"},
-        Token{TokenType::T_LESS_EQUAL, Position(3, 11)},
-        Token{TokenType::T_LITERAL_INT, Position(3, 14), 1},
-        Token{TokenType::T_R_PAREN, Position(3, 15)},
-        Token{TokenType::T_L_BRACE, Position(3, 17)},
-        Token{TokenType::T_RETURN, Position(4, 9)},
-        Token{TokenType::T_IDENTIFIER, Position(4, 16), "n"},
-        Token{TokenType::T_SEMICOLON, Position(4, 17)},
-        Token{TokenType::T_R_BRACE, Position(5, 5)},
-        Token{TokenType::T_RETURN, Position(7, 5)},
-        Token{TokenType::T_IDENTIFIER, Position(7, 12), "nth_fibonacci"},
-        Token{TokenType::T_L_PAREN, Position(7, 25)},
-        Token{TokenType::T_IDENTIFIER, Position(7, 26), "n"},
-        Token{TokenType::T_MINUS, Position(7, 28)},
-        Token{TokenType::T_LITERAL_INT, Position(7, 30), 1},
-        Token{TokenType::T_R_PAREN, Position(7, 31)},
-        Token{TokenType::T_PLUS, Position(7, 33)},
-        Token{TokenType::T_IDENTIFIER, Position(7, 35), "nth_fibonacci"},
-        Token{TokenType::T_L_PAREN, Position(7, 48)},
-        Token{TokenType::T_IDENTIFIER, Position(7, 49), "n"},
-        Token{TokenType::T_MINUS, Position(7, 51)},
-        Token{TokenType::T_LITERAL_INT, Position(7, 53), 2},
-        Token{TokenType::T_R_PAREN, Position(7, 54)},
-        Token{TokenType::T_SEMICOLON, Position(7, 55)},
-        Token{TokenType::T_R_BRACE, Position(8, 1)},
-        Token{TokenType::T_LET, Position(10, 1)},
-        Token{TokenType::T_IDENTIFIER, Position(10, 5), "n"},
-        Token{TokenType::T_COLON, Position(10, 6)},
-        Token{TokenType::T_INT, Position(10, 8)},
-        Token{TokenType::T_ASSIGN, Position(10, 12)},
-        Token{TokenType::T_LITERAL_INT, Position(10, 14), 5},
-        Token{TokenType::T_SEMICOLON, Position(10, 15)},
-        Token{TokenType::T_IDENTIFIER, Position(12, 1), "print"},
-        Token{TokenType::T_L_PAREN, Position(12, 6)},
-        Token{TokenType::T_LITERAL_STRING, Position(12, 7), "For "},
-        Token{TokenType::T_PLUS, Position(12, 14)},
-        Token{TokenType::T_IDENTIFIER, Position(12, 16), "n"},
-        Token{TokenType::T_AS, Position(12, 18)},
-        Token{TokenType::T_STRING, Position(12, 21)},
-        Token{TokenType::T_PLUS, Position(12, 28)},
-        Token{TokenType::T_LITERAL_STRING, Position(12, 30), " sequence number is "},
-        Token{TokenType::T_PLUS, Position(12, 53)},
-        Token{TokenType::T_IDENTIFIER, Position(12, 55), "nth_fibonacci"},
-        Token{TokenType::T_L_PAREN, Position(12, 68)},
-        Token{TokenType::T_IDENTIFIER, Position(12, 69), "n"},
-        Token{TokenType::T_R_PAREN, Position(12, 70)},
-        Token{TokenType::T_AS, Position(12, 72)},
-        Token{TokenType::T_STRING, Position(12, 75)},
-        Token{TokenType::T_R_PAREN, Position(12, 81)},
-        Token{TokenType::T_SEMICOLON, Position(12, 82)},
-        Token{TokenType::T_EOF, Position(13, 1)},
+        Token{TokenType::T_DEF, at(2, 1)},
+        Token{TokenType::T_IDENTIFIER, at(2, 5), "nth_fibonacci"},
+        Token{TokenType::T_L_PAREN, at(2, 18)},
+        Token{TokenType::T_IDENTIFIER, at(2, 19), "n"},
+        Token{TokenType::T_COLON, at(2, 20)},
+        Token{TokenType::T_INT, at(2, 22)},
+        Token{TokenType::T_R_PAREN, at(2, 25)},
+        Token{TokenType::T_ARROW, at(2, 27)},
+        Token{TokenType::T_INT, at(2, 30)},
+        Token{TokenType::T_L_BRACE, at(2, 34)},
+        Token{TokenType::T_COMMENT, at(2, 36), "some comment here"},
+        Token{TokenType::T_IF, at(3, 5)},
+        Token{TokenType::T_L_PAREN, at(3, 8)},
+        Token{TokenType::T_IDENTIFIER, at(3, 9), "n"},
+        Token{TokenType::T_LESS_EQUAL, at(3, 11)},
+        Token{TokenType::T_LITERAL_INT, at(3, 14), 1},
+        Token{TokenType::T_R_PAREN, at(3, 15)},
+        Token{TokenType::T_L_BRACE, at(3, 17)},
+        Token{TokenType::T_RETURN, at(4, 9)},
+        Token{TokenType::T_IDENTIFIER, at(4, 16), "n"},
+        Token{TokenType::T_SEMICOLON, at(4, 17)},
+        Token{TokenType::T_R_BRACE, at(5, 5)},
+        Token{TokenType::T_RETURN, at(7, 5)},
+        Token{TokenType::T_IDENTIFIER, at(7, 12), "nth_fibonacci"},
+        Token{TokenType::T_L_PAREN, at(7, 25)},
+        Token{TokenType::T_IDENTIFIER, at(7, 26), "n"},
+        Token{TokenType::T_MINUS, at(7, 28)},
+        Token{TokenType::T_LITERAL_INT, at(7, 30), 1},
+        Token{TokenType::T_R_PAREN, at(7, 31)},
+        Token{TokenType::T_PLUS, at(7, 33)},
+        Token{TokenType::T_IDENTIFIER, at(7, 35), "nth_fibonacci"},
+        Token{TokenType::T_L_PAREN, at(7, 48)},
+        Token{TokenType::T_IDENTIFIER, at(7, 49), "n"},
+        Token{TokenType::T_MINUS, at(7, 51)},
+        Token{TokenType::T_LITERAL_INT, at(7, 53), 2},
+        Token{TokenType::T_R_PAREN, at(7, 54)},
+        Token{TokenType::T_SEMICOLON, at(7, 55)},
+        Token{TokenType::T_R_BRACE, at(8, 1)},
+        Token{TokenType::T_LET, at(10, 1)},
+        Token{TokenType::T_IDENTIFIER, at(10, 5), "n"},
+        Token{TokenType::T_COLON, at(10, 6)},
+        Token{TokenType::T_INT, at(10, 8)},
+        Token{TokenType::T_ASSIGN, at(10, 12)},
+        Token{TokenType::T_LITERAL_INT, at(10, 14), 5},
+        Token{TokenType::T_SEMICOLON, at(10, 15)},
+        Token{TokenType::T_IDENTIFIER, at(12, 1), "print"},
+        Token{TokenType::T_L_PAREN, at(12, 6)},
+        Token{TokenType::T_LITERAL_STRING, at(12, 7), "For "},
+        Token{TokenType::T_PLUS, at(12, 14)},
+        Token{TokenType::T_IDENTIFIER, at(12, 16), "n"},
+        Token{TokenType::T_AS, at(12, 18)},
+        Token{TokenType::T_STRING, at(12, 21)},
+        Token{TokenType::T_PLUS, at(12, 28)},
+        Token{TokenType::T_LITERAL_STRING, at(12, 30), " sequence number is "},
+        Token{TokenType::T_PLUS, at(12, 53)},
+        Token{TokenType::T_IDENTIFIER, at(12, 55), "nth_fibonacci"},
+        Token{TokenType::T_L_PAREN, at(12, 68)},
+        Token{TokenType::T_IDENTIFIER, at(12, 69), "n"},
+        Token{TokenType::T_R_PAREN, at(12, 70)},
+        Token{TokenType::T_AS, at(12, 72)},
+        Token{TokenType::T_STRING, at(12, 75)},
+        Token{TokenType::T_R_PAREN, at(12, 81)},
+        Token{TokenType::T_SEMICOLON, at(12, 82)},
+        Token{TokenType::T_EOF, at(13, 1)},
     };
 
     for (const auto& expected_token : expected_tokens) {
         Token actual_token = lexer.get_next_token();
         BOOST_CHECK_EQUAL(actual_token.get_type(), expected_token.get_type());
-        BOOST_CHECK_EQUAL(actual_token.get_position(), expected_token.get_position());
+        BOOST_CHECK_EQUAL(actual_token.get_offset(), expected_token.get_offset());
 
         // sample code doesnt have any bool or float
         switch (actual_token.get_type()) {
@@ -269,7 +300,7 @@ print("For " + n as string + " sequence number is " + nth_fibonacci(n) as string
                 BOOST_CHECK_EQUAL(actual_token.get_value_as<std::string>(), expected_token.get_value_as<std::string>());
                 break;
             case TokenType::T_LITERAL_INT:
-                BOOST_CHECK_EQUAL(actual_token.get_value_as<int>(), expected_token.get_value_as<int>());
+                BOOST_CHECK_EQUAL(actual_token.get_value_as<int_value>(), expected_token.get_value_as<int_value>());
             default:
                 break;
         }
@@ -292,7 +323,7 @@ BOOST_AUTO_TEST_CASE(newline_interrupted_string_test) {
 }
 
 BOOST_AUTO_TEST_CASE(to_large_int_test) {
-    std::unique_ptr<std::istream> source = std::make_unique<std::stringstream>("1234567890123");
+    std::unique_ptr<std::istream> source = std::make_unique<std::stringstream>("9223372036854775808");
     auto handler = std::make_unique<SourceHandler>(std::move(source));
     Lexer lexer{std::move(handler)};
 
@@ -10,158 +10,155 @@
 namespace bdata = boost::unit_test::data;
 using namespace tkm;
 
-std::vector<std::tuple<TokenType, Position>> non_value_tokens_test_cases{
-    {TokenType::T_AND, Position{1, 1}},          {TokenType::T_INT, Position{2, 3}},
-    {TokenType::T_FLOAT, Position{4, 5}},        {TokenType::T_BOOL, Position{6, 7}},
-    {TokenType::T_STRING, Position{8, 9}},       {TokenType::T_FUNCTION, Position{10, 11}},
-    {TokenType::T_NONE, Position{12, 13}},       {TokenType::T_PLUS, Position{14, 15}},
-    {TokenType::T_MINUS, Position{16, 17}},      {TokenType::T_MULTIPLY, Position{18, 19}},
-    {TokenType::T_DIVIDE, Position{20, 21}},     {TokenType::T_ASSIGN, Position{22, 23}},
-    {TokenType::T_EQUAL, Position{24, 25}},      {TokenType::T_NOT_EQUAL, Position{26, 27}},
-    {TokenType::T_LESS_EQUAL, Position{28, 29}}, {TokenType::T_GREATER_EQUAL, Position{30, 31}},
-    {TokenType::T_LESS, Position{32, 33}},       {TokenType::T_GREATER, Position{34, 35}},
-    {TokenType::T_BIND_FRONT, Position{36, 37}}, {TokenType::T_FUNC_COMPOSITION, Position{38, 39}},
+std::vector<std::tuple<TokenType, source_offset>> non_value_tokens_test_cases{
+    {TokenType::T_AND, 101},         {TokenType::T_INT, 203},
+    {TokenType::T_FLOAT, 405},       {TokenType::T_BOOL, 607},
+    {TokenType::T_STRING, 809},      {TokenType::T_FUNCTION, 1011},
+    {TokenType::T_NONE, 1213},       {TokenType::T_PLUS, 1415},
+    {TokenType::T_MINUS, 1617},      {TokenType::T_MULTIPLY, 1819},
+    {TokenType::T_DIVIDE, 2021},     {TokenType::T_ASSIGN, 2223},
+    {TokenType::T_EQUAL, 2425},      {TokenType::T_NOT_EQUAL, 2627},
+    {TokenType::T_LESS_EQUAL, 2829}, {TokenType::T_GREATER_EQUAL, 3031},
+    {TokenType::T_LESS, 3233},       {TokenType::T_GREATER, 3435},
+    {TokenType::T_BIND_FRONT, 3637}, {TokenType::T_FUNC_COMPOSITION, 3839},
 };
 
-BOOST_DATA_TEST_CASE(non_value_token_constrctor_test, bdata::make(non_value_tokens_test_cases), type, position) {
-    Token token{type, position};
+BOOST_DATA_TEST_CASE(non_value_token_constrctor_test, bdata::make(non_value_tokens_test_cases), type, offset) {
+    Token token{type, offset};
 
     BOOST_CHECK_EQUAL(token.get_type(), type);
-    BOOST_CHECK_EQUAL(token.get_position(), position);
-    BOOST_CHECK_THROW(token.get_value_as<int>(), InvalidGetTokenValueError);
+    BOOST_CHECK_EQUAL(token.get_offset(), offset);
+    BOOST_CHECK_THROW(token.get_value_as<int_value>(), InvalidGetTokenValueError);
     BOOST_CHECK_THROW(token.get_value_as<double>(), InvalidGetTokenValueError);
     BOOST_CHECK_THROW(token.get_value_as<std::string>(), InvalidGetTokenValueError);
     BOOST_CHECK_THROW(token.get_value_as<bool>(), InvalidGetTokenValueError);
 }
 
-std::vector<std::tuple<TokenType, Position, int>> int_tokens_test_cases{
-    {TokenType::T_LITERAL_INT, Position{1, 2}, 42},      {TokenType::T_LITERAL_INT, Position{3, 4}, 17},
-    {TokenType::T_LITERAL_INT, Position{5, 6}, 256},     {TokenType::T_LITERAL_INT, Position{7, 8}, 1024},
-    {TokenType::T_LITERAL_INT, Position{9, 10}, 73},     {TokenType::T_LITERAL_INT, Position{11, 12}, 999},
-    {TokenType::T_LITERAL_INT, Position{13, 14}, 12345}, {TokenType::T_LITERAL_INT, Position{15, 16}, 54321},
-    {TokenType::T_LITERAL_INT, Position{17, 18}, 0},     {TokenType::T_LITERAL_INT, Position{19, 20}, 987},
+std::vector<std::tuple<TokenType, source_offset, int_value>> int_tokens_test_cases{
+    {TokenType::T_LITERAL_INT, 102, 42},     {TokenType::T_LITERAL_INT, 304, 17},
+    {TokenType::T_LITERAL_INT, 506, 256},    {TokenType::T_LITERAL_INT, 708, 1024},
+    {TokenType::T_LITERAL_INT, 910, 73},     {TokenType::T_LITERAL_INT, 1112, 999},
+    {TokenType::T_LITERAL_INT, 1314, 12345}, {TokenType::T_LITERAL_INT, 1516, 54321},
+    {TokenType::T_LITERAL_INT, 1718, 0},     {TokenType::T_LITERAL_INT, 1920, 987},
 };
 
-BOOST_DATA_TEST_CASE(int_token_test, bdata::make(int_tokens_test_cases), type, position, value) {
-    Token token{type, position, value};
+BOOST_DATA_TEST_CASE(int_token_test, bdata::make(int_tokens_test_cases), type, offset, value) {
+    Token token{type, offset, value};
 
     BOOST_CHECK_EQUAL(token.get_type(), type);
-    BOOST_CHECK_EQUAL(token.get_position(), position);
-    BOOST_CHECK_EQUAL(token.get_value_as<int>(), value);
+    BOOST_CHECK_EQUAL(token.get_offset(), offset);
+    BOOST_CHECK_EQUAL(token.get_value_as<int_value>(), value);
     BOOST_CHECK_THROW(token.get_value_as<double>(), InvalidGetTokenValueError);
     BOOST_CHECK_THROW(token.get_value_as<std::string>(), InvalidGetTokenValueError);
     BOOST_CHECK_THROW(token.get_value_as<bool>(), InvalidGetTokenValueError);
 }
 
-std::vector<std::tuple<TokenType, Position, double>> float_tokens_test_cases{
-    {TokenType::T_LITERAL_FLOAT, Position{1, 2}, 3.14159},  {TokenType::T_LITERAL_FLOAT, Position{3, 4}, 2.71828},
-    {TokenType::T_LITERAL_FLOAT, Position{5, 6}, 0.0},      {TokenType::T_LITERAL_FLOAT, Position{7, 8}, 1.61803},
-    {TokenType::T_LITERAL_FLOAT, Position{9, 10}, 23.456},  {TokenType::T_LITERAL_FLOAT, Position{11, 12}, 9876.54321},
-    {TokenType::T_LITERAL_FLOAT, Position{13, 14}, 0.0001}, {TokenType::T_LITERAL_FLOAT, Position{15, 16}, 42.42},
-    {TokenType::T_LITERAL_FLOAT, Position{17, 18}, 999.99}, {TokenType::T_LITERAL_FLOAT, Position{19, 20}, 12345.6789},
+std::vector<std::tuple<TokenType, source_offset, double>> float_tokens_test_cases{
+    {TokenType::T_LITERAL_FLOAT, 102, 3.14159}, {TokenType::T_LITERAL_FLOAT, 304, 2.71828},
+    {TokenType::T_LITERAL_FLOAT, 506, 0.0},     {TokenType::T_LITERAL_FLOAT, 708, 1.61803},
+    {TokenType::T_LITERAL_FLOAT, 910, 23.456},  {TokenType::T_LITERAL_FLOAT, 1112, 9876.54321},
+    {TokenType::T_LITERAL_FLOAT, 1314, 0.0001}, {TokenType::T_LITERAL_FLOAT, 1516, 42.42},
+    {TokenType::T_LITERAL_FLOAT, 1718, 999.99}, {TokenType::T_LITERAL_FLOAT, 1920, 12345.6789},
 };
 
-BOOST_DATA_TEST_CASE(float_token_test, bdata::make(float_tokens_test_cases), type, position, value) {
-    Token token{type, position, value};
+BOOST_DATA_TEST_CASE(float_token_test, bdata::make(float_tokens_test_cases), type, offset, value) {
+    Token token{type, offset, value};
 
     BOOST_CHECK_EQUAL(token.get_type(), type);
-    BOOST_CHECK_EQUAL(token.get_position(), position);
+    BOOST_CHECK_EQUAL(token.get_offset(), offset);
     BOOST_CHECK_CLOSE(token.get_value_as<double>(), value, 0.001);
-    BOOST_CHECK_THROW(token.get_value_as<int>(), InvalidGetTokenValueError);
+    BOOST_CHECK_THROW(token.get_value_as<int_value>(), InvalidGetTokenValueError);
     BOOST_CHECK_THROW(token.get_value_as<std::string>(), InvalidGetTokenValueError);
     BOOST_CHECK_THROW(token.get_value_as<bool>(), InvalidGetTokenValueError);
 }
 
-std::vector<std::tuple<TokenType, Position, std::string>> string_value_tokens_test_cases{
-    {TokenType::T_LITERAL_STRING, Position{1, 2}, "Hello, World!"},
-    {TokenType::T_LITERAL_STRING, Position{3, 4}, "^dhfjdffkjaabbd dfndsab sf"},
-    {TokenType::T_LITERAL_STRING, Position{5, 6}, ""},
-    {TokenType::T_LITERAL_STRING, Position{7, 8}, "Another example"},
-    {TokenType::T_LITERAL_STRING, Position{9, 10}, "1234567890"},
-    {TokenType::T_LITERAL_STRING, Position{11, 12}, "!@#$%^&*()"},
-    {TokenType::T_LITERAL_STRING, Position{13, 14}, "Multiline\nString"},
-    {TokenType::T_LITERAL_STRING, Position{15, 16}, "whites\t\n\r"},
-    {TokenType::T_LITERAL_STRING, Position{17, 18}, "Foo Foo Foo"},
-    {TokenType::T_LITERAL_STRING, Position{19, 20}, "fjdhsjghafjlkld''??"},
-    {TokenType::T_IDENTIFIER, Position{1, 2}, "identifier1"},
-    {TokenType::T_IDENTIFIER, Position{3, 4}, "_private_ident"},
-    {TokenType::T_IDENTIFIER, Position{5, 6}, "camelCase"},
-    {TokenType::T_IDENTIFIER, Position{7, 8}, "PascalCase"},
-    {TokenType::T_IDENTIFIER, Position{9, 10}, "CONSTANT"},
-    {TokenType::T_IDENTIFIER, Position{11, 12}, "x"},
-    {TokenType::T_IDENTIFIER, Position{13, 14}, "is_correct"},
-    {TokenType::T_IDENTIFIER, Position{15, 16}, "___"},
-    {TokenType::T_IDENTIFIER, Position{17, 18}, "fjdkfjd"},
-    {TokenType::T_IDENTIFIER, Position{19, 20}, "other123"},
-    {TokenType::T_COMMENT, Position{1, 2}, "some commentd"},
-    {TokenType::T_COMMENT, Position{3, 4}, "her eandofjdjrjhd"},
-    {TokenType::T_COMMENT, Position{5, 6}, "some comment here !@#%$(#*&#$%)"},
-    {TokenType::T_COMMENT, Position{7, 8}, "{}:FKDLFDHJHDJS:SDFHSJ"},
-    {TokenType::T_COMMENT, Position{9, 10}, "another comment"},
-    {TokenType::T_COMMENT, Position{11, 12}, "TODO: finish lexer"},
-    {TokenType::T_COMMENT, Position{13, 14}, "TOO: add exception handling mechanism"},
-    {TokenType::T_COMMENT, Position{15, 16}, "fdhfjdhjfhdjfhj"},
+std::vector<std::tuple<TokenType, source_offset, std::string>> string_value_tokens_test_cases{
+    {TokenType::T_LITERAL_STRING, 102, "Hello, World!"},
+    {TokenType::T_LITERAL_STRING, 304, "^dhfjdffkjaabbd dfndsab sf"},
+    {TokenType::T_LITERAL_STRING, 506, ""},
+    {TokenType::T_LITERAL_STRING, 708, "Another example"},
+    {TokenType::T_LITERAL_STRING, 910, "1234567890"},
+    {TokenType::T_LITERAL_STRING, 1112, "!@#$%^&*()"},
+    {TokenType::T_LITERAL_STRING, 1314, "Multiline\nString"},
+    {TokenType::T_LITERAL_STRING, 1516, "whites\t\n\r"},
+    {TokenType::T_LITERAL_STRING, 1718, "Foo Foo Foo"},
+    {TokenType::T_LITERAL_STRING, 1920, "fjdhsjghafjlkld''??"},
+    {TokenType::T_IDENTIFIER, 102, "identifier1"},
+    {TokenType::T_IDENTIFIER, 304, "_private_ident"},
+    {TokenType::T_IDENTIFIER, 506, "camelCase"},
+    {TokenType::T_IDENTIFIER, 708, "PascalCase"},
+    {TokenType::T_IDENTIFIER, 910, "CONSTANT"},
+    {TokenType::T_IDENTIFIER, 1112, "x"},
+    {TokenType::T_IDENTIFIER, 1314, "is_correct"},
+    {TokenType::T_IDENTIFIER, 1516, "___"},
+    {TokenType::T_IDENTIFIER, 1718, "fjdkfjd"},
+    {TokenType::T_IDENTIFIER, 1920, "other123"},
+    {TokenType::T_COMMENT, 102, "some commentd"},
+    {TokenType::T_COMMENT, 304, "her eandofjdjrjhd"},
+    {TokenType::T_COMMENT, 506, "some comment here !@#%$(#*&#$%)"},
+    {TokenType::T_COMMENT, 708, "{}:FKDLFDHJHDJS:SDFHSJ"},
+    {TokenType::T_COMMENT, 910, "another comment"},
+    {TokenType::T_COMMENT, 1112, "TODO: finish lexer"},
+    {TokenType::T_COMMENT, 1314, "TOO: add exception handling mechanism"},
+    {TokenType::T_COMMENT, 1516, "fdhfjdhjfhdjfhj"},
 };
 
-BOOST_DATA_TEST_CASE(string_value_token_test, bdata::make(string_value_tokens_test_cases), type, position, value) {
-    Token token{type, position, value};
+BOOST_DATA_TEST_CASE(string_value_token_test, bdata::make(string_value_tokens_test_cases), type, offset, value) {
+    Token token{type, offset, value};
 
     BOOST_CHECK_EQUAL(token.get_type(), type);
-    BOOST_CHECK_EQUAL(token.get_position(), position);
+    BOOST_CHECK_EQUAL(token.get_offset(), offset);
     BOOST_CHECK_EQUAL(token.get_value_as<std::string>(), value);
-    BOOST_CHECK_THROW(token.get_value_as<int>(), InvalidGetTokenValueError);
+    BOOST_CHECK_THROW(token.get_value_as<int_value>(), InvalidGetTokenValueError);
     BOOST_CHECK_THROW(token.get_value_as<double>(), InvalidGetTokenValueError);
     BOOST_CHECK_THROW(token.get_value_as<bool>(), InvalidGetTokenValueError);
 }
 
-std::vector<std::tuple<Position, bool>> bool_values_test_cases{
-    {Position{4, 34}, true},
-    {Position{78, 123}, false},
+std::vector<std::tuple<source_offset, bool>> bool_values_test_cases{
+    {434, true},
+    {7923, false},
 };
-BOOST_DATA_TEST_CASE(bool_values_test, bdata::make(bool_values_test_cases), position, value) {
-    Token token{TokenType::T_LITERAL_BOOL, position, value};
+BOOST_DATA_TEST_CASE(bool_values_test, bdata::make(bool_values_test_cases), offset, value) {
+    Token token{TokenType::T_LITERAL_BOOL, offset, value};
 
     BOOST_CHECK_EQUAL(token.get_type(), TokenType::T_LITERAL_BOOL);
-    BOOST_CHECK_EQUAL(token.get_position(), position);
+    BOOST_CHECK_EQUAL(token.get_offset(), offset);
     BOOST_CHECK_EQUAL(token.get_value_as<bool>(), value);
-    BOOST_CHECK_THROW(token.get_value_as<int>(), InvalidGetTokenValueError);
+    BOOST_CHECK_THROW(token.get_value_as<int_value>(), InvalidGetTokenValueError);
     BOOST_CHECK_THROW(token.get_value_as<double>(), InvalidGetTokenValueError);
     BOOST_CHECK_THROW(token.get_value_as<std::string>(), InvalidGetTokenValueError);
 }
 
-std::vector<std::tuple<TokenType, Position>> value_tokens_without_values_test_cases{
-    {TokenType::T_LITERAL_INT, Position{1, 1}},      {TokenType::T_LITERAL_INT, Position{2, 3}},
-    {TokenType::T_LITERAL_INT, Position{4, 5}},      {TokenType::T_LITERAL_FLOAT, Position{6, 7}},
-    {TokenType::T_LITERAL_FLOAT, Position{8, 9}},    {TokenType::T_LITERAL_FLOAT, Position{10, 11}},
-    {TokenType::T_LITERAL_STRING, Position{12, 13}}, {TokenType::T_LITERAL_STRING, Position{14, 15}},
-    {TokenType::T_LITERAL_STRING, Position{16, 17}}, {TokenType::T_IDENTIFIER, Position{18, 19}},
-    {TokenType::T_IDENTIFIER, Position{20, 21}},     {TokenType::T_IDENTIFIER, Position{22, 23}},
+std::vector<std::tuple<TokenType, source_offset>> value_tokens_without_values_test_cases{
+    {TokenType::T_LITERAL_INT, 101},     {TokenType::T_LITERAL_INT, 203},
+    {TokenType::T_LITERAL_INT, 405},     {TokenType::T_LITERAL_FLOAT, 607},
+    {TokenType::T_LITERAL_FLOAT, 809},   {TokenType::T_LITERAL_FLOAT, 1011},
+    {TokenType::T_LITERAL_STRING, 1213}, {TokenType::T_LITERAL_STRING, 1415},
+    {TokenType::T_LITERAL_STRING, 1617}, {TokenType::T_IDENTIFIER, 1819},
+    {TokenType::T_IDENTIFIER, 2021},     {TokenType::T_IDENTIFIER, 2223},
 };
 
 BOOST_DATA_TEST_CASE(value_tokens_without_value_constructor_test, bdata::make(value_tokens_without_values_test_cases),
-                     type, position) {
-    BOOST_CHECK_THROW(Token token(type, position), InvalidTokenValueError);
+                     type, offset) {
+    BOOST_CHECK_THROW(Token token(type, offset), InvalidTokenValueError);
 };
 
 std::vector<std::tuple<Token, std::string>> token_print_test_case{
-    {Token{TokenType::T_AND, Position{4, 4}}, "Token(TokenType::T_AND,Position(4,4))"},
-    {Token{TokenType::T_INT, Position{9, 41}}, "Token(TokenType::T_INT,Position(9,41))"},
-    {Token{TokenType::T_FLOAT, Position{34, 3}}, "Token(TokenType::T_FLOAT,Position(34,3))"},
-    {Token{TokenType::T_FUNCTION, Position{90, 65}}, "Token(TokenType::T_FUNCTION,Position(90,65))"},
-    {Token{TokenType::T_NONE, Position{77, 7}}, "Token(TokenType::T_NONE,Position(77,7))"},
-    {Token{TokenType::T_FUNC_COMPOSITION, Position{84, 1}}, "Token(TokenType::T_FUNC_COMPOSITION,Position(84,1))"},
-    {Token{TokenType::T_ASSIGN, Position{92, 11}}, "Token(TokenType::T_ASSIGN,Position(92,11))"},
-    {Token{TokenType::T_L_BRACE, Position{7, 14}}, "Token(TokenType::T_L_BRACE,Position(7,14))"},
-    {Token{TokenType::T_EOF, Position{1004, 1}}, "Token(TokenType::T_EOF,Position(1004,1))"},
-    {Token{TokenType::T_COMMA, Position{62, 8}}, "Token(TokenType::T_COMMA,Position(62,8))"},
-    {Token{TokenType::T_LITERAL_INT, Position{34, 3}, 123456789},
-     "Token(TokenType::T_LITERAL_INT,Position(34,3),123456789)"},
-    {Token{TokenType::T_LITERAL_FLOAT, Position{90, 65}, 3.1422222},
-     "Token(TokenType::T_LITERAL_FLOAT,Position(90,65),3.142222)"},
-    {Token{TokenType::T_LITERAL_STRING, Position{77, 7}, "Hello world!"},
-     "Token(TokenType::T_LITERAL_STRING,Position(77,7),\"Hello world!\")"},
-    {Token{TokenType::T_IDENTIFIER, Position{84, 1}, "_variable1"},
-     "Token(TokenType::T_IDENTIFIER,Position(84,1),\"_variable1\")"},
+    {Token{TokenType::T_AND, 404}, "Token(TokenType::T_AND,Offset(404))"},
+    {Token{TokenType::T_INT, 941}, "Token(TokenType::T_INT,Offset(941))"},
+    {Token{TokenType::T_FLOAT, 3403}, "Token(TokenType::T_FLOAT,Offset(3403))"},
+    {Token{TokenType::T_FUNCTION, 9065}, "Token(TokenType::T_FUNCTION,Offset(9065))"},
+    {Token{TokenType::T_NONE, 7707}, "Token(TokenType::T_NONE,Offset(7707))"},
+    {Token{TokenType::T_FUNC_COMPOSITION, 8401}, "Token(TokenType::T_FUNC_COMPOSITION,Offset(8401))"},
+    {Token{TokenType::T_ASSIGN, 9211}, "Token(TokenType::T_ASSIGN,Offset(9211))"},
+    {Token{TokenType::T_L_BRACE, 714}, "Token(TokenType::T_L_BRACE,Offset(714))"},
+    {Token{TokenType::T_EOF, 100401}, "Token(TokenType::T_EOF,Offset(100401))"},
+    {Token{TokenType::T_COMMA, 6208}, "Token(TokenType::T_COMMA,Offset(6208))"},
+    {Token{TokenType::T_LITERAL_INT, 3403, 123456789}, "Token(TokenType::T_LITERAL_INT,Offset(3403),123456789)"},
+    {Token{TokenType::T_LITERAL_FLOAT, 9065, 3.1422222}, "Token(TokenType::T_LITERAL_FLOAT,Offset(9065),3.142222)"},
+    {Token{TokenType::T_LITERAL_STRING, 7707, "Hello world!"},
+     "Token(TokenType::T_LITERAL_STRING,Offset(7707),\"Hello world!\")"},
+    {Token{TokenType::T_IDENTIFIER, 8401, "_variable1"}, "Token(TokenType::T_IDENTIFIER,Offset(8401),\"_variable1\")"},
 };
 
 BOOST_DATA_TEST_CASE(token_repr_test, bdata::make(token_print_test_case), token, expected_output) {
@@ -3,10 +3,12 @@
 #include <algorithm>
 
 #include "program.hpp"
+#include "source_handler.hpp"
 #include "statement.hpp"
 #include "typed_identifier.hpp"
 
 void ParserTestVisitor::visit(const Program& program) {
+    _source = program.source.get();
     elements.emplace_back(_get_name_position_str(program, "Program"), _nest_level);
     _NestGuard guard{_nest_level};
     std::for_each(program.function_definitions.begin(), program.function_definitions.end(),
@@ -167,5 +169,5 @@ void ParserTestVisitor::visit(const TypedIdentifier& typed_ident) {
 }
 
 std::string ParserTestVisitor::_get_name_position_str(const Node& node, std::string element_name) const {
-    return std::format("{};{}", element_name, node.position.get_position_str());
+    return std::format("{};{}", element_name, resolve_position(_source, node.offset).get_position_str());
 }
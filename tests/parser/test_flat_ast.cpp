@@ -0,0 +1,98 @@
+#include <boost/test/unit_test.hpp>
+#include <sstream>
+
+#include "flat_ast.hpp"
+#include "lexer.hpp"
+#include "parser.hpp"
+#include "parser_test_visitor.hpp"
+
+/* -----------------------------------------------------------------------------*
+ *                                   FLAT AST                                   *
+ *------------------------------------------------------------------------------*/
+
+BOOST_AUTO_TEST_SUITE(flat_ast_tests)
+
+std::unique_ptr<Program> parse(std::string source_code) {
+    std::unique_ptr<std::istream> source = std::make_unique<std::stringstream>(source_code);
+    auto handler = std::make_unique<SourceHandler>(std::move(source));
+    Parser parser{std::make_unique<Lexer>(std::move(handler))};
+    return parser.parse_program();
+}
+
+const std::string flat_ast_source{R"(
+def apply(f: function<int:int>, mut x: int) -> none {
+    x = f(x);
+}
+
+def main() -> int {
+    let inc: function<int:int> = (1) >> add & double;
+    for (i: int = 0; i < 10 and not false; i = i + 1) {
+        if (i == 3) {
+            continue;
+        } else if (i > 8) {
+            break;
+        } else {
+            print("i: " + i as string + "\tok");
+        }
+    }
+    let mut y: float = -2.5 * 4.0;
+    return 0;
+}
+)"};
+
+BOOST_AUTO_TEST_CASE(round_trip_test) {
+    std::unique_ptr<Program> program{parse(flat_ast_source)};
+    FlatAst flat_ast{FlatAst::from_program(*program)};
+    std::unique_ptr<Program> rebuilt{flat_ast.to_program()};
+
+    ParserTestVisitor original_visit{};
+    program->accept(original_visit);
+    ParserTestVisitor rebuilt_visit{};
+    rebuilt->accept(rebuilt_visit);
+
+    BOOST_CHECK(original_visit.elements == rebuilt_visit.elements);
+    BOOST_CHECK_EQUAL(flat_ast.function_definitions.count, 2);
+    BOOST_CHECK(rebuilt->source == program->source);
+}
+
+BOOST_AUTO_TEST_CASE(code_block_declaration_count_test) {
+    std::unique_ptr<Program> program{parse(flat_ast_source)};
+    std::unique_ptr<Program> rebuilt{FlatAst::from_program(*program).to_program()};
+
+    for (const auto& checked : {program.get(), rebuilt.get()}) {
+        auto apply_body{dynamic_cast<const CodeBlock*>(checked->function_definitions[0]->body.get())};
+        auto main_body{dynamic_cast<const CodeBlock*>(checked->function_definitions[1]->body.get())};
+        BOOST_REQUIRE(apply_body and main_body);
+        BOOST_CHECK_EQUAL(apply_body->declaration_count, 0);
+        BOOST_CHECK_EQUAL(main_body->declaration_count, 2);
+
+        auto loop{dynamic_cast<const ForLoop*>(main_body->statements[1].get())};
+        BOOST_REQUIRE(loop);
+        BOOST_CHECK_EQUAL(dynamic_cast<const CodeBlock&>(*loop->body).declaration_count, 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(dispatch_test) {
+    std::unique_ptr<Program> program{parse(flat_ast_source)};
+    FlatAst flat_ast{FlatAst::from_program(*program)};
+
+    int loops{0};
+    int literals{0};
+    for (node_index index = 0; index < flat_ast.nodes.size(); ++index) {
+        flat_ast.dispatch(index, [&]<typename T>(const FlatNode&, const T&) {
+            if constexpr (std::same_as<T, FlatForLoop>) {
+                ++loops;
+            } else if constexpr (std::same_as<T, int_value> or std::same_as<T, double> or std::same_as<T, bool> or
+                                 std::same_as<T, std::string_view>) {
+                ++literals;
+            }
+        });
+    }
+
+    BOOST_CHECK_EQUAL(loops, 1);
+    BOOST_CHECK_EQUAL(literals, 12);
+    BOOST_CHECK_EQUAL(flat_ast.strings.size(), 2);
+    BOOST_CHECK(sizeof(FlatNode) <= 12);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,95 @@
+#include <boost/test/unit_test.hpp>
+#include <sstream>
+
+#include "incremental_parser.hpp"
+#include "lexer.hpp"
+#include "parser.hpp"
+#include "parser_test_visitor.hpp"
+
+/* -----------------------------------------------------------------------------*
+ *                              INCREMENTAL PARSER                              *
+ *------------------------------------------------------------------------------*/
+
+BOOST_AUTO_TEST_SUITE(incremental_parser_tests)
+
+ParserTestVisitor visit_full_parse(std::string source_code) {
+    std::unique_ptr<std::istream> source = std::make_unique<std::stringstream>(source_code);
+    auto handler = std::make_unique<SourceHandler>(std::move(source));
+    Parser parser{std::make_unique<Lexer>(std::move(handler))};
+    ParserTestVisitor visitor{};
+    parser.parse_program()->accept(visitor);
+    return visitor;
+}
+
+ParserTestVisitor visit_incremental(const IncrementalParser& parser) {
+    ParserTestVisitor visitor{};
+    parser.get_program().accept(visitor);
+    return visitor;
+}
+
+const std::string incremental_source{R"(# three functions
+def first(x: int) -> int {
+    return x + 1;
+}
+
+def second() -> none {
+    print("second");
+}
+
+def main() -> int {
+    return first(2);
+}
+)"};
+
+void check_edit(const std::string& old_text, const std::string& new_text, std::size_t expected_reparsed) {
+    IncrementalParser parser{old_text};
+    parser.apply_edit(TextEdit::diff(old_text, new_text));
+
+    BOOST_CHECK_EQUAL(parser.get_text(), new_text);
+    BOOST_CHECK(visit_incremental(parser).elements == visit_full_parse(new_text).elements);
+    BOOST_CHECK_EQUAL(parser.get_reparsed_count(), expected_reparsed);
+}
+
+BOOST_AUTO_TEST_CASE(edit_inside_function_test) {
+    std::string edited{incremental_source};
+    edited.replace(edited.find("\"second\""), 8, "\"changed\" + \"text\"");
+    check_edit(incremental_source, edited, 1);
+}
+
+BOOST_AUTO_TEST_CASE(line_insertion_shifts_later_functions_test) {
+    std::string edited{incremental_source};
+    edited.insert(edited.find("    return x + 1;"), "    let y: int = x;\n    let z: int = y;\n");
+    check_edit(incremental_source, edited, 1);
+    check_edit(incremental_source, "\n\n" + incremental_source, 1);
+
+    IncrementalParser parser{incremental_source};
+    parser.apply_edit(TextEdit::diff(incremental_source, edited));
+    const Program& program{parser.get_program()};
+    BOOST_CHECK_EQUAL(program.source->lines.position_of(program.function_definitions[2]->offset).get_line(), 12);
+}
+
+BOOST_AUTO_TEST_CASE(added_and_removed_function_test) {
+    std::string added{incremental_source};
+    added.insert(added.find("def main"), "def third() -> none {}\n\n");
+    check_edit(incremental_source, added, 2);
+
+    std::string removed{incremental_source};
+    std::size_t second_begin{removed.find("def second")};
+    removed.erase(second_begin, removed.find("def main") - second_begin);
+    check_edit(incremental_source, removed, 1);
+}
+
+BOOST_AUTO_TEST_CASE(recovers_after_syntax_error_test) {
+    std::string broken{incremental_source};
+    broken.replace(broken.find("x + 1;"), 6, "x + ;");
+    IncrementalParser parser{incremental_source};
+    BOOST_CHECK_THROW(parser.apply_edit(TextEdit::diff(incremental_source, broken)), std::exception);
+
+    std::string fixed{incremental_source};
+    fixed.replace(fixed.find("x + 1;"), 6, "x + 2;");
+    parser.apply_edit(TextEdit::diff(parser.get_text(), fixed));
+    BOOST_CHECK(visit_incremental(parser).elements == visit_full_parse(fixed).elements);
+    BOOST_CHECK_EQUAL(parser.get_reparsed_count(), 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -11,6 +11,20 @@
 
 using namespace tkm;
 
+// mock tokens lie on a grid of blank lines of the same width - at(line, column) is the offset of that place
+constexpr int GRID_LINE_WIDTH{128};
+constexpr int GRID_LINES{64};
+
+const sp_source_buffer grid_source{std::make_shared<SourceBuffer>([] {
+    std::string text{};
+    for (int line = 0; line < GRID_LINES; ++line) text += std::string(GRID_LINE_WIDTH - 1, ' ') + '\n';
+    return text;
+}())};
+
+source_offset at(int line, int column) {
+    return static_cast<source_offset>((line - 1) * GRID_LINE_WIDTH + column - 1);
+}
+
 class MockLexer : public ILexer {
    private:
     std::deque<Token> _tokens;
@@ -20,12 +34,15 @@ class MockLexer : public ILexer {
     MockLexer(std::vector<Token> tokens) : _tokens{tokens.begin(), tokens.end()} {}
     Token get_next_token() override {
         if (_tokens.empty()) {
-            return Token{TokenType::T_EOF, Position{}};  // tokens have been tested -  position doesnt matter here
+            return Token{TokenType::T_EOF, 0};  // tokens have been tested -  position doesnt matter here
         }
         Token token{_tokens.front()};
         _tokens.pop_front();
         return token;
     }
+    sp_source_buffer get_source() const override {
+        return grid_source;
+    }
 };
 
 /* -----------------------------------------------------------------------------*
@@ -44,17 +61,17 @@ BOOST_AUTO_TEST_CASE(test_minimal_main) {
 // }
 BOOST_AUTO_TEST_CASE(test_main_simple_return) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_INT, Position(1, 15)},                // int
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_RETURN, Position(2, 5)},              // return
-        Token{TokenType::T_LITERAL_INT, Position(2, 12), 0},     // 0
-        Token{TokenType::T_SEMICOLON, Position(2, 13)},          // ;
-        Token{TokenType::T_R_BRACE, Position(3, 1)},             // }
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_INT, at(1, 15)},                // int
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_RETURN, at(2, 5)},              // return
+        Token{TokenType::T_LITERAL_INT, at(2, 12), 0},     // 0
+        Token{TokenType::T_SEMICOLON, at(2, 13)},          // ;
+        Token{TokenType::T_R_BRACE, at(3, 1)},             // }
     };
 
     std::vector<std::pair<std::string, int>> expected_elements = {
@@ -86,24 +103,24 @@ BOOST_AUTO_TEST_CASE(test_main_simple_return) {
 // }
 BOOST_AUTO_TEST_CASE(test_increment_function) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                      // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "increment"},  // increment
-        Token{TokenType::T_L_PAREN, Position(1, 14)},                 // (
-        Token{TokenType::T_MUT, Position(1, 15)},                     // mut
-        Token{TokenType::T_IDENTIFIER, Position(1, 19), "i"},         // i
-        Token{TokenType::T_COLON, Position(1, 20)},                   // :
-        Token{TokenType::T_INT, Position(1, 22)},                     // int
-        Token{TokenType::T_R_PAREN, Position(1, 25)},                 // )
-        Token{TokenType::T_ARROW, Position(1, 27)},                   // ->
-        Token{TokenType::T_NONE, Position(1, 30)},                    // none
-        Token{TokenType::T_L_BRACE, Position(1, 35)},                 // {
-        Token{TokenType::T_IDENTIFIER, Position(2, 5), "i"},          // i
-        Token{TokenType::T_ASSIGN, Position(2, 7)},                   // =
-        Token{TokenType::T_IDENTIFIER, Position(2, 9), "i"},          // i
-        Token{TokenType::T_PLUS, Position(2, 11)},                    // +
-        Token{TokenType::T_LITERAL_INT, Position(2, 13), 1},          // 1
-        Token{TokenType::T_SEMICOLON, Position(2, 14)},               // ;
-        Token{TokenType::T_R_BRACE, Position(3, 1)},                  // }
+        Token{TokenType::T_DEF, at(1, 1)},                      // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "increment"},  // increment
+        Token{TokenType::T_L_PAREN, at(1, 14)},                 // (
+        Token{TokenType::T_MUT, at(1, 15)},                     // mut
+        Token{TokenType::T_IDENTIFIER, at(1, 19), "i"},         // i
+        Token{TokenType::T_COLON, at(1, 20)},                   // :
+        Token{TokenType::T_INT, at(1, 22)},                     // int
+        Token{TokenType::T_R_PAREN, at(1, 25)},                 // )
+        Token{TokenType::T_ARROW, at(1, 27)},                   // ->
+        Token{TokenType::T_NONE, at(1, 30)},                    // none
+        Token{TokenType::T_L_BRACE, at(1, 35)},                 // {
+        Token{TokenType::T_IDENTIFIER, at(2, 5), "i"},          // i
+        Token{TokenType::T_ASSIGN, at(2, 7)},                   // =
+        Token{TokenType::T_IDENTIFIER, at(2, 9), "i"},          // i
+        Token{TokenType::T_PLUS, at(2, 11)},                    // +
+        Token{TokenType::T_LITERAL_INT, at(2, 13), 1},          // 1
+        Token{TokenType::T_SEMICOLON, at(2, 14)},               // ;
+        Token{TokenType::T_R_BRACE, at(3, 1)},                  // }
     };
 
     std::vector<std::pair<std::string, int>> expected_elements = {
@@ -140,29 +157,29 @@ BOOST_AUTO_TEST_CASE(test_increment_function) {
 // }
 BOOST_AUTO_TEST_CASE(test_main_simple_asgn_func_call) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                  // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},   // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},              // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},             // )
-        Token{TokenType::T_ARROW, Position(1, 12)},               // ->
-        Token{TokenType::T_INT, Position(1, 15)},                 // int
-        Token{TokenType::T_L_BRACE, Position(1, 19)},             // {
-        Token{TokenType::T_LET, Position(2, 5)},                  // let
-        Token{TokenType::T_IDENTIFIER, Position(2, 9), "x"},      // x
-        Token{TokenType::T_COLON, Position(2, 10)},               // :
-        Token{TokenType::T_INT, Position(2, 12)},                 // int
-        Token{TokenType::T_ASSIGN, Position(2, 16)},              // =
-        Token{TokenType::T_LITERAL_INT, Position(2, 18), 4},      // 4
-        Token{TokenType::T_SEMICOLON, Position(2, 19)},           // ;
-        Token{TokenType::T_IDENTIFIER, Position(3, 5), "print"},  // print
-        Token{TokenType::T_L_PAREN, Position(3, 10)},             // (
-        Token{TokenType::T_IDENTIFIER, Position(3, 11), "x"},     // x
-        Token{TokenType::T_R_PAREN, Position(3, 12)},             // )
-        Token{TokenType::T_SEMICOLON, Position(3, 13)},           // ;
-        Token{TokenType::T_RETURN, Position(4, 5)},               // return
-        Token{TokenType::T_LITERAL_INT, Position(4, 12), 0},      // 0
-        Token{TokenType::T_SEMICOLON, Position(4, 13)},           // ;
-        Token{TokenType::T_R_BRACE, Position(5, 1)},              // }
+        Token{TokenType::T_DEF, at(1, 1)},                  // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},   // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},              // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},             // )
+        Token{TokenType::T_ARROW, at(1, 12)},               // ->
+        Token{TokenType::T_INT, at(1, 15)},                 // int
+        Token{TokenType::T_L_BRACE, at(1, 19)},             // {
+        Token{TokenType::T_LET, at(2, 5)},                  // let
+        Token{TokenType::T_IDENTIFIER, at(2, 9), "x"},      // x
+        Token{TokenType::T_COLON, at(2, 10)},               // :
+        Token{TokenType::T_INT, at(2, 12)},                 // int
+        Token{TokenType::T_ASSIGN, at(2, 16)},              // =
+        Token{TokenType::T_LITERAL_INT, at(2, 18), 4},      // 4
+        Token{TokenType::T_SEMICOLON, at(2, 19)},           // ;
+        Token{TokenType::T_IDENTIFIER, at(3, 5), "print"},  // print
+        Token{TokenType::T_L_PAREN, at(3, 10)},             // (
+        Token{TokenType::T_IDENTIFIER, at(3, 11), "x"},     // x
+        Token{TokenType::T_R_PAREN, at(3, 12)},             // )
+        Token{TokenType::T_SEMICOLON, at(3, 13)},           // ;
+        Token{TokenType::T_RETURN, at(4, 5)},               // return
+        Token{TokenType::T_LITERAL_INT, at(4, 12), 0},      // 0
+        Token{TokenType::T_SEMICOLON, at(4, 13)},           // ;
+        Token{TokenType::T_R_BRACE, at(5, 1)},              // }
     };
 
     std::vector<std::pair<std::string, int>> expected_elements = {
@@ -201,18 +218,18 @@ BOOST_AUTO_TEST_CASE(test_main_simple_asgn_func_call) {
 // }
 BOOST_AUTO_TEST_CASE(test_function_composition) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                  // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},   // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},              // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},             // )
-        Token{TokenType::T_ARROW, Position(1, 12)},               // ->
-        Token{TokenType::T_NONE, Position(1, 15)},                // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},             // {
-        Token{TokenType::T_IDENTIFIER, Position(2, 5), "foo1"},   // foo1
-        Token{TokenType::T_FUNC_COMPOSITION, Position(2, 10)},    // &&
-        Token{TokenType::T_IDENTIFIER, Position(2, 13), "foo2"},  // foo2
-        Token{TokenType::T_SEMICOLON, Position(2, 17)},           // ;
-        Token{TokenType::T_R_BRACE, Position(3, 1)},              // }
+        Token{TokenType::T_DEF, at(1, 1)},                  // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},   // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},              // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},             // )
+        Token{TokenType::T_ARROW, at(1, 12)},               // ->
+        Token{TokenType::T_NONE, at(1, 15)},                // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},             // {
+        Token{TokenType::T_IDENTIFIER, at(2, 5), "foo1"},   // foo1
+        Token{TokenType::T_FUNC_COMPOSITION, at(2, 10)},    // &&
+        Token{TokenType::T_IDENTIFIER, at(2, 13), "foo2"},  // foo2
+        Token{TokenType::T_SEMICOLON, at(2, 17)},           // ;
+        Token{TokenType::T_R_BRACE, at(3, 1)},              // }
     };
 
     std::vector<std::pair<std::string, int>> expected_elements = {
@@ -238,45 +255,131 @@ BOOST_AUTO_TEST_CASE(test_function_composition) {
     BOOST_CHECK(expected_elements == t_visit.elements);
 }
 
+// def main() -> none {
+//     not a & b as bool == c < d * -e;
+// }
+BOOST_AUTO_TEST_CASE(test_operator_precedence) {
+    std::vector<Token> tokens = {
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_NONE, at(1, 15)},               // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_NOT, at(2, 5)},                 // not
+        Token{TokenType::T_IDENTIFIER, at(2, 9), "a"},     // a
+        Token{TokenType::T_FUNC_COMPOSITION, at(2, 11)},   // &
+        Token{TokenType::T_IDENTIFIER, at(2, 13), "b"},    // b
+        Token{TokenType::T_AS, at(2, 15)},                 // as
+        Token{TokenType::T_BOOL, at(2, 18)},               // bool
+        Token{TokenType::T_EQUAL, at(2, 23)},              // ==
+        Token{TokenType::T_IDENTIFIER, at(2, 26), "c"},    // c
+        Token{TokenType::T_LESS, at(2, 28)},               // <
+        Token{TokenType::T_IDENTIFIER, at(2, 30), "d"},    // d
+        Token{TokenType::T_MULTIPLY, at(2, 32)},           // *
+        Token{TokenType::T_MINUS, at(2, 34)},              // -
+        Token{TokenType::T_IDENTIFIER, at(2, 35), "e"},    // e
+        Token{TokenType::T_SEMICOLON, at(2, 36)},          // ;
+        Token{TokenType::T_R_BRACE, at(3, 1)},             // }
+    };
+
+    std::vector<std::pair<std::string, int>> expected_elements = {
+        {"Program;[1:1]", 0},
+        {"FunctionDefinition;[1:1]", 1},
+        {"FunctionSignature;[1:1];type=function<none:none>,identifier=main", 2},
+        {"CodeBlock;[1:19]", 2},
+        {"ExpressionStatement;[2:5]", 3},
+        {"Equal;[2:5]", 4},
+        {"TypeCast;[2:5];to_type=bool", 5},
+        {"LogicalNot;[2:5]", 6},
+        {"FunctionComposition;[2:9]", 7},
+        {"Identifier;[2:9];name=a", 8},
+        {"Identifier;[2:13];name=b", 8},
+        {"Less;[2:26]", 5},
+        {"Identifier;[2:26];name=c", 6},
+        {"Multiplication;[2:30]", 6},
+        {"Identifier;[2:30];name=d", 7},
+        {"UnaryMinus;[2:34]", 7},
+        {"Identifier;[2:35];name=e", 8},
+    };
+
+    auto lexer = std::make_unique<MockLexer>(tokens);
+    Parser parser{std::move(lexer)};
+    auto program = parser.parse_program();
+
+    ParserTestVisitor t_visit{};
+    program->accept(t_visit);
+
+    BOOST_CHECK(expected_elements == t_visit.elements);
+}
+
+// def main() -> none {
+//     a == b == c;
+// }
+BOOST_AUTO_TEST_CASE(test_equality_not_chainable) {
+    std::vector<Token> tokens = {
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_NONE, at(1, 15)},               // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_IDENTIFIER, at(2, 5), "a"},     // a
+        Token{TokenType::T_EQUAL, at(2, 7)},               // ==
+        Token{TokenType::T_IDENTIFIER, at(2, 10), "b"},    // b
+        Token{TokenType::T_EQUAL, at(2, 12)},              // ==
+        Token{TokenType::T_IDENTIFIER, at(2, 15), "c"},    // c
+        Token{TokenType::T_SEMICOLON, at(2, 16)},          // ;
+        Token{TokenType::T_R_BRACE, at(3, 1)},             // }
+    };
+
+    auto lexer = std::make_unique<MockLexer>(tokens);
+    Parser parser{std::move(lexer)};
+
+    BOOST_CHECK_THROW(parser.parse_program(), ExpectedSemicolException);
+}
+
 // def invoke(fun: function<int, int:int>, a: int, b: int) -> int {
 //     return fun(a, b);
 // }
 BOOST_AUTO_TEST_CASE(test_invoke_function) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                   // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "invoke"},  // invoke
-        Token{TokenType::T_L_PAREN, Position(1, 11)},              // (
-        Token{TokenType::T_IDENTIFIER, Position(1, 12), "fun"},    // fun
-        Token{TokenType::T_COLON, Position(1, 15)},                // :
-        Token{TokenType::T_FUNCTION, Position(1, 17)},             // function
-        Token{TokenType::T_LESS, Position(1, 25)},                 // <
-        Token{TokenType::T_INT, Position(1, 26)},                  // int
-        Token{TokenType::T_COMMA, Position(1, 29)},                // ,
-        Token{TokenType::T_INT, Position(1, 31)},                  // int
-        Token{TokenType::T_COLON, Position(1, 34)},                // :
-        Token{TokenType::T_INT, Position(1, 35)},                  // int
-        Token{TokenType::T_GREATER, Position(1, 38)},              // >
-        Token{TokenType::T_COMMA, Position(1, 39)},                // ,
-        Token{TokenType::T_IDENTIFIER, Position(1, 41), "a"},      // a
-        Token{TokenType::T_COLON, Position(1, 42)},                // :
-        Token{TokenType::T_INT, Position(1, 44)},                  // int
-        Token{TokenType::T_COMMA, Position(1, 47)},                // ,
-        Token{TokenType::T_IDENTIFIER, Position(1, 49), "b"},      // b
-        Token{TokenType::T_COLON, Position(1, 50)},                // :
-        Token{TokenType::T_INT, Position(1, 52)},                  // int
-        Token{TokenType::T_R_PAREN, Position(1, 55)},              // )
-        Token{TokenType::T_ARROW, Position(1, 57)},                // ->
-        Token{TokenType::T_INT, Position(1, 60)},                  // int
-        Token{TokenType::T_L_BRACE, Position(1, 64)},              // {
-        Token{TokenType::T_RETURN, Position(2, 5)},                // return
-        Token{TokenType::T_IDENTIFIER, Position(2, 12), "fun"},    // fun
-        Token{TokenType::T_L_PAREN, Position(2, 15)},              // (
-        Token{TokenType::T_IDENTIFIER, Position(2, 16), "a"},      // a
-        Token{TokenType::T_COMMA, Position(2, 17)},                // ,
-        Token{TokenType::T_IDENTIFIER, Position(2, 19), "b"},      // b
-        Token{TokenType::T_R_PAREN, Position(2, 20)},              // )
-        Token{TokenType::T_SEMICOLON, Position(2, 21)},            // ;
-        Token{TokenType::T_R_BRACE, Position(3, 1)},               // }
+        Token{TokenType::T_DEF, at(1, 1)},                   // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "invoke"},  // invoke
+        Token{TokenType::T_L_PAREN, at(1, 11)},              // (
+        Token{TokenType::T_IDENTIFIER, at(1, 12), "fun"},    // fun
+        Token{TokenType::T_COLON, at(1, 15)},                // :
+        Token{TokenType::T_FUNCTION, at(1, 17)},             // function
+        Token{TokenType::T_LESS, at(1, 25)},                 // <
+        Token{TokenType::T_INT, at(1, 26)},                  // int
+        Token{TokenType::T_COMMA, at(1, 29)},                // ,
+        Token{TokenType::T_INT, at(1, 31)},                  // int
+        Token{TokenType::T_COLON, at(1, 34)},                // :
+        Token{TokenType::T_INT, at(1, 35)},                  // int
+        Token{TokenType::T_GREATER, at(1, 38)},              // >
+        Token{TokenType::T_COMMA, at(1, 39)},                // ,
+        Token{TokenType::T_IDENTIFIER, at(1, 41), "a"},      // a
+        Token{TokenType::T_COLON, at(1, 42)},                // :
+        Token{TokenType::T_INT, at(1, 44)},                  // int
+        Token{TokenType::T_COMMA, at(1, 47)},                // ,
+        Token{TokenType::T_IDENTIFIER, at(1, 49), "b"},      // b
+        Token{TokenType::T_COLON, at(1, 50)},                // :
+        Token{TokenType::T_INT, at(1, 52)},                  // int
+        Token{TokenType::T_R_PAREN, at(1, 55)},              // )
+        Token{TokenType::T_ARROW, at(1, 57)},                // ->
+        Token{TokenType::T_INT, at(1, 60)},                  // int
+        Token{TokenType::T_L_BRACE, at(1, 64)},              // {
+        Token{TokenType::T_RETURN, at(2, 5)},                // return
+        Token{TokenType::T_IDENTIFIER, at(2, 12), "fun"},    // fun
+        Token{TokenType::T_L_PAREN, at(2, 15)},              // (
+        Token{TokenType::T_IDENTIFIER, at(2, 16), "a"},      // a
+        Token{TokenType::T_COMMA, at(2, 17)},                // ,
+        Token{TokenType::T_IDENTIFIER, at(2, 19), "b"},      // b
+        Token{TokenType::T_R_PAREN, at(2, 20)},              // )
+        Token{TokenType::T_SEMICOLON, at(2, 21)},            // ;
+        Token{TokenType::T_R_BRACE, at(3, 1)},               // }
     };
 
     std::vector<std::pair<std::string, int>> expected_elements = {
@@ -314,48 +417,48 @@ BOOST_AUTO_TEST_CASE(test_invoke_function) {
 // }
 BOOST_AUTO_TEST_CASE(test_bind_function) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                  // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "bind"},   // bind
-        Token{TokenType::T_L_PAREN, Position(1, 9)},              // (
-        Token{TokenType::T_IDENTIFIER, Position(1, 10), "fun"},   // fun
-        Token{TokenType::T_COLON, Position(1, 13)},               // :
-        Token{TokenType::T_FUNCTION, Position(1, 15)},            // function
-        Token{TokenType::T_LESS, Position(1, 23)},                // <
-        Token{TokenType::T_FLOAT, Position(1, 24)},               // float
-        Token{TokenType::T_COMMA, Position(1, 29)},               // ,
-        Token{TokenType::T_FLOAT, Position(1, 31)},               // float
-        Token{TokenType::T_COMMA, Position(1, 37)},               // ,
-        Token{TokenType::T_FLOAT, Position(1, 38)},               // float
-        Token{TokenType::T_COLON, Position(1, 43)},               // :
-        Token{TokenType::T_FLOAT, Position(1, 44)},               // float
-        Token{TokenType::T_GREATER, Position(1, 49)},             // >
-        Token{TokenType::T_COMMA, Position(1, 50)},               // ,
-        Token{TokenType::T_IDENTIFIER, Position(1, 52), "arg1"},  // arg1
-        Token{TokenType::T_COLON, Position(1, 53)},               // :
-        Token{TokenType::T_FLOAT, Position(1, 58)},               // float
-        Token{TokenType::T_COMMA, Position(1, 63)},               // ,
-        Token{TokenType::T_IDENTIFIER, Position(1, 65), "arg2"},  // arg2
-        Token{TokenType::T_COLON, Position(1, 69)},               // :
-        Token{TokenType::T_FLOAT, Position(1, 71)},               // float
-        Token{TokenType::T_R_PAREN, Position(1, 76)},             // )
-        Token{TokenType::T_ARROW, Position(1, 78)},               // ->
-        Token{TokenType::T_FUNCTION, Position(1, 81)},            // function
-        Token{TokenType::T_LESS, Position(1, 89)},                // <
-        Token{TokenType::T_FLOAT, Position(1, 90)},               // float
-        Token{TokenType::T_COLON, Position(1, 95)},               // :
-        Token{TokenType::T_FLOAT, Position(1, 96)},               // float
-        Token{TokenType::T_GREATER, Position(1, 101)},            // >
-        Token{TokenType::T_L_BRACE, Position(1, 103)},            // {
-        Token{TokenType::T_RETURN, Position(2, 5)},               // return
-        Token{TokenType::T_L_PAREN, Position(2, 12)},             // (
-        Token{TokenType::T_IDENTIFIER, Position(2, 13), "arg1"},  // arg1
-        Token{TokenType::T_COMMA, Position(2, 17)},               // ,
-        Token{TokenType::T_IDENTIFIER, Position(2, 19), "arg2"},  // arg2
-        Token{TokenType::T_R_PAREN, Position(2, 23)},             // )
-        Token{TokenType::T_BIND_FRONT, Position(2, 25)},          // >>
-        Token{TokenType::T_IDENTIFIER, Position(2, 28), "fun"},   // fun
-        Token{TokenType::T_SEMICOLON, Position(2, 31)},           // ;
-        Token{TokenType::T_R_BRACE, Position(3, 1)},              // }
+        Token{TokenType::T_DEF, at(1, 1)},                  // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "bind"},   // bind
+        Token{TokenType::T_L_PAREN, at(1, 9)},              // (
+        Token{TokenType::T_IDENTIFIER, at(1, 10), "fun"},   // fun
+        Token{TokenType::T_COLON, at(1, 13)},               // :
+        Token{TokenType::T_FUNCTION, at(1, 15)},            // function
+        Token{TokenType::T_LESS, at(1, 23)},                // <
+        Token{TokenType::T_FLOAT, at(1, 24)},               // float
+        Token{TokenType::T_COMMA, at(1, 29)},               // ,
+        Token{TokenType::T_FLOAT, at(1, 31)},               // float
+        Token{TokenType::T_COMMA, at(1, 37)},               // ,
+        Token{TokenType::T_FLOAT, at(1, 38)},               // float
+        Token{TokenType::T_COLON, at(1, 43)},               // :
+        Token{TokenType::T_FLOAT, at(1, 44)},               // float
+        Token{TokenType::T_GREATER, at(1, 49)},             // >
+        Token{TokenType::T_COMMA, at(1, 50)},               // ,
+        Token{TokenType::T_IDENTIFIER, at(1, 52), "arg1"},  // arg1
+        Token{TokenType::T_COLON, at(1, 53)},               // :
+        Token{TokenType::T_FLOAT, at(1, 58)},               // float
+        Token{TokenType::T_COMMA, at(1, 63)},               // ,
+        Token{TokenType::T_IDENTIFIER, at(1, 65), "arg2"},  // arg2
+        Token{TokenType::T_COLON, at(1, 69)},               // :
+        Token{TokenType::T_FLOAT, at(1, 71)},               // float
+        Token{TokenType::T_R_PAREN, at(1, 76)},             // )
+        Token{TokenType::T_ARROW, at(1, 78)},               // ->
+        Token{TokenType::T_FUNCTION, at(1, 81)},            // function
+        Token{TokenType::T_LESS, at(1, 89)},                // <
+        Token{TokenType::T_FLOAT, at(1, 90)},               // float
+        Token{TokenType::T_COLON, at(1, 95)},               // :
+        Token{TokenType::T_FLOAT, at(1, 96)},               // float
+        Token{TokenType::T_GREATER, at(1, 101)},            // >
+        Token{TokenType::T_L_BRACE, at(1, 103)},            // {
+        Token{TokenType::T_RETURN, at(2, 5)},               // return
+        Token{TokenType::T_L_PAREN, at(2, 12)},             // (
+        Token{TokenType::T_IDENTIFIER, at(2, 13), "arg1"},  // arg1
+        Token{TokenType::T_COMMA, at(2, 17)},               // ,
+        Token{TokenType::T_IDENTIFIER, at(2, 19), "arg2"},  // arg2
+        Token{TokenType::T_R_PAREN, at(2, 23)},             // )
+        Token{TokenType::T_BIND_FRONT, at(2, 25)},          // >>
+        Token{TokenType::T_IDENTIFIER, at(2, 28), "fun"},   // fun
+        Token{TokenType::T_SEMICOLON, at(2, 31)},           // ;
+        Token{TokenType::T_R_BRACE, at(3, 1)},              // }
     };
 
     std::vector<std::pair<std::string, int>> expected_elements = {
@@ -407,81 +510,81 @@ BOOST_AUTO_TEST_CASE(test_bind_function) {
 BOOST_AUTO_TEST_CASE(test_fibonacci) {
     std::vector<Token> tokens = {
         // nth_fibonacci function
-        Token{TokenType::T_DEF, Position(1, 1)},
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "nth_fibonacci"},
-        Token{TokenType::T_L_PAREN, Position(1, 18)},
-        Token{TokenType::T_IDENTIFIER, Position(1, 19), "n"},
-        Token{TokenType::T_COLON, Position(1, 20)},
-        Token{TokenType::T_INT, Position(1, 22)},
-        Token{TokenType::T_R_PAREN, Position(1, 25)},
-        Token{TokenType::T_ARROW, Position(1, 27)},
-        Token{TokenType::T_INT, Position(1, 30)},
-        Token{TokenType::T_L_BRACE, Position(1, 34)},
-        Token{TokenType::T_IF, Position(2, 5)},
-        Token{TokenType::T_L_PAREN, Position(2, 8)},
-        Token{TokenType::T_IDENTIFIER, Position(2, 9), "n"},
-        Token{TokenType::T_LESS_EQUAL, Position(2, 11)},
-        Token{TokenType::T_LITERAL_INT, Position(2, 14), 1},
-        Token{TokenType::T_R_PAREN, Position(2, 15)},
-        Token{TokenType::T_L_BRACE, Position(2, 17)},
-        Token{TokenType::T_RETURN, Position(3, 9)},
-        Token{TokenType::T_IDENTIFIER, Position(3, 16), "n"},
-        Token{TokenType::T_SEMICOLON, Position(3, 17)},
-        Token{TokenType::T_R_BRACE, Position(4, 5)},
-        Token{TokenType::T_RETURN, Position(6, 5)},
-        Token{TokenType::T_IDENTIFIER, Position(6, 12), "nth_fibonacci"},
-        Token{TokenType::T_L_PAREN, Position(6, 25)},
-        Token{TokenType::T_IDENTIFIER, Position(6, 26), "n"},
-        Token{TokenType::T_MINUS, Position(6, 28)},
-        Token{TokenType::T_LITERAL_INT, Position(6, 30), 1},
-        Token{TokenType::T_R_PAREN, Position(6, 31)},
-        Token{TokenType::T_PLUS, Position(6, 33)},
-        Token{TokenType::T_IDENTIFIER, Position(6, 35), "nth_fibonacci"},
-        Token{TokenType::T_L_PAREN, Position(6, 48)},
-        Token{TokenType::T_IDENTIFIER, Position(6, 49), "n"},
-        Token{TokenType::T_MINUS, Position(6, 51)},
-        Token{TokenType::T_LITERAL_INT, Position(6, 53), 2},
-        Token{TokenType::T_R_PAREN, Position(6, 54)},
-        Token{TokenType::T_SEMICOLON, Position(6, 55)},
-        Token{TokenType::T_R_BRACE, Position(7, 1)},
+        Token{TokenType::T_DEF, at(1, 1)},
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "nth_fibonacci"},
+        Token{TokenType::T_L_PAREN, at(1, 18)},
+        Token{TokenType::T_IDENTIFIER, at(1, 19), "n"},
+        Token{TokenType::T_COLON, at(1, 20)},
+        Token{TokenType::T_INT, at(1, 22)},
+        Token{TokenType::T_R_PAREN, at(1, 25)},
+        Token{TokenType::T_ARROW, at(1, 27)},
+        Token{TokenType::T_INT, at(1, 30)},
+        Token{TokenType::T_L_BRACE, at(1, 34)},
+        Token{TokenType::T_IF, at(2, 5)},
+        Token{TokenType::T_L_PAREN, at(2, 8)},
+        Token{TokenType::T_IDENTIFIER, at(2, 9), "n"},
+        Token{TokenType::T_LESS_EQUAL, at(2, 11)},
+        Token{TokenType::T_LITERAL_INT, at(2, 14), 1},
+        Token{TokenType::T_R_PAREN, at(2, 15)},
+        Token{TokenType::T_L_BRACE, at(2, 17)},
+        Token{TokenType::T_RETURN, at(3, 9)},
+        Token{TokenType::T_IDENTIFIER, at(3, 16), "n"},
+        Token{TokenType::T_SEMICOLON, at(3, 17)},
+        Token{TokenType::T_R_BRACE, at(4, 5)},
+        Token{TokenType::T_RETURN, at(6, 5)},
+        Token{TokenType::T_IDENTIFIER, at(6, 12), "nth_fibonacci"},
+        Token{TokenType::T_L_PAREN, at(6, 25)},
+        Token{TokenType::T_IDENTIFIER, at(6, 26), "n"},
+        Token{TokenType::T_MINUS, at(6, 28)},
+        Token{TokenType::T_LITERAL_INT, at(6, 30), 1},
+        Token{TokenType::T_R_PAREN, at(6, 31)},
+        Token{TokenType::T_PLUS, at(6, 33)},
+        Token{TokenType::T_IDENTIFIER, at(6, 35), "nth_fibonacci"},
+        Token{TokenType::T_L_PAREN, at(6, 48)},
+        Token{TokenType::T_IDENTIFIER, at(6, 49), "n"},
+        Token{TokenType::T_MINUS, at(6, 51)},
+        Token{TokenType::T_LITERAL_INT, at(6, 53), 2},
+        Token{TokenType::T_R_PAREN, at(6, 54)},
+        Token{TokenType::T_SEMICOLON, at(6, 55)},
+        Token{TokenType::T_R_BRACE, at(7, 1)},
 
         // main function
-        Token{TokenType::T_DEF, Position(9, 1)},
-        Token{TokenType::T_IDENTIFIER, Position(9, 5), "main"},
-        Token{TokenType::T_L_PAREN, Position(9, 9)},
-        Token{TokenType::T_R_PAREN, Position(9, 10)},
-        Token{TokenType::T_ARROW, Position(9, 12)},
-        Token{TokenType::T_INT, Position(9, 15)},
-        Token{TokenType::T_L_BRACE, Position(9, 19)},
-        Token{TokenType::T_LET, Position(10, 5)},
-        Token{TokenType::T_IDENTIFIER, Position(10, 9), "n"},
-        Token{TokenType::T_COLON, Position(10, 10)},
-        Token{TokenType::T_INT, Position(10, 12)},
-        Token{TokenType::T_ASSIGN, Position(10, 16)},
-        Token{TokenType::T_LITERAL_INT, Position(10, 18), 5},
-        Token{TokenType::T_SEMICOLON, Position(10, 19)},
-        Token{TokenType::T_IDENTIFIER, Position(12, 5), "print"},
-        Token{TokenType::T_L_PAREN, Position(12, 10)},
-        Token{TokenType::T_LITERAL_STRING, Position(12, 11), "For "},
-        Token{TokenType::T_PLUS, Position(12, 18)},
-        Token{TokenType::T_IDENTIFIER, Position(12, 20), "n"},
-        Token{TokenType::T_AS, Position(12, 22)},
-        Token{TokenType::T_STRING, Position(12, 25)},
-        Token{TokenType::T_PLUS, Position(12, 32)},
-        Token{TokenType::T_LITERAL_STRING, Position(12, 34), " sequence number is "},
-        Token{TokenType::T_PLUS, Position(12, 57)},
-        Token{TokenType::T_IDENTIFIER, Position(12, 59), "nth_fibonacci"},
-        Token{TokenType::T_L_PAREN, Position(12, 72)},
-        Token{TokenType::T_IDENTIFIER, Position(12, 73), "n"},
-        Token{TokenType::T_R_PAREN, Position(12, 74)},
-        Token{TokenType::T_AS, Position(12, 76)},
-        Token{TokenType::T_STRING, Position(12, 79)},
-        Token{TokenType::T_R_PAREN, Position(12, 85)},
-        Token{TokenType::T_SEMICOLON, Position(12, 86)},
-        Token{TokenType::T_RETURN, Position(13, 5)},
-        Token{TokenType::T_LITERAL_INT, Position(13, 12), 0},
-        Token{TokenType::T_SEMICOLON, Position(13, 13)},
-        Token{TokenType::T_R_BRACE, Position(14, 1)},
+        Token{TokenType::T_DEF, at(9, 1)},
+        Token{TokenType::T_IDENTIFIER, at(9, 5), "main"},
+        Token{TokenType::T_L_PAREN, at(9, 9)},
+        Token{TokenType::T_R_PAREN, at(9, 10)},
+        Token{TokenType::T_ARROW, at(9, 12)},
+        Token{TokenType::T_INT, at(9, 15)},
+        Token{TokenType::T_L_BRACE, at(9, 19)},
+        Token{TokenType::T_LET, at(10, 5)},
+        Token{TokenType::T_IDENTIFIER, at(10, 9), "n"},
+        Token{TokenType::T_COLON, at(10, 10)},
+        Token{TokenType::T_INT, at(10, 12)},
+        Token{TokenType::T_ASSIGN, at(10, 16)},
+        Token{TokenType::T_LITERAL_INT, at(10, 18), 5},
+        Token{TokenType::T_SEMICOLON, at(10, 19)},
+        Token{TokenType::T_IDENTIFIER, at(12, 5), "print"},
+        Token{TokenType::T_L_PAREN, at(12, 10)},
+        Token{TokenType::T_LITERAL_STRING, at(12, 11), "For "},
+        Token{TokenType::T_PLUS, at(12, 18)},
+        Token{TokenType::T_IDENTIFIER, at(12, 20), "n"},
+        Token{TokenType::T_AS, at(12, 22)},
+        Token{TokenType::T_STRING, at(12, 25)},
+        Token{TokenType::T_PLUS, at(12, 32)},
+        Token{TokenType::T_LITERAL_STRING, at(12, 34), " sequence number is "},
+        Token{TokenType::T_PLUS, at(12, 57)},
+        Token{TokenType::T_IDENTIFIER, at(12, 59), "nth_fibonacci"},
+        Token{TokenType::T_L_PAREN, at(12, 72)},
+        Token{TokenType::T_IDENTIFIER, at(12, 73), "n"},
+        Token{TokenType::T_R_PAREN, at(12, 74)},
+        Token{TokenType::T_AS, at(12, 76)},
+        Token{TokenType::T_STRING, at(12, 79)},
+        Token{TokenType::T_R_PAREN, at(12, 85)},
+        Token{TokenType::T_SEMICOLON, at(12, 86)},
+        Token{TokenType::T_RETURN, at(13, 5)},
+        Token{TokenType::T_LITERAL_INT, at(13, 12), 0},
+        Token{TokenType::T_SEMICOLON, at(13, 13)},
+        Token{TokenType::T_R_BRACE, at(14, 1)},
     };
 
     std::vector<std::pair<std::string, int>> expected_elements = {
@@ -555,39 +658,39 @@ BOOST_AUTO_TEST_CASE(test_fibonacci) {
 //  }
 BOOST_AUTO_TEST_CASE(test_for_loop_with_function_call) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                  // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},   // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},              // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},             // )
-        Token{TokenType::T_ARROW, Position(1, 12)},               // ->
-        Token{TokenType::T_INT, Position(1, 15)},                 // int
-        Token{TokenType::T_L_BRACE, Position(1, 19)},             // {
-        Token{TokenType::T_FOR, Position(2, 5)},                  // for
-        Token{TokenType::T_L_PAREN, Position(2, 9)},              // (
-        Token{TokenType::T_IDENTIFIER, Position(2, 10), "i"},     // i
-        Token{TokenType::T_COLON, Position(2, 11)},               // :
-        Token{TokenType::T_INT, Position(2, 13)},                 // int
-        Token{TokenType::T_ASSIGN, Position(2, 17)},              // =
-        Token{TokenType::T_LITERAL_INT, Position(2, 19), 0},      // 0
-        Token{TokenType::T_SEMICOLON, Position(2, 20)},           // ;
-        Token{TokenType::T_IDENTIFIER, Position(2, 22), "i"},     // i
-        Token{TokenType::T_LESS, Position(2, 24)},                // <
-        Token{TokenType::T_LITERAL_INT, Position(2, 26), 10},     // 10
-        Token{TokenType::T_SEMICOLON, Position(2, 28)},           // ;
-        Token{TokenType::T_IDENTIFIER, Position(2, 30), "i"},     // i
-        Token{TokenType::T_ASSIGN, Position(2, 32)},              // =
-        Token{TokenType::T_IDENTIFIER, Position(2, 34), "i"},     // i
-        Token{TokenType::T_PLUS, Position(2, 36)},                // +
-        Token{TokenType::T_LITERAL_INT, Position(2, 38), 1},      // 1
-        Token{TokenType::T_R_PAREN, Position(2, 39)},             // )
-        Token{TokenType::T_L_BRACE, Position(2, 41)},             // {
-        Token{TokenType::T_IDENTIFIER, Position(3, 9), "print"},  // print
-        Token{TokenType::T_L_PAREN, Position(3, 14)},             // (
-        Token{TokenType::T_IDENTIFIER, Position(3, 15), "i"},     // i
-        Token{TokenType::T_R_PAREN, Position(3, 16)},             // )
-        Token{TokenType::T_SEMICOLON, Position(3, 17)},           // ;
-        Token{TokenType::T_R_BRACE, Position(4, 5)},              // }
-        Token{TokenType::T_R_BRACE, Position(5, 1)},              // }
+        Token{TokenType::T_DEF, at(1, 1)},                  // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},   // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},              // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},             // )
+        Token{TokenType::T_ARROW, at(1, 12)},               // ->
+        Token{TokenType::T_INT, at(1, 15)},                 // int
+        Token{TokenType::T_L_BRACE, at(1, 19)},             // {
+        Token{TokenType::T_FOR, at(2, 5)},                  // for
+        Token{TokenType::T_L_PAREN, at(2, 9)},              // (
+        Token{TokenType::T_IDENTIFIER, at(2, 10), "i"},     // i
+        Token{TokenType::T_COLON, at(2, 11)},               // :
+        Token{TokenType::T_INT, at(2, 13)},                 // int
+        Token{TokenType::T_ASSIGN, at(2, 17)},              // =
+        Token{TokenType::T_LITERAL_INT, at(2, 19), 0},      // 0
+        Token{TokenType::T_SEMICOLON, at(2, 20)},           // ;
+        Token{TokenType::T_IDENTIFIER, at(2, 22), "i"},     // i
+        Token{TokenType::T_LESS, at(2, 24)},                // <
+        Token{TokenType::T_LITERAL_INT, at(2, 26), 10},     // 10
+        Token{TokenType::T_SEMICOLON, at(2, 28)},           // ;
+        Token{TokenType::T_IDENTIFIER, at(2, 30), "i"},     // i
+        Token{TokenType::T_ASSIGN, at(2, 32)},              // =
+        Token{TokenType::T_IDENTIFIER, at(2, 34), "i"},     // i
+        Token{TokenType::T_PLUS, at(2, 36)},                // +
+        Token{TokenType::T_LITERAL_INT, at(2, 38), 1},      // 1
+        Token{TokenType::T_R_PAREN, at(2, 39)},             // )
+        Token{TokenType::T_L_BRACE, at(2, 41)},             // {
+        Token{TokenType::T_IDENTIFIER, at(3, 9), "print"},  // print
+        Token{TokenType::T_L_PAREN, at(3, 14)},             // (
+        Token{TokenType::T_IDENTIFIER, at(3, 15), "i"},     // i
+        Token{TokenType::T_R_PAREN, at(3, 16)},             // )
+        Token{TokenType::T_SEMICOLON, at(3, 17)},           // ;
+        Token{TokenType::T_R_BRACE, at(4, 5)},              // }
+        Token{TokenType::T_R_BRACE, at(5, 1)},              // }
     };
 
     std::vector<std::pair<std::string, int>> expected_elements = {
@@ -636,19 +739,19 @@ BOOST_AUTO_TEST_CASE(test_for_loop_with_function_call) {
 // 4;
 BOOST_AUTO_TEST_CASE(test_code_outside_function) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_INT, Position(1, 15)},                // int
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_RETURN, Position(2, 5)},              // return
-        Token{TokenType::T_LITERAL_INT, Position(2, 12), 0},     // 0
-        Token{TokenType::T_SEMICOLON, Position(2, 13)},          // ;
-        Token{TokenType::T_R_BRACE, Position(3, 1)},             // }
-        Token{TokenType::T_LITERAL_INT, Position(4, 1), 4},      // 4
-        Token{TokenType::T_SEMICOLON, Position(4, 1)},           // ;
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_INT, at(1, 15)},                // int
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_RETURN, at(2, 5)},              // return
+        Token{TokenType::T_LITERAL_INT, at(2, 12), 0},     // 0
+        Token{TokenType::T_SEMICOLON, at(2, 13)},          // ;
+        Token{TokenType::T_R_BRACE, at(3, 1)},             // }
+        Token{TokenType::T_LITERAL_INT, at(4, 1), 4},      // 4
+        Token{TokenType::T_SEMICOLON, at(4, 1)},           // ;
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -659,12 +762,12 @@ BOOST_AUTO_TEST_CASE(test_code_outside_function) {
 // def some_function()
 BOOST_AUTO_TEST_CASE(test_missing_function_body) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                          // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "some_function"},  // some_function
-        Token{TokenType::T_L_PAREN, Position(1, 18)},                     // (
-        Token{TokenType::T_R_PAREN, Position(1, 19)},                     // )
-        Token{TokenType::T_ARROW, Position(1, 21)},                       // ->
-        Token{TokenType::T_INT, Position(1, 24)},                         // int
+        Token{TokenType::T_DEF, at(1, 1)},                          // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "some_function"},  // some_function
+        Token{TokenType::T_L_PAREN, at(1, 18)},                     // (
+        Token{TokenType::T_R_PAREN, at(1, 19)},                     // )
+        Token{TokenType::T_ARROW, at(1, 21)},                       // ->
+        Token{TokenType::T_INT, at(1, 24)},                         // int
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -677,16 +780,16 @@ BOOST_AUTO_TEST_CASE(test_missing_function_body) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_identifier_in_function_definition) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},       // def
-        Token{TokenType::T_L_PAREN, Position(1, 5)},   // (
-        Token{TokenType::T_MUT, Position(1, 6)},       // mut
-        Token{TokenType::T_COLON, Position(1, 10)},    // :
-        Token{TokenType::T_INT, Position(1, 12)},      // int
-        Token{TokenType::T_R_PAREN, Position(1, 15)},  // )
-        Token{TokenType::T_ARROW, Position(1, 17)},    // ->
-        Token{TokenType::T_NONE, Position(1, 20)},     // none
-        Token{TokenType::T_L_BRACE, Position(1, 25)},  // {
-        Token{TokenType::T_R_BRACE, Position(2, 1)},   // }
+        Token{TokenType::T_DEF, at(1, 1)},       // def
+        Token{TokenType::T_L_PAREN, at(1, 5)},   // (
+        Token{TokenType::T_MUT, at(1, 6)},       // mut
+        Token{TokenType::T_COLON, at(1, 10)},    // :
+        Token{TokenType::T_INT, at(1, 12)},      // int
+        Token{TokenType::T_R_PAREN, at(1, 15)},  // )
+        Token{TokenType::T_ARROW, at(1, 17)},    // ->
+        Token{TokenType::T_NONE, at(1, 20)},     // none
+        Token{TokenType::T_L_BRACE, at(1, 25)},  // {
+        Token{TokenType::T_R_BRACE, at(2, 1)},   // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -699,12 +802,12 @@ BOOST_AUTO_TEST_CASE(test_missing_identifier_in_function_definition) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_argument_list) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                          // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "some_function"},  // some_function
-        Token{TokenType::T_ARROW, Position(1, 18)},                       // ->
-        Token{TokenType::T_INT, Position(1, 21)},                         // int
-        Token{TokenType::T_L_BRACE, Position(1, 25)},                     // {
-        Token{TokenType::T_R_BRACE, Position(2, 1)},                      // }
+        Token{TokenType::T_DEF, at(1, 1)},                          // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "some_function"},  // some_function
+        Token{TokenType::T_ARROW, at(1, 18)},                       // ->
+        Token{TokenType::T_INT, at(1, 21)},                         // int
+        Token{TokenType::T_L_BRACE, at(1, 25)},                     // {
+        Token{TokenType::T_R_BRACE, at(2, 1)},                      // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -717,12 +820,12 @@ BOOST_AUTO_TEST_CASE(test_missing_argument_list) {
 // {
 BOOST_AUTO_TEST_CASE(test_missing_return_type) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                          // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "some_function"},  // some_function
-        Token{TokenType::T_L_PAREN, Position(1, 18)},                     // (
-        Token{TokenType::T_R_PAREN, Position(1, 19)},                     // )
-        Token{TokenType::T_L_BRACE, Position(1, 21)},                     // {
-        Token{TokenType::T_R_BRACE, Position(2, 1)},                      // }
+        Token{TokenType::T_DEF, at(1, 1)},                          // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "some_function"},  // some_function
+        Token{TokenType::T_L_PAREN, at(1, 18)},                     // (
+        Token{TokenType::T_R_PAREN, at(1, 19)},                     // )
+        Token{TokenType::T_L_BRACE, at(1, 21)},                     // {
+        Token{TokenType::T_R_BRACE, at(2, 1)},                      // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -735,13 +838,13 @@ BOOST_AUTO_TEST_CASE(test_missing_return_type) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_return_type_after_arrow) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                          // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "some_function"},  // some_function
-        Token{TokenType::T_L_PAREN, Position(1, 18)},                     // (
-        Token{TokenType::T_R_PAREN, Position(1, 19)},                     // )
-        Token{TokenType::T_ARROW, Position(1, 21)},                       // ->
-        Token{TokenType::T_L_BRACE, Position(1, 24)},                     // {
-        Token{TokenType::T_R_BRACE, Position(2, 1)},                      // }
+        Token{TokenType::T_DEF, at(1, 1)},                          // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "some_function"},  // some_function
+        Token{TokenType::T_L_PAREN, at(1, 18)},                     // (
+        Token{TokenType::T_R_PAREN, at(1, 19)},                     // )
+        Token{TokenType::T_ARROW, at(1, 21)},                       // ->
+        Token{TokenType::T_L_BRACE, at(1, 24)},                     // {
+        Token{TokenType::T_R_BRACE, at(2, 1)},                      // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -754,16 +857,16 @@ BOOST_AUTO_TEST_CASE(test_missing_return_type_after_arrow) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_semicolon_in_return) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_INT, Position(1, 15)},                // int
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_RETURN, Position(2, 5)},              // return
-        Token{TokenType::T_LITERAL_INT, Position(2, 12), 0},     // 0
-        Token{TokenType::T_R_BRACE, Position(3, 1)},             // }
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_INT, at(1, 15)},                // int
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_RETURN, at(2, 5)},              // return
+        Token{TokenType::T_LITERAL_INT, at(2, 12), 0},     // 0
+        Token{TokenType::T_R_BRACE, at(3, 1)},             // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -777,15 +880,15 @@ BOOST_AUTO_TEST_CASE(test_missing_semicolon_in_return) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_semicolon_after_continue) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_NONE, Position(1, 15)},               // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_CONTINUE, Position(2, 5)},            // continue
-        Token{TokenType::T_R_BRACE, Position(3, 1)},             // }
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_NONE, at(1, 15)},               // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_CONTINUE, at(2, 5)},            // continue
+        Token{TokenType::T_R_BRACE, at(3, 1)},             // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -800,17 +903,17 @@ BOOST_AUTO_TEST_CASE(test_missing_semicolon_after_continue) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_semicolon_after_expression) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_NONE, Position(1, 15)},               // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_LITERAL_INT, Position(2, 5), 4},      // 4
-        Token{TokenType::T_PLUS, Position(2, 7)},                // +
-        Token{TokenType::T_LITERAL_INT, Position(2, 9), 4},      // 4
-        Token{TokenType::T_R_BRACE, Position(3, 1)},             // }
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_NONE, at(1, 15)},               // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_LITERAL_INT, at(2, 5), 4},      // 4
+        Token{TokenType::T_PLUS, at(2, 7)},                // +
+        Token{TokenType::T_LITERAL_INT, at(2, 9), 4},      // 4
+        Token{TokenType::T_R_BRACE, at(3, 1)},             // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -824,18 +927,18 @@ BOOST_AUTO_TEST_CASE(test_missing_semicolon_after_expression) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_typed_identifier) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_NONE, Position(1, 15)},               // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_LET, Position(2, 5)},                 // let
-        Token{TokenType::T_ASSIGN, Position(2, 9)},              // =
-        Token{TokenType::T_LITERAL_INT, Position(2, 11), 4},     // 4
-        Token{TokenType::T_SEMICOLON, Position(2, 12)},          // ;
-        Token{TokenType::T_R_BRACE, Position(3, 1)},             // }
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_NONE, at(1, 15)},               // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_LET, at(2, 5)},                 // let
+        Token{TokenType::T_ASSIGN, at(2, 9)},              // =
+        Token{TokenType::T_LITERAL_INT, at(2, 11), 4},     // 4
+        Token{TokenType::T_SEMICOLON, at(2, 12)},          // ;
+        Token{TokenType::T_R_BRACE, at(3, 1)},             // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -849,20 +952,20 @@ BOOST_AUTO_TEST_CASE(test_missing_typed_identifier) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_assignment_var_decl) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_NONE, Position(1, 15)},               // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_LET, Position(2, 5)},                 // let
-        Token{TokenType::T_IDENTIFIER, Position(2, 9), "x"},     // x
-        Token{TokenType::T_COLON, Position(2, 10)},              // :
-        Token{TokenType::T_INT, Position(2, 12)},                // int
-        Token{TokenType::T_LITERAL_INT, Position(2, 16), 4},     // 4
-        Token{TokenType::T_SEMICOLON, Position(2, 17)},          // ;
-        Token{TokenType::T_R_BRACE, Position(3, 1)},             // }
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_NONE, at(1, 15)},               // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_LET, at(2, 5)},                 // let
+        Token{TokenType::T_IDENTIFIER, at(2, 9), "x"},     // x
+        Token{TokenType::T_COLON, at(2, 10)},              // :
+        Token{TokenType::T_INT, at(2, 12)},                // int
+        Token{TokenType::T_LITERAL_INT, at(2, 16), 4},     // 4
+        Token{TokenType::T_SEMICOLON, at(2, 17)},          // ;
+        Token{TokenType::T_R_BRACE, at(3, 1)},             // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -878,39 +981,39 @@ BOOST_AUTO_TEST_CASE(test_missing_assignment_var_decl) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_assignment_in_for_loop) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_INT, Position(1, 15)},                // int
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_FOR, Position(2, 5)},                 // for
-        Token{TokenType::T_L_PAREN, Position(2, 9)},             // (
-        Token{TokenType::T_IDENTIFIER, Position(2, 10), "i"},    // i
-        Token{TokenType::T_COLON, Position(2, 11)},              // :
-        Token{TokenType::T_INT, Position(2, 13)},                // int
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_INT, at(1, 15)},                // int
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_FOR, at(2, 5)},                 // for
+        Token{TokenType::T_L_PAREN, at(2, 9)},             // (
+        Token{TokenType::T_IDENTIFIER, at(2, 10), "i"},    // i
+        Token{TokenType::T_COLON, at(2, 11)},              // :
+        Token{TokenType::T_INT, at(2, 13)},                // int
         // missing assing
-        Token{TokenType::T_LITERAL_INT, Position(2, 16), 0},      // 0
-        Token{TokenType::T_SEMICOLON, Position(2, 17)},           // ;
-        Token{TokenType::T_IDENTIFIER, Position(2, 19), "i"},     // i
-        Token{TokenType::T_LESS, Position(2, 21)},                // <
-        Token{TokenType::T_LITERAL_INT, Position(2, 23), 10},     // 10
-        Token{TokenType::T_SEMICOLON, Position(2, 25)},           // ;
-        Token{TokenType::T_IDENTIFIER, Position(2, 27), "i"},     // i
-        Token{TokenType::T_ASSIGN, Position(2, 29)},              // =
-        Token{TokenType::T_IDENTIFIER, Position(2, 31), "i"},     // i
-        Token{TokenType::T_PLUS, Position(2, 33)},                // +
-        Token{TokenType::T_LITERAL_INT, Position(2, 35), 1},      // 1
-        Token{TokenType::T_R_PAREN, Position(2, 36)},             // )
-        Token{TokenType::T_L_BRACE, Position(2, 38)},             // {
-        Token{TokenType::T_IDENTIFIER, Position(3, 9), "print"},  // print
-        Token{TokenType::T_L_PAREN, Position(3, 14)},             // (
-        Token{TokenType::T_IDENTIFIER, Position(3, 15), "i"},     // i
-        Token{TokenType::T_R_PAREN, Position(3, 16)},             // )
-        Token{TokenType::T_SEMICOLON, Position(3, 17)},           // ;
-        Token{TokenType::T_R_BRACE, Position(4, 5)},              // }
-        Token{TokenType::T_R_BRACE, Position(5, 1)},              // }
+        Token{TokenType::T_LITERAL_INT, at(2, 16), 0},      // 0
+        Token{TokenType::T_SEMICOLON, at(2, 17)},           // ;
+        Token{TokenType::T_IDENTIFIER, at(2, 19), "i"},     // i
+        Token{TokenType::T_LESS, at(2, 21)},                // <
+        Token{TokenType::T_LITERAL_INT, at(2, 23), 10},     // 10
+        Token{TokenType::T_SEMICOLON, at(2, 25)},           // ;
+        Token{TokenType::T_IDENTIFIER, at(2, 27), "i"},     // i
+        Token{TokenType::T_ASSIGN, at(2, 29)},              // =
+        Token{TokenType::T_IDENTIFIER, at(2, 31), "i"},     // i
+        Token{TokenType::T_PLUS, at(2, 33)},                // +
+        Token{TokenType::T_LITERAL_INT, at(2, 35), 1},      // 1
+        Token{TokenType::T_R_PAREN, at(2, 36)},             // )
+        Token{TokenType::T_L_BRACE, at(2, 38)},             // {
+        Token{TokenType::T_IDENTIFIER, at(3, 9), "print"},  // print
+        Token{TokenType::T_L_PAREN, at(3, 14)},             // (
+        Token{TokenType::T_IDENTIFIER, at(3, 15), "i"},     // i
+        Token{TokenType::T_R_PAREN, at(3, 16)},             // )
+        Token{TokenType::T_SEMICOLON, at(3, 17)},           // ;
+        Token{TokenType::T_R_BRACE, at(4, 5)},              // }
+        Token{TokenType::T_R_BRACE, at(5, 1)},              // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -926,39 +1029,39 @@ BOOST_AUTO_TEST_CASE(test_missing_assignment_in_for_loop) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_assignment_in_for_loop_update) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_INT, Position(1, 15)},                // int
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_FOR, Position(2, 5)},                 // for
-        Token{TokenType::T_L_PAREN, Position(2, 9)},             // (
-        Token{TokenType::T_IDENTIFIER, Position(2, 10), "i"},    // i
-        Token{TokenType::T_COLON, Position(2, 11)},              // :
-        Token{TokenType::T_INT, Position(2, 13)},                // int
-        Token{TokenType::T_ASSIGN, Position(2, 17)},             // =
-        Token{TokenType::T_LITERAL_INT, Position(2, 19), 0},     // 0
-        Token{TokenType::T_SEMICOLON, Position(2, 20)},          // ;
-        Token{TokenType::T_IDENTIFIER, Position(2, 22), "i"},    // i
-        Token{TokenType::T_LESS, Position(2, 24)},               // <
-        Token{TokenType::T_LITERAL_INT, Position(2, 26), 10},    // 10
-        Token{TokenType::T_SEMICOLON, Position(2, 28)},          // ;
-        Token{TokenType::T_IDENTIFIER, Position(2, 30), "i"},    // i
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_INT, at(1, 15)},                // int
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_FOR, at(2, 5)},                 // for
+        Token{TokenType::T_L_PAREN, at(2, 9)},             // (
+        Token{TokenType::T_IDENTIFIER, at(2, 10), "i"},    // i
+        Token{TokenType::T_COLON, at(2, 11)},              // :
+        Token{TokenType::T_INT, at(2, 13)},                // int
+        Token{TokenType::T_ASSIGN, at(2, 17)},             // =
+        Token{TokenType::T_LITERAL_INT, at(2, 19), 0},     // 0
+        Token{TokenType::T_SEMICOLON, at(2, 20)},          // ;
+        Token{TokenType::T_IDENTIFIER, at(2, 22), "i"},    // i
+        Token{TokenType::T_LESS, at(2, 24)},               // <
+        Token{TokenType::T_LITERAL_INT, at(2, 26), 10},    // 10
+        Token{TokenType::T_SEMICOLON, at(2, 28)},          // ;
+        Token{TokenType::T_IDENTIFIER, at(2, 30), "i"},    // i
         // Brak TokenType::T_ASSIGN
-        Token{TokenType::T_IDENTIFIER, Position(2, 32), "i"},     // i
-        Token{TokenType::T_PLUS, Position(2, 34)},                // +
-        Token{TokenType::T_LITERAL_INT, Position(2, 36), 1},      // 1
-        Token{TokenType::T_R_PAREN, Position(2, 37)},             // )
-        Token{TokenType::T_L_BRACE, Position(2, 39)},             // {
-        Token{TokenType::T_IDENTIFIER, Position(3, 9), "print"},  // print
-        Token{TokenType::T_L_PAREN, Position(3, 14)},             // (
-        Token{TokenType::T_IDENTIFIER, Position(3, 15), "i"},     // i
-        Token{TokenType::T_R_PAREN, Position(3, 16)},             // )
-        Token{TokenType::T_SEMICOLON, Position(3, 17)},           // ;
-        Token{TokenType::T_R_BRACE, Position(4, 5)},              // }
-        Token{TokenType::T_R_BRACE, Position(5, 1)},              // }
+        Token{TokenType::T_IDENTIFIER, at(2, 32), "i"},     // i
+        Token{TokenType::T_PLUS, at(2, 34)},                // +
+        Token{TokenType::T_LITERAL_INT, at(2, 36), 1},      // 1
+        Token{TokenType::T_R_PAREN, at(2, 37)},             // )
+        Token{TokenType::T_L_BRACE, at(2, 39)},             // {
+        Token{TokenType::T_IDENTIFIER, at(3, 9), "print"},  // print
+        Token{TokenType::T_L_PAREN, at(3, 14)},             // (
+        Token{TokenType::T_IDENTIFIER, at(3, 15), "i"},     // i
+        Token{TokenType::T_R_PAREN, at(3, 16)},             // )
+        Token{TokenType::T_SEMICOLON, at(3, 17)},           // ;
+        Token{TokenType::T_R_BRACE, at(4, 5)},              // }
+        Token{TokenType::T_R_BRACE, at(5, 1)},              // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -972,21 +1075,21 @@ BOOST_AUTO_TEST_CASE(test_missing_assignment_in_for_loop_update) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_expression_after_or) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_NONE, Position(1, 15)},               // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_IF, Position(2, 5)},                  // if
-        Token{TokenType::T_L_PAREN, Position(2, 8)},             // (
-        Token{TokenType::T_LITERAL_BOOL, Position(2, 9), true},  // true
-        Token{TokenType::T_OR, Position(2, 14)},                 // or
-        Token{TokenType::T_R_PAREN, Position(2, 17)},            // )
-        Token{TokenType::T_L_BRACE, Position(2, 19)},            // {
-        Token{TokenType::T_R_BRACE, Position(3, 5)},             // }
-        Token{TokenType::T_R_BRACE, Position(4, 1)},             // }
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_NONE, at(1, 15)},               // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_IF, at(2, 5)},                  // if
+        Token{TokenType::T_L_PAREN, at(2, 8)},             // (
+        Token{TokenType::T_LITERAL_BOOL, at(2, 9), true},  // true
+        Token{TokenType::T_OR, at(2, 14)},                 // or
+        Token{TokenType::T_R_PAREN, at(2, 17)},            // )
+        Token{TokenType::T_L_BRACE, at(2, 19)},            // {
+        Token{TokenType::T_R_BRACE, at(3, 5)},             // }
+        Token{TokenType::T_R_BRACE, at(4, 1)},             // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -1000,21 +1103,21 @@ BOOST_AUTO_TEST_CASE(test_missing_expression_after_or) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_expression_after_and) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_NONE, Position(1, 15)},               // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_IF, Position(2, 5)},                  // if
-        Token{TokenType::T_L_PAREN, Position(2, 8)},             // (
-        Token{TokenType::T_LITERAL_BOOL, Position(2, 9), true},  // true
-        Token{TokenType::T_AND, Position(2, 14)},                // and
-        Token{TokenType::T_R_PAREN, Position(2, 18)},            // )
-        Token{TokenType::T_L_BRACE, Position(2, 20)},            // {
-        Token{TokenType::T_R_BRACE, Position(3, 5)},             // }
-        Token{TokenType::T_R_BRACE, Position(4, 1)},             // }
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_NONE, at(1, 15)},               // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_IF, at(2, 5)},                  // if
+        Token{TokenType::T_L_PAREN, at(2, 8)},             // (
+        Token{TokenType::T_LITERAL_BOOL, at(2, 9), true},  // true
+        Token{TokenType::T_AND, at(2, 14)},                // and
+        Token{TokenType::T_R_PAREN, at(2, 18)},            // )
+        Token{TokenType::T_L_BRACE, at(2, 20)},            // {
+        Token{TokenType::T_R_BRACE, at(3, 5)},             // }
+        Token{TokenType::T_R_BRACE, at(4, 1)},             // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -1028,21 +1131,21 @@ BOOST_AUTO_TEST_CASE(test_missing_expression_after_and) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_expression_after_equality) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_NONE, Position(1, 15)},               // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_IF, Position(2, 5)},                  // if
-        Token{TokenType::T_L_PAREN, Position(2, 8)},             // (
-        Token{TokenType::T_IDENTIFIER, Position(2, 9), "a"},     // a
-        Token{TokenType::T_EQUAL, Position(2, 11)},              // ==
-        Token{TokenType::T_R_PAREN, Position(2, 14)},            // )
-        Token{TokenType::T_L_BRACE, Position(2, 16)},            // {
-        Token{TokenType::T_R_BRACE, Position(3, 5)},             // }
-        Token{TokenType::T_R_BRACE, Position(4, 1)},             // }
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_NONE, at(1, 15)},               // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_IF, at(2, 5)},                  // if
+        Token{TokenType::T_L_PAREN, at(2, 8)},             // (
+        Token{TokenType::T_IDENTIFIER, at(2, 9), "a"},     // a
+        Token{TokenType::T_EQUAL, at(2, 11)},              // ==
+        Token{TokenType::T_R_PAREN, at(2, 14)},            // )
+        Token{TokenType::T_L_BRACE, at(2, 16)},            // {
+        Token{TokenType::T_R_BRACE, at(3, 5)},             // }
+        Token{TokenType::T_R_BRACE, at(4, 1)},             // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -1056,21 +1159,21 @@ BOOST_AUTO_TEST_CASE(test_missing_expression_after_equality) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_expression_after_comparison) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_NONE, Position(1, 15)},               // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_IF, Position(2, 5)},                  // if
-        Token{TokenType::T_L_PAREN, Position(2, 8)},             // (
-        Token{TokenType::T_IDENTIFIER, Position(2, 9), "a"},     // a
-        Token{TokenType::T_LESS, Position(2, 11)},               // <
-        Token{TokenType::T_R_PAREN, Position(2, 13)},            // )
-        Token{TokenType::T_L_BRACE, Position(2, 15)},            // {
-        Token{TokenType::T_R_BRACE, Position(3, 5)},             // }
-        Token{TokenType::T_R_BRACE, Position(4, 1)},             // }
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_NONE, at(1, 15)},               // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_IF, at(2, 5)},                  // if
+        Token{TokenType::T_L_PAREN, at(2, 8)},             // (
+        Token{TokenType::T_IDENTIFIER, at(2, 9), "a"},     // a
+        Token{TokenType::T_LESS, at(2, 11)},               // <
+        Token{TokenType::T_R_PAREN, at(2, 13)},            // )
+        Token{TokenType::T_L_BRACE, at(2, 15)},            // {
+        Token{TokenType::T_R_BRACE, at(3, 5)},             // }
+        Token{TokenType::T_R_BRACE, at(4, 1)},             // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -1084,23 +1187,23 @@ BOOST_AUTO_TEST_CASE(test_missing_expression_after_comparison) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_expression_after_additive) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_NONE, Position(1, 15)},               // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_LET, Position(2, 5)},                 // let
-        Token{TokenType::T_IDENTIFIER, Position(2, 9), "x"},     // x
-        Token{TokenType::T_COLON, Position(2, 10)},              // :
-        Token{TokenType::T_INT, Position(2, 12)},                // int
-        Token{TokenType::T_ASSIGN, Position(2, 16)},             // =
-        Token{TokenType::T_LITERAL_INT, Position(2, 18), 4},     // 4
-        Token{TokenType::T_PLUS, Position(2, 20)},               // +
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_NONE, at(1, 15)},               // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_LET, at(2, 5)},                 // let
+        Token{TokenType::T_IDENTIFIER, at(2, 9), "x"},     // x
+        Token{TokenType::T_COLON, at(2, 10)},              // :
+        Token{TokenType::T_INT, at(2, 12)},                // int
+        Token{TokenType::T_ASSIGN, at(2, 16)},             // =
+        Token{TokenType::T_LITERAL_INT, at(2, 18), 4},     // 4
+        Token{TokenType::T_PLUS, at(2, 20)},               // +
         // missing expr
-        Token{TokenType::T_SEMICOLON, Position(2, 21)},  // ;
-        Token{TokenType::T_R_BRACE, Position(3, 1)},     // }
+        Token{TokenType::T_SEMICOLON, at(2, 21)},  // ;
+        Token{TokenType::T_R_BRACE, at(3, 1)},     // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -1114,23 +1217,23 @@ BOOST_AUTO_TEST_CASE(test_missing_expression_after_additive) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_expression_after_multiplicative) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_NONE, Position(1, 15)},               // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_LET, Position(2, 5)},                 // let
-        Token{TokenType::T_IDENTIFIER, Position(2, 9), "x"},     // x
-        Token{TokenType::T_COLON, Position(2, 10)},              // :
-        Token{TokenType::T_INT, Position(2, 12)},                // int
-        Token{TokenType::T_ASSIGN, Position(2, 16)},             // =
-        Token{TokenType::T_LITERAL_INT, Position(2, 18), 4},     // 4
-        Token{TokenType::T_MULTIPLY, Position(2, 20)},           // *
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_NONE, at(1, 15)},               // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_LET, at(2, 5)},                 // let
+        Token{TokenType::T_IDENTIFIER, at(2, 9), "x"},     // x
+        Token{TokenType::T_COLON, at(2, 10)},              // :
+        Token{TokenType::T_INT, at(2, 12)},                // int
+        Token{TokenType::T_ASSIGN, at(2, 16)},             // =
+        Token{TokenType::T_LITERAL_INT, at(2, 18), 4},     // 4
+        Token{TokenType::T_MULTIPLY, at(2, 20)},           // *
         // missing expr
-        Token{TokenType::T_SEMICOLON, Position(2, 21)},  // ;
-        Token{TokenType::T_R_BRACE, Position(3, 1)},     // }
+        Token{TokenType::T_SEMICOLON, at(2, 21)},  // ;
+        Token{TokenType::T_R_BRACE, at(3, 1)},     // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -1144,19 +1247,19 @@ BOOST_AUTO_TEST_CASE(test_missing_expression_after_multiplicative) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_expression_after_unary) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                   // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},    // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},               // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},              // )
-        Token{TokenType::T_ARROW, Position(1, 12)},                // ->
-        Token{TokenType::T_NONE, Position(1, 15)},                 // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},              // {
-        Token{TokenType::T_IDENTIFIER, Position(2, 5), "is_foo"},  // is_foo
-        Token{TokenType::T_ASSIGN, Position(2, 12)},               // =
-        Token{TokenType::T_NOT, Position(2, 14)},                  // not
+        Token{TokenType::T_DEF, at(1, 1)},                   // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},    // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},               // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},              // )
+        Token{TokenType::T_ARROW, at(1, 12)},                // ->
+        Token{TokenType::T_NONE, at(1, 15)},                 // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},              // {
+        Token{TokenType::T_IDENTIFIER, at(2, 5), "is_foo"},  // is_foo
+        Token{TokenType::T_ASSIGN, at(2, 12)},               // =
+        Token{TokenType::T_NOT, at(2, 14)},                  // not
         // missing expr
-        Token{TokenType::T_SEMICOLON, Position(2, 18)},  // ;
-        Token{TokenType::T_R_BRACE, Position(3, 1)},     // }
+        Token{TokenType::T_SEMICOLON, at(2, 18)},  // ;
+        Token{TokenType::T_R_BRACE, at(3, 1)},     // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -1170,18 +1273,18 @@ BOOST_AUTO_TEST_CASE(test_missing_expression_after_unary) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_expression_after_function_composition) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_NONE, Position(1, 15)},               // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_IDENTIFIER, Position(2, 5), "foo1"},  // foo1
-        Token{TokenType::T_FUNC_COMPOSITION, Position(2, 10)},   // &&
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_NONE, at(1, 15)},               // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_IDENTIFIER, at(2, 5), "foo1"},  // foo1
+        Token{TokenType::T_FUNC_COMPOSITION, at(2, 10)},   // &&
         // Brak wyrażenia po operatorze &&
-        Token{TokenType::T_SEMICOLON, Position(2, 12)},  // ;
-        Token{TokenType::T_R_BRACE, Position(3, 1)},     // }
+        Token{TokenType::T_SEMICOLON, at(2, 12)},  // ;
+        Token{TokenType::T_R_BRACE, at(3, 1)},     // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -1195,31 +1298,31 @@ BOOST_AUTO_TEST_CASE(test_missing_expression_after_function_composition) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_bind_front_operator) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                     // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},      // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},                 // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},                // )
-        Token{TokenType::T_ARROW, Position(1, 12)},                  // ->
-        Token{TokenType::T_NONE, Position(1, 15)},                   // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},                // {
-        Token{TokenType::T_LET, Position(2, 5)},                     // let
-        Token{TokenType::T_IDENTIFIER, Position(2, 9), "four"},      // four
-        Token{TokenType::T_COLON, Position(2, 13)},                  // :
-        Token{TokenType::T_FUNCTION, Position(2, 15)},               // function
-        Token{TokenType::T_LESS, Position(2, 23)},                   // <
-        Token{TokenType::T_NONE, Position(2, 24)},                   // none
-        Token{TokenType::T_COLON, Position(2, 28)},                  // :
-        Token{TokenType::T_INT, Position(2, 29)},                    // int
-        Token{TokenType::T_GREATER, Position(2, 32)},                // >
-        Token{TokenType::T_ASSIGN, Position(2, 34)},                 // =
-        Token{TokenType::T_L_PAREN, Position(2, 36)},                // (
-        Token{TokenType::T_LITERAL_INT, Position(2, 37), 2},         // 2
-        Token{TokenType::T_COMMA, Position(2, 38)},                  // ,
-        Token{TokenType::T_LITERAL_INT, Position(2, 39), 2},         // 2
-        Token{TokenType::T_R_PAREN, Position(2, 40)},                // )
-        Token{TokenType::T_IDENTIFIER, Position(2, 42), "sum_two"},  // sum_two
-        Token{TokenType::T_SEMICOLON, Position(2, 49)},              // ;
-        Token{TokenType::T_R_BRACE, Position(3, 1)},                 // }
+        Token{TokenType::T_DEF, at(1, 1)},                     // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},      // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},                 // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},                // )
+        Token{TokenType::T_ARROW, at(1, 12)},                  // ->
+        Token{TokenType::T_NONE, at(1, 15)},                   // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},                // {
+        Token{TokenType::T_LET, at(2, 5)},                     // let
+        Token{TokenType::T_IDENTIFIER, at(2, 9), "four"},      // four
+        Token{TokenType::T_COLON, at(2, 13)},                  // :
+        Token{TokenType::T_FUNCTION, at(2, 15)},               // function
+        Token{TokenType::T_LESS, at(2, 23)},                   // <
+        Token{TokenType::T_NONE, at(2, 24)},                   // none
+        Token{TokenType::T_COLON, at(2, 28)},                  // :
+        Token{TokenType::T_INT, at(2, 29)},                    // int
+        Token{TokenType::T_GREATER, at(2, 32)},                // >
+        Token{TokenType::T_ASSIGN, at(2, 34)},                 // =
+        Token{TokenType::T_L_PAREN, at(2, 36)},                // (
+        Token{TokenType::T_LITERAL_INT, at(2, 37), 2},         // 2
+        Token{TokenType::T_COMMA, at(2, 38)},                  // ,
+        Token{TokenType::T_LITERAL_INT, at(2, 39), 2},         // 2
+        Token{TokenType::T_R_PAREN, at(2, 40)},                // )
+        Token{TokenType::T_IDENTIFIER, at(2, 42), "sum_two"},  // sum_two
+        Token{TokenType::T_SEMICOLON, at(2, 49)},              // ;
+        Token{TokenType::T_R_BRACE, at(3, 1)},                 // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -1233,32 +1336,32 @@ BOOST_AUTO_TEST_CASE(test_missing_bind_front_operator) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_bind_front_target) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_NONE, Position(1, 15)},               // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_LET, Position(2, 5)},                 // let
-        Token{TokenType::T_IDENTIFIER, Position(2, 9), "four"},  // four
-        Token{TokenType::T_COLON, Position(2, 13)},              // :
-        Token{TokenType::T_FUNCTION, Position(2, 15)},           // function
-        Token{TokenType::T_LESS, Position(2, 23)},               // <
-        Token{TokenType::T_NONE, Position(2, 24)},               // none
-        Token{TokenType::T_COLON, Position(2, 28)},              // :
-        Token{TokenType::T_INT, Position(2, 29)},                // int
-        Token{TokenType::T_GREATER, Position(2, 32)},            // >
-        Token{TokenType::T_ASSIGN, Position(2, 34)},             // =
-        Token{TokenType::T_L_PAREN, Position(2, 36)},            // (
-        Token{TokenType::T_LITERAL_INT, Position(2, 37), 2},     // 2
-        Token{TokenType::T_COMMA, Position(2, 38)},              // ,
-        Token{TokenType::T_LITERAL_INT, Position(2, 39), 2},     // 2
-        Token{TokenType::T_R_PAREN, Position(2, 40)},            // )
-        Token{TokenType::T_BIND_FRONT, Position(2, 42)},         // >>
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_NONE, at(1, 15)},               // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_LET, at(2, 5)},                 // let
+        Token{TokenType::T_IDENTIFIER, at(2, 9), "four"},  // four
+        Token{TokenType::T_COLON, at(2, 13)},              // :
+        Token{TokenType::T_FUNCTION, at(2, 15)},           // function
+        Token{TokenType::T_LESS, at(2, 23)},               // <
+        Token{TokenType::T_NONE, at(2, 24)},               // none
+        Token{TokenType::T_COLON, at(2, 28)},              // :
+        Token{TokenType::T_INT, at(2, 29)},                // int
+        Token{TokenType::T_GREATER, at(2, 32)},            // >
+        Token{TokenType::T_ASSIGN, at(2, 34)},             // =
+        Token{TokenType::T_L_PAREN, at(2, 36)},            // (
+        Token{TokenType::T_LITERAL_INT, at(2, 37), 2},     // 2
+        Token{TokenType::T_COMMA, at(2, 38)},              // ,
+        Token{TokenType::T_LITERAL_INT, at(2, 39), 2},     // 2
+        Token{TokenType::T_R_PAREN, at(2, 40)},            // )
+        Token{TokenType::T_BIND_FRONT, at(2, 42)},         // >>
         // Brak celu po operatorze >>
-        Token{TokenType::T_SEMICOLON, Position(2, 44)},  // ;
-        Token{TokenType::T_R_BRACE, Position(3, 1)},     // }
+        Token{TokenType::T_SEMICOLON, at(2, 44)},  // ;
+        Token{TokenType::T_R_BRACE, at(3, 1)},     // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -1273,22 +1376,22 @@ BOOST_AUTO_TEST_CASE(test_missing_bind_front_target) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_parentheses_in_if_condition) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_NONE, Position(1, 15)},               // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_IF, Position(2, 5)},                  // if
-        Token{TokenType::T_LITERAL_BOOL, Position(2, 8), true},  // true
-        Token{TokenType::T_L_BRACE, Position(2, 13)},            // {
-        Token{TokenType::T_IDENTIFIER, Position(3, 9), "foo"},   // foo
-        Token{TokenType::T_L_PAREN, Position(3, 12)},            // (
-        Token{TokenType::T_R_PAREN, Position(3, 13)},            // )
-        Token{TokenType::T_SEMICOLON, Position(3, 14)},          // ;
-        Token{TokenType::T_R_BRACE, Position(4, 5)},             // }
-        Token{TokenType::T_R_BRACE, Position(5, 1)},             // }
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_NONE, at(1, 15)},               // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_IF, at(2, 5)},                  // if
+        Token{TokenType::T_LITERAL_BOOL, at(2, 8), true},  // true
+        Token{TokenType::T_L_BRACE, at(2, 13)},            // {
+        Token{TokenType::T_IDENTIFIER, at(3, 9), "foo"},   // foo
+        Token{TokenType::T_L_PAREN, at(3, 12)},            // (
+        Token{TokenType::T_R_PAREN, at(3, 13)},            // )
+        Token{TokenType::T_SEMICOLON, at(3, 14)},          // ;
+        Token{TokenType::T_R_BRACE, at(4, 5)},             // }
+        Token{TokenType::T_R_BRACE, at(5, 1)},             // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -1303,24 +1406,24 @@ BOOST_AUTO_TEST_CASE(test_missing_parentheses_in_if_condition) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_body_for_if_statement) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_NONE, Position(1, 15)},               // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_IF, Position(2, 5)},                  // if
-        Token{TokenType::T_L_PAREN, Position(2, 8)},             // (
-        Token{TokenType::T_IDENTIFIER, Position(2, 9), "x"},     // x
-        Token{TokenType::T_GREATER, Position(2, 11)},            // >
-        Token{TokenType::T_LITERAL_INT, Position(2, 13), 3},     // 3
-        Token{TokenType::T_R_PAREN, Position(2, 14)},            // )
-        Token{TokenType::T_IDENTIFIER, Position(3, 9), "foo"},   // foo
-        Token{TokenType::T_L_PAREN, Position(3, 12)},            // (
-        Token{TokenType::T_R_PAREN, Position(3, 13)},            // )
-        Token{TokenType::T_SEMICOLON, Position(3, 14)},          // ;
-        Token{TokenType::T_R_BRACE, Position(5, 1)},             // }
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_NONE, at(1, 15)},               // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_IF, at(2, 5)},                  // if
+        Token{TokenType::T_L_PAREN, at(2, 8)},             // (
+        Token{TokenType::T_IDENTIFIER, at(2, 9), "x"},     // x
+        Token{TokenType::T_GREATER, at(2, 11)},            // >
+        Token{TokenType::T_LITERAL_INT, at(2, 13), 3},     // 3
+        Token{TokenType::T_R_PAREN, at(2, 14)},            // )
+        Token{TokenType::T_IDENTIFIER, at(3, 9), "foo"},   // foo
+        Token{TokenType::T_L_PAREN, at(3, 12)},            // (
+        Token{TokenType::T_R_PAREN, at(3, 13)},            // )
+        Token{TokenType::T_SEMICOLON, at(3, 14)},          // ;
+        Token{TokenType::T_R_BRACE, at(5, 1)},             // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -1336,29 +1439,29 @@ BOOST_AUTO_TEST_CASE(test_missing_body_for_if_statement) {
 // }
 BOOST_AUTO_TEST_CASE(test_invalid_body_for_else_statement) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_NONE, Position(1, 15)},               // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_IF, Position(2, 5)},                  // if
-        Token{TokenType::T_L_PAREN, Position(2, 8)},             // (
-        Token{TokenType::T_IDENTIFIER, Position(2, 9), "x"},     // x
-        Token{TokenType::T_GREATER, Position(2, 11)},            // >
-        Token{TokenType::T_LITERAL_INT, Position(2, 13), 3},     // 3
-        Token{TokenType::T_R_PAREN, Position(2, 14)},            // )
-        Token{TokenType::T_L_BRACE, Position(2, 16)},            // {
-        Token{TokenType::T_IDENTIFIER, Position(3, 9), "foo"},   // foo
-        Token{TokenType::T_L_PAREN, Position(3, 12)},            // (
-        Token{TokenType::T_R_PAREN, Position(3, 13)},            // )
-        Token{TokenType::T_SEMICOLON, Position(3, 14)},          // ;
-        Token{TokenType::T_R_BRACE, Position(4, 5)},             // }
-        Token{TokenType::T_ELSE, Position(4, 10)},               // else
-        Token{TokenType::T_LITERAL_INT, Position(4, 15), 4},     // 4
-        Token{TokenType::T_SEMICOLON, Position(4, 16)},          // ;
-        Token{TokenType::T_R_BRACE, Position(5, 1)},             // }
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_NONE, at(1, 15)},               // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_IF, at(2, 5)},                  // if
+        Token{TokenType::T_L_PAREN, at(2, 8)},             // (
+        Token{TokenType::T_IDENTIFIER, at(2, 9), "x"},     // x
+        Token{TokenType::T_GREATER, at(2, 11)},            // >
+        Token{TokenType::T_LITERAL_INT, at(2, 13), 3},     // 3
+        Token{TokenType::T_R_PAREN, at(2, 14)},            // )
+        Token{TokenType::T_L_BRACE, at(2, 16)},            // {
+        Token{TokenType::T_IDENTIFIER, at(3, 9), "foo"},   // foo
+        Token{TokenType::T_L_PAREN, at(3, 12)},            // (
+        Token{TokenType::T_R_PAREN, at(3, 13)},            // )
+        Token{TokenType::T_SEMICOLON, at(3, 14)},          // ;
+        Token{TokenType::T_R_BRACE, at(4, 5)},             // }
+        Token{TokenType::T_ELSE, at(4, 10)},               // else
+        Token{TokenType::T_LITERAL_INT, at(4, 15), 4},     // 4
+        Token{TokenType::T_SEMICOLON, at(4, 16)},          // ;
+        Token{TokenType::T_R_BRACE, at(5, 1)},             // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
@@ -1377,44 +1480,44 @@ BOOST_AUTO_TEST_CASE(test_invalid_body_for_else_statement) {
 // }
 BOOST_AUTO_TEST_CASE(test_missing_body_for_else_if_statement) {
     std::vector<Token> tokens = {
-        Token{TokenType::T_DEF, Position(1, 1)},                 // def
-        Token{TokenType::T_IDENTIFIER, Position(1, 5), "main"},  // main
-        Token{TokenType::T_L_PAREN, Position(1, 9)},             // (
-        Token{TokenType::T_R_PAREN, Position(1, 10)},            // )
-        Token{TokenType::T_ARROW, Position(1, 12)},              // ->
-        Token{TokenType::T_NONE, Position(1, 15)},               // none
-        Token{TokenType::T_L_BRACE, Position(1, 19)},            // {
-        Token{TokenType::T_IF, Position(2, 5)},                  // if
-        Token{TokenType::T_L_PAREN, Position(2, 8)},             // (
-        Token{TokenType::T_IDENTIFIER, Position(2, 9), "x"},     // x
-        Token{TokenType::T_GREATER, Position(2, 11)},            // >
-        Token{TokenType::T_LITERAL_INT, Position(2, 13), 3},     // 3
-        Token{TokenType::T_R_PAREN, Position(2, 14)},            // )
-        Token{TokenType::T_L_BRACE, Position(2, 16)},            // {
-        Token{TokenType::T_IDENTIFIER, Position(3, 9), "foo"},   // foo
-        Token{TokenType::T_L_PAREN, Position(3, 12)},            // (
-        Token{TokenType::T_R_PAREN, Position(3, 13)},            // )
-        Token{TokenType::T_SEMICOLON, Position(3, 14)},          // ;
-        Token{TokenType::T_R_BRACE, Position(4, 5)},             // }
-        Token{TokenType::T_ELSE, Position(4, 10)},               // else
-        Token{TokenType::T_IF, Position(4, 15)},                 // if
-        Token{TokenType::T_L_PAREN, Position(4, 18)},            // (
-        Token{TokenType::T_IDENTIFIER, Position(4, 19), "x"},    // x
-        Token{TokenType::T_LESS, Position(4, 21)},               // <
-        Token{TokenType::T_LITERAL_INT, Position(4, 23), 5},     // 5
-        Token{TokenType::T_R_PAREN, Position(4, 24)},            // )
-        Token{TokenType::T_IDENTIFIER, Position(5, 9), "foo2"},  // foo2
-        Token{TokenType::T_L_PAREN, Position(5, 14)},            // (
-        Token{TokenType::T_R_PAREN, Position(5, 15)},            // )
-        Token{TokenType::T_SEMICOLON, Position(5, 16)},          // ;
-        Token{TokenType::T_ELSE, Position(6, 5)},                // else
-        Token{TokenType::T_L_BRACE, Position(6, 10)},            // {
-        Token{TokenType::T_IDENTIFIER, Position(7, 9), "foo3"},  // foo3
-        Token{TokenType::T_L_PAREN, Position(7, 14)},            // (
-        Token{TokenType::T_R_PAREN, Position(7, 15)},            // )
-        Token{TokenType::T_SEMICOLON, Position(7, 16)},          // ;
-        Token{TokenType::T_R_BRACE, Position(8, 5)},             // }
-        Token{TokenType::T_R_BRACE, Position(9, 1)},             // }
+        Token{TokenType::T_DEF, at(1, 1)},                 // def
+        Token{TokenType::T_IDENTIFIER, at(1, 5), "main"},  // main
+        Token{TokenType::T_L_PAREN, at(1, 9)},             // (
+        Token{TokenType::T_R_PAREN, at(1, 10)},            // )
+        Token{TokenType::T_ARROW, at(1, 12)},              // ->
+        Token{TokenType::T_NONE, at(1, 15)},               // none
+        Token{TokenType::T_L_BRACE, at(1, 19)},            // {
+        Token{TokenType::T_IF, at(2, 5)},                  // if
+        Token{TokenType::T_L_PAREN, at(2, 8)},             // (
+        Token{TokenType::T_IDENTIFIER, at(2, 9), "x"},     // x
+        Token{TokenType::T_GREATER, at(2, 11)},            // >
+        Token{TokenType::T_LITERAL_INT, at(2, 13), 3},     // 3
+        Token{TokenType::T_R_PAREN, at(2, 14)},            // )
+        Token{TokenType::T_L_BRACE, at(2, 16)},            // {
+        Token{TokenType::T_IDENTIFIER, at(3, 9), "foo"},   // foo
+        Token{TokenType::T_L_PAREN, at(3, 12)},            // (
+        Token{TokenType::T_R_PAREN, at(3, 13)},            // )
+        Token{TokenType::T_SEMICOLON, at(3, 14)},          // ;
+        Token{TokenType::T_R_BRACE, at(4, 5)},             // }
+        Token{TokenType::T_ELSE, at(4, 10)},               // else
+        Token{TokenType::T_IF, at(4, 15)},                 // if
+        Token{TokenType::T_L_PAREN, at(4, 18)},            // (
+        Token{TokenType::T_IDENTIFIER, at(4, 19), "x"},    // x
+        Token{TokenType::T_LESS, at(4, 21)},               // <
+        Token{TokenType::T_LITERAL_INT, at(4, 23), 5},     // 5
+        Token{TokenType::T_R_PAREN, at(4, 24)},            // )
+        Token{TokenType::T_IDENTIFIER, at(5, 9), "foo2"},  // foo2
+        Token{TokenType::T_L_PAREN, at(5, 14)},            // (
+        Token{TokenType::T_R_PAREN, at(5, 15)},            // )
+        Token{TokenType::T_SEMICOLON, at(5, 16)},          // ;
+        Token{TokenType::T_ELSE, at(6, 5)},                // else
+        Token{TokenType::T_L_BRACE, at(6, 10)},            // {
+        Token{TokenType::T_IDENTIFIER, at(7, 9), "foo3"},  // foo3
+        Token{TokenType::T_L_PAREN, at(7, 14)},            // (
+        Token{TokenType::T_R_PAREN, at(7, 15)},            // )
+        Token{TokenType::T_SEMICOLON, at(7, 16)},          // ;
+        Token{TokenType::T_R_BRACE, at(8, 5)},             // }
+        Token{TokenType::T_R_BRACE, at(9, 1)},             // }
     };
 
     auto lexer = std::make_unique<MockLexer>(tokens);
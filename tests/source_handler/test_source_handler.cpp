@@ -85,3 +85,18 @@ BOOST_DATA_TEST_CASE(request_chars_after_eof_test, bdata::make(requests_after_eo
 
     BOOST_CHECK_EQUAL(char_pos.second, eof_position);
 }
+
+std::vector<std::tuple<source_offset, Position>> line_index_test_cases{
+    {0, Position{1, 1}}, {4, Position{1, 5}},  {5, Position{2, 1}},  {12, Position{3, 2}},
+    {6, Position{2, 2}}, {17, Position{5, 3}}, {14, Position{4, 1}}, {0, Position{1, 1}},
+    {25, Position{5, 11}}, {11, Position{3, 1}},
+};
+
+BOOST_AUTO_TEST_CASE(line_index_any_order_test) {
+    std::string text{"abcd\nefghi\nj\r\n\nend of text"};
+    LineIndex index{text};
+
+    for (const auto& [offset, expected] : line_index_test_cases) {
+        BOOST_CHECK_EQUAL(index.position_of(offset), expected);
+    }
+}